@@ -27,6 +27,7 @@
 #endif
 
 #ifdef __linux__
+#include <sched.h>
 #include <sys/syscall.h>
 #endif
 
@@ -389,6 +390,103 @@ double NominalCPUFrequency() {
   return nominal_cpu_frequency;
 }
 
+#if defined(__linux__)
+
+// Nodes are detected from sysfs, for up to `kMaxNumaCpus` logical processors.
+// `numa_node_of_cpu` must not need allocation, so it has a fixed size.
+static constexpr int kMaxNumaCpus = 4096;
+static constexpr int kMaxNumaNodes = 256;
+ABSL_CONST_INIT static uint8_t numa_node_of_cpu[kMaxNumaCpus] = {};
+
+// Reads `file` into `buf`, NUL-terminated. Returns false on failure.
+static bool ReadFileToBuffer(const char *file, char *buf, size_t size) {
+  const int fd = open(file, O_RDONLY | O_CLOEXEC);
+  if (fd == -1) return false;
+  size_t len = 0;
+  while (len < size - 1) {
+    const ssize_t n = read(fd, buf + len, size - 1 - len);
+    if (n < 0 && errno == EINTR) continue;
+    if (n <= 0) break;
+    len += static_cast<size_t>(n);
+  }
+  close(fd);
+  buf[len] = '\0';
+  return len > 0;
+}
+
+// Calls `fn` on each integer of a sysfs list such as "0-3,8,10-11\n".
+template <typename Fn>
+static void ForEachInList(const char *list, Fn fn) {
+  const char *p = list;
+  while (*p >= '0' && *p <= '9') {
+    char *end;
+    const long first = strtol(p, &end, 10);
+    long last = first;
+    if (*end == '-') last = strtol(end + 1, &end, 10);
+    for (long i = first; i <= last; ++i) fn(i);
+    if (*end != ',') break;
+    p = end + 1;
+  }
+}
+
+static int GetNumNumaNodes() {
+  static char list[4096];  // Only used under `init_num_numa_nodes_once`.
+  if (!ReadFileToBuffer("/sys/devices/system/node/online", list,
+                        sizeof(list))) {
+    return 1;
+  }
+  int num_nodes = 0;
+  ForEachInList(list, [&num_nodes](long node_id) {
+    if (num_nodes == kMaxNumaNodes) return;
+    char path[64];
+    snprintf(path, sizeof(path), "/sys/devices/system/node/node%ld/cpulist",
+             node_id);
+    char cpus[4096];
+    if (!ReadFileToBuffer(path, cpus, sizeof(cpus))) return;
+    const int node = num_nodes++;
+    ForEachInList(cpus, [node](long cpu) {
+      if (cpu >= 0 && cpu < kMaxNumaCpus) {
+        numa_node_of_cpu[cpu] = static_cast<uint8_t>(node);
+      }
+    });
+  });
+  return num_nodes > 0 ? num_nodes : 1;
+}
+
+#else
+
+static int GetNumNumaNodes() { return 1; }
+
+#endif
+
+ABSL_CONST_INIT static once_flag init_num_numa_nodes_once;
+ABSL_CONST_INIT static int num_numa_nodes = 1;
+
+int NumNumaNodes() {
+  base_internal::LowLevelCallOnce(&init_num_numa_nodes_once, []() {
+    num_numa_nodes = GetNumNumaNodes();
+  });
+  return num_numa_nodes;
+}
+
+int NumaNodeOfCpu(int cpu) {
+#if defined(__linux__)
+  if (NumNumaNodes() > 1 && cpu >= 0 && cpu < kMaxNumaCpus) {
+    return numa_node_of_cpu[cpu];
+  }
+#else
+  static_cast<void>(cpu);
+#endif
+  return 0;
+}
+
+int CurrentNumaNode() {
+#if defined(__linux__)
+  if (NumNumaNodes() > 1) return NumaNodeOfCpu(sched_getcpu());
+#endif
+  return 0;
+}
+
 #if defined(_WIN32)
 
 pid_t GetTID() {
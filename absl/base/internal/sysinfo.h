@@ -45,6 +45,19 @@ double NominalCPUFrequency();
 // Number of logical processors (hyperthreads) in system. Thread-safe.
 int NumCPUs();
 
+// Number of NUMA nodes in system, or 1 if unknown. Thread-safe.
+int NumNumaNodes();
+
+// Returns the NUMA node of logical processor `cpu`, in `[0, NumNumaNodes())`.
+// Nodes are numbered densely, in the order of the system's node ids. Returns 0
+// if unknown. Thread-safe.
+int NumaNodeOfCpu(int cpu);
+
+// Returns the NUMA node of the logical processor that the calling thread is
+// running on, as numbered by `NumaNodeOfCpu()`. The thread may migrate at any
+// time, so the result is only a hint. Thread-safe.
+int CurrentNumaNode();
+
 // Return the thread id of the current thread, as told by the system.
 // No two currently-live threads implemented by the OS shall have the same ID.
 // Thread ids of exited threads may be reused.   Multiple user-level threads
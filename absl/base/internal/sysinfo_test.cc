@@ -37,6 +37,17 @@ TEST(SysinfoTest, NumCPUs) {
       << "NumCPUs() should not have the default value of 0";
 }
 
+TEST(SysinfoTest, NumaNodes) {
+  const int num_nodes = NumNumaNodes();
+  EXPECT_GE(num_nodes, 1);
+  for (int cpu = 0; cpu < NumCPUs(); ++cpu) {
+    EXPECT_GE(NumaNodeOfCpu(cpu), 0);
+    EXPECT_LT(NumaNodeOfCpu(cpu), num_nodes);
+  }
+  EXPECT_GE(CurrentNumaNode(), 0);
+  EXPECT_LT(CurrentNumaNode(), num_nodes);
+}
+
 TEST(SysinfoTest, GetTID) {
   EXPECT_EQ(GetTID(), GetTID());  // Basic compile and equality test.
 #ifdef __native_client__
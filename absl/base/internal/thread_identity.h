@@ -161,7 +161,19 @@ struct ThreadIdentity {
   std::atomic<int> wait_start;  // Ticker value when thread started waiting.
   std::atomic<bool> is_idle;    // Has thread become idle yet?
 
+  // Used by the epoch-based reclamation of absl/synchronization/rcu.h.
+  // rcu_epoch is the global epoch when the thread entered its outermost
+  // read-side critical section, or 0 outside of one; other threads read it
+  // to find the oldest epoch still in use.  rcu_nesting is the depth of
+  // nested critical sections, and is only accessed by the thread itself.
+  std::atomic<uint64_t> rcu_epoch;
+  int rcu_nesting;
+
   ThreadIdentity* next;
+
+  // Links all ThreadIdentity objects ever allocated, which are never freed,
+  // so that they can be scanned without locking.  Set once on allocation.
+  ThreadIdentity* next_allocated;
 };
 
 // Returns the ThreadIdentity object representing the calling thread; guaranteed
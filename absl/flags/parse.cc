@@ -681,24 +681,22 @@ std::vector<std::string> GetMisspellingHints(const absl::string_view flag) {
   const size_t maxCutoff = std::min(flag.size() / 2 + 1, kMaxDistance);
   auto undefok = absl::GetFlag(FLAGS_undefok);
   BestHints best_hints(static_cast<uint8_t>(maxCutoff));
+  const strings_internal::DamerauLevenshteinMatcher matcher(flag);
   flags_internal::ForEachFlag([&](const CommandLineFlag& f) {
     if (best_hints.hints.size() >= kMaxHints) return;
-    uint8_t distance = strings_internal::CappedDamerauLevenshteinDistance(
-        flag, f.Name(), best_hints.best_distance);
+    uint8_t distance = matcher.Distance(f.Name(), best_hints.best_distance);
     best_hints.AddHint(f.Name(), distance);
     // For boolean flags, also calculate distance to the negated form.
     if (f.IsOfType<bool>()) {
       const std::string negated_flag = absl::StrCat("no", f.Name());
-      distance = strings_internal::CappedDamerauLevenshteinDistance(
-          flag, negated_flag, best_hints.best_distance);
+      distance = matcher.Distance(negated_flag, best_hints.best_distance);
       best_hints.AddHint(negated_flag, distance);
     }
   });
   // Finally calculate distance to flags in "undefok".
   absl::c_for_each(undefok, [&](const absl::string_view f) {
     if (best_hints.hints.size() >= kMaxHints) return;
-    uint8_t distance = strings_internal::CappedDamerauLevenshteinDistance(
-        flag, f, best_hints.best_distance);
+    uint8_t distance = matcher.Distance(f, best_hints.best_distance);
     best_hints.AddHint(absl::StrCat(f, " (undefok)"), distance);
   });
   return best_hints.hints;
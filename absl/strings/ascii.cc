@@ -21,6 +21,7 @@
 
 #include "absl/base/config.h"
 #include "absl/base/nullability.h"
+#include "absl/strings/internal/ascii_simd.h"
 
 namespace absl {
 ABSL_NAMESPACE_BEGIN
@@ -217,13 +218,24 @@ constexpr void AsciiStrCaseFold(char* absl_nonnull dst,
             : AsciiStrCaseFoldImpl<ToUpper, /*Naive=*/false>(dst, src, size);
 }
 
+// Strings of at least 16 bytes are converted by a SIMD kernel selected at
+// runtime, which may use wider vectors than the baseline instruction set that
+// `AsciiStrCaseFold` is compiled for.
 void AsciiStrToLower(char* absl_nonnull dst, const char* absl_nullable src,
                      size_t n) {
+  if (strings_internal::AsciiCaseFoldSimd(/*to_upper=*/false, dst, src, n) ==
+      n) {
+    return;
+  }
   return AsciiStrCaseFold<false>(dst, src, n);
 }
 
 void AsciiStrToUpper(char* absl_nonnull dst, const char* absl_nullable src,
                      size_t n) {
+  if (strings_internal::AsciiCaseFoldSimd(/*to_upper=*/true, dst, src, n) ==
+      n) {
+    return;
+  }
   return AsciiStrCaseFold<true>(dst, src, n);
 }
 
@@ -255,12 +267,12 @@ static_assert(ValidateAsciiCasefold() == 0, "error in case conversion");
 
 void AsciiStrToLower(std::string* absl_nonnull s) {
   char* p = &(*s)[0];
-  return ascii_internal::AsciiStrCaseFold<false>(p, p, s->size());
+  return ascii_internal::AsciiStrToLower(p, p, s->size());
 }
 
 void AsciiStrToUpper(std::string* absl_nonnull s) {
   char* p = &(*s)[0];
-  return ascii_internal::AsciiStrCaseFold<true>(p, p, s->size());
+  return ascii_internal::AsciiStrToUpper(p, p, s->size());
 }
 
 void RemoveExtraAsciiWhitespace(std::string* absl_nonnull str) {
@@ -155,4 +155,27 @@ BENCHMARK(BM_StrToLowerFromRvalref)
     ->RangeMultiplier(2)
     ->Range(64, 1 << 26);
 
+// Converts mixed-case text in place, as when normalizing header names or
+// identifiers.
+static void BM_StrToLowerInPlace(benchmark::State& state) {
+  const size_t size = static_cast<size_t>(state.range(0));
+  std::string s;
+  for (size_t i = 0; i < size; ++i) {
+    s.push_back("Content-Type: Text/HTML; "[i % 25]);
+  }
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(s);
+    absl::AsciiStrToLower(&s);
+    benchmark::DoNotOptimize(s);
+    absl::AsciiStrToUpper(&s);
+  }
+  state.SetBytesProcessed(state.iterations() * 2 * state.range(0));
+}
+BENCHMARK(BM_StrToLowerInPlace)
+    ->Arg(12)
+    ->Arg(24)
+    ->Arg(48)
+    ->Arg(1 << 10)
+    ->Arg(1 << 16);
+
 }  // namespace
@@ -17,11 +17,13 @@
 #include <algorithm>
 #include <cctype>
 #include <clocale>
+#include <cstddef>
 #include <cstring>
 #include <string>
 
 #include "gtest/gtest.h"
 #include "absl/base/macros.h"
+#include "absl/strings/internal/simd_dispatch_test_util.h"
 #include "absl/strings/string_view.h"
 
 namespace {
@@ -237,6 +239,34 @@ TEST(AsciiStrTo, Upper) {
   EXPECT_STREQ("MUTABLE", mutable_buf);
 }
 
+TEST(AsciiStrTo, EveryLengthAndSimdLevel) {
+  // Every byte value appears in the inputs, at every offset within a vector.
+  std::string input;
+  for (size_t i = 0; i < 300; ++i) {
+    input.push_back(static_cast<char>((i * 37) & 0xFF));
+  }
+  absl::strings_internal::ForEachSimdLevel([&] {
+    for (size_t size = 0; size <= input.size(); ++size) {
+      const absl::string_view in(input.data(), size);
+      std::string lower(in), upper(in);
+      for (char& c : lower) {
+        c = absl::ascii_tolower(static_cast<unsigned char>(c));
+      }
+      for (char& c : upper) {
+        c = absl::ascii_toupper(static_cast<unsigned char>(c));
+      }
+      ASSERT_EQ(absl::AsciiStrToLower(in), lower) << size;
+      ASSERT_EQ(absl::AsciiStrToUpper(in), upper) << size;
+
+      std::string in_place(in);
+      absl::AsciiStrToLower(&in_place);
+      ASSERT_EQ(in_place, lower) << size;
+      absl::AsciiStrToUpper(&in_place);
+      ASSERT_EQ(in_place, upper) << size;
+    }
+  });
+}
+
 TEST(StripLeadingAsciiWhitespace, FromStringView) {
   EXPECT_EQ(absl::string_view{},
             absl::StripLeadingAsciiWhitespace(absl::string_view{}));
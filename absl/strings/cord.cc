@@ -15,6 +15,7 @@
 #include "absl/strings/cord.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
@@ -206,12 +207,34 @@ void Cord::InlineRep::AppendTreeToInlined(CordRep* absl_nonnull tree,
   EmplaceTree(tree, method);
 }
 
+// Returns `tree`, compacted if automatic compaction is enabled and `tree` has
+// grown beyond `old_height` with an average data edge length below the
+// threshold. Checking only when the tree grows in height keeps the amortized
+// cost of the check per appended edge constant.
+static CordRepBtree* absl_nonnull MaybeAutoCompact(
+    CordRepBtree* absl_nonnull tree, int old_height) {
+  if (ABSL_PREDICT_TRUE(tree->height() <= old_height)) return tree;
+  const size_t threshold = cord_internal::cord_auto_compact_threshold.load(
+      std::memory_order_relaxed);
+  if (ABSL_PREDICT_TRUE(threshold == 0)) return tree;
+  if (tree->length >= threshold * CordRepBtree::CountDataEdges(tree)) {
+    return tree;
+  }
+  CordRepBtree* compacted =
+      CordRepBtree::Compact(tree, Cord::kDefaultCompactChunkSize);
+  if (compacted == nullptr) return tree;
+  CordRep::Unref(tree);
+  return compacted;
+}
+
 void Cord::InlineRep::AppendTreeToTree(CordRep* absl_nonnull tree,
                                        MethodIdentifier method) {
   assert(is_tree());
   const CordzUpdateScope scope(data_.cordz_info(), method);
-  tree = CordRepBtree::Append(ForceBtree(data_.as_tree()), tree);
-  SetTree(tree, scope);
+  CordRepBtree* root = ForceBtree(data_.as_tree());
+  const int height = root->height();
+  root = CordRepBtree::Append(root, tree);
+  SetTree(MaybeAutoCompact(root, height), scope);
 }
 
 void Cord::InlineRep::AppendTree(CordRep* absl_nonnull tree,
@@ -782,8 +805,11 @@ int CompareChunks(absl::string_view* absl_nonnull lhs,
   assert(*size_to_compare >= compared_size);
   *size_to_compare -= compared_size;
 
-  int memcmp_res = ::memcmp(lhs->data(), rhs->data(), compared_size);
-  if (memcmp_res != 0) return memcmp_res;
+  // Chunks of cords sharing data edges reference the same memory.
+  if (lhs->data() != rhs->data()) {
+    int memcmp_res = ::memcmp(lhs->data(), rhs->data(), compared_size);
+    if (memcmp_res != 0) return memcmp_res;
+  }
 
   lhs->remove_prefix(compared_size);
   rhs->remove_prefix(compared_size);
@@ -804,6 +830,131 @@ bool ComputeCompareResult<bool>(int memcmp_res) {
   return memcmp_res == 0;
 }
 
+// Returns true if `lhs` and `rhs` are the same tree, not counting any CRC
+// nodes, which is the case for copies of a cord. Either may be null.
+bool IsSameTree(const CordRep* absl_nullable lhs,
+                const CordRep* absl_nullable rhs) {
+  return lhs != nullptr && rhs != nullptr &&
+         cord_internal::SkipCrcNode(lhs) == cord_internal::SkipCrcNode(rhs);
+}
+
+// A forward position in a btree which, unlike `CordRepBtreeReader`, exposes
+// the nodes and data edges starting at the current position, allowing
+// comparisons to skip subtrees shared by both compared cords.
+class BtreeCursor {
+ public:
+  explicit BtreeCursor(const CordRepBtree* absl_nonnull tree)
+      : height_(tree->height()) {
+    node_[height_] = tree;
+    index_[height_] = tree->begin();
+    DiveFront(height_);
+  }
+
+  // Returns the remaining data of the current data edge, or an empty view at
+  // the end of the tree.
+  absl::string_view chunk() const { return chunk_; }
+
+  // Consumes the first `n` bytes of `chunk()`.
+  void Consume(size_t n) {
+    assert(n <= chunk_.size());
+    if (n == 0) return;
+    chunk_.remove_prefix(n);
+    at_edge_start_ = false;
+    if (chunk_.empty()) Next(0);
+  }
+
+  // Returns the highest level at which an edge starts at the current position,
+  // or -1 if the current position is inside a data edge. Level 0 holds data
+  // edges, level `i` holds the nodes of height `i - 1`.
+  int StartLevel() const {
+    if (!at_edge_start_ || chunk_.empty()) return -1;
+    int level = 0;
+    while (level < height_ && index_[level] == node_[level]->begin()) {
+      ++level;
+    }
+    return level;
+  }
+
+  // Returns the edge at `level`, which must not exceed `StartLevel()`.
+  const CordRep* Edge(int level) const {
+    return node_[level]->Edge(index_[level]);
+  }
+
+  // Skips the edge at `level`, which must not exceed `StartLevel()`.
+  void SkipEdge(int level) { Next(level); }
+
+ private:
+  // Moves to the first data edge following the edge at `level`.
+  void Next(int level) {
+    for (; level <= height_; ++level) {
+      if (++index_[level] < node_[level]->end()) {
+        DiveFront(level);
+        return;
+      }
+    }
+    chunk_ = absl::string_view();
+  }
+
+  // Moves to the first data edge of the edge at `level`.
+  void DiveFront(int level) {
+    while (level > 0) {
+      const CordRepBtree* node = node_[level]->Edge(index_[level])->btree();
+      node_[--level] = node;
+      index_[level] = node->begin();
+    }
+    chunk_ = node_[0]->Data(index_[0]);
+    at_edge_start_ = true;
+  }
+
+  const int height_;
+  bool at_edge_start_;
+  absl::string_view chunk_;
+  const CordRepBtree* node_[CordRepBtree::kMaxDepth];
+  size_t index_[CordRepBtree::kMaxDepth];
+};
+
+// If an edge of `lhs` starting at the current position is also an edge of
+// `rhs` starting at the current position, skips it in both and returns its
+// length. Otherwise returns 0. Only edges of up to `n` bytes are considered.
+size_t SkipSharedEdge(BtreeCursor& lhs, BtreeCursor& rhs, size_t n) {
+  const int rhs_level = rhs.StartLevel();
+  if (rhs_level < 0) return 0;
+  for (int lhs_level = lhs.StartLevel(); lhs_level >= 0; --lhs_level) {
+    const CordRep* edge = lhs.Edge(lhs_level);
+    if (edge->length > n) continue;
+    for (int level = rhs_level; level >= 0; --level) {
+      if (rhs.Edge(level) == edge) {
+        lhs.SkipEdge(lhs_level);
+        rhs.SkipEdge(level);
+        return edge->length;
+      }
+    }
+  }
+  return 0;
+}
+
+// Compares the next `n` bytes of `lhs` and `rhs`, which must both hold at
+// least `n` more bytes, and returns a memcmp-like result.
+int CompareBtrees(BtreeCursor& lhs, BtreeCursor& rhs, size_t n) {
+  while (n > 0) {
+    if (size_t skipped = SkipSharedEdge(lhs, rhs, n)) {
+      n -= skipped;
+      continue;
+    }
+    absl::string_view lhs_chunk = lhs.chunk();
+    absl::string_view rhs_chunk = rhs.chunk();
+    const size_t size = std::min({lhs_chunk.size(), rhs_chunk.size(), n});
+    if (lhs_chunk.data() != rhs_chunk.data()) {
+      int memcmp_res = ::memcmp(lhs_chunk.data(), rhs_chunk.data(), size);
+      if (memcmp_res != 0) return memcmp_res;
+    }
+    lhs.Consume(size);
+    rhs.Consume(size);
+    n -= size;
+  }
+  return 0;
+}
+
 }  // namespace
 
 // Helper routine. Locates the first flat or external chunk of the Cord without
@@ -933,6 +1084,21 @@ inline int Cord::CompareSlowPath(const Cord& rhs, size_t compared_size,
     return true;
   };
 
+  // Btrees are compared by edge, which skips subtrees shared by both cords,
+  // as they are after `Subcord()` or appending a copy.
+  if (contents_.is_tree() && rhs.contents_.is_tree()) {
+    const CordRep* lhs_tree = cord_internal::SkipCrcNode(contents_.tree());
+    const CordRep* rhs_tree = cord_internal::SkipCrcNode(rhs.contents_.tree());
+    if (lhs_tree->IsBtree() && rhs_tree->IsBtree()) {
+      BtreeCursor lhs_cursor(lhs_tree->btree());
+      BtreeCursor rhs_cursor(rhs_tree->btree());
+      lhs_cursor.Consume(compared_size);
+      rhs_cursor.Consume(compared_size);
+      return CompareBtrees(lhs_cursor, rhs_cursor,
+                           size_to_compare - compared_size);
+    }
+  }
+
   Cord::ChunkIterator lhs_it = chunk_begin();
   Cord::ChunkIterator rhs_it = rhs.chunk_begin();
 
@@ -975,9 +1141,10 @@ ResultType GenericCompare(const Cord& lhs, const RHS& rhs,
 
   size_t compared_size = std::min(lhs_chunk.size(), rhs_chunk.size());
   assert(size_to_compare >= compared_size);
-  int memcmp_res = compared_size > 0 ? ::memcmp(lhs_chunk.data(),
-                                                rhs_chunk.data(), compared_size)
-                                     : 0;
+  int memcmp_res = compared_size > 0 && lhs_chunk.data() != rhs_chunk.data()
+                       ? ::memcmp(lhs_chunk.data(), rhs_chunk.data(),
+                                  compared_size)
+                       : 0;
   if (compared_size == size_to_compare || memcmp_res != 0) {
     return ComputeCompareResult<ResultType>(memcmp_res);
   }
@@ -991,6 +1158,7 @@ bool Cord::EqualsImpl(absl::string_view rhs, size_t size_to_compare) const {
 }
 
 bool Cord::EqualsImpl(const Cord& rhs, size_t size_to_compare) const {
+  if (IsSameTree(contents_.tree(), rhs.contents_.tree())) return true;
   return GenericCompare<bool>(*this, rhs, size_to_compare);
 }
 
@@ -1015,6 +1183,7 @@ int Cord::Compare(absl::string_view rhs) const {
 }
 
 int Cord::CompareImpl(const Cord& rhs) const {
+  if (IsSameTree(contents_.tree(), rhs.contents_.tree())) return 0;
   return SharedCompareImpl(*this, rhs);
 }
 
@@ -1393,6 +1562,23 @@ absl::string_view Cord::FlattenSlowPath() {
   return absl::string_view(new_buffer, total_size);
 }
 
+void Cord::Compact(size_t chunk_size) {
+  if (!contents_.is_tree()) return;
+  CordRep* rep = contents_.tree();
+  const CordRep* tree = cord_internal::SkipCrcNode(rep);
+  if (tree == nullptr || !tree->IsBtree()) return;
+  chunk_size = std::min(std::max(chunk_size, kMinFlatLength),
+                        cord_internal::kMaxLargeFlatLength);
+  CordRep* compacted = CordRepBtree::Compact(tree->btree(), chunk_size);
+  if (compacted == nullptr) return;
+  if (rep->IsCrc()) {
+    compacted = CordRepCrc::New(compacted, rep->crc()->crc_cord_state);
+  }
+  CordzUpdateScope scope(contents_.cordz_info(), CordzUpdateTracker::kCompact);
+  CordRep::Unref(rep);
+  contents_.SetTree(compacted, scope);
+}
+
 /* static */ bool Cord::GetFlatAux(CordRep* absl_nonnull rep,
                                    absl::string_view* absl_nonnull fragment) {
   assert(rep != nullptr);
@@ -773,6 +773,32 @@ class Cord {
   // If the cord was already flat, the contents are not modified.
   absl::string_view Flatten() ABSL_ATTRIBUTE_LIFETIME_BOUND;
 
+  // Cord::Compact()
+  //
+  // Reduces the fragmentation of this cord by copying each run of adjacent
+  // small chunks into new chunks of `chunk_size` bytes. Chunks of at least half
+  // of `chunk_size` bytes, such as large external memory or flats shared with
+  // other cords, are left in place and remain shared. The contents of the cord
+  // and any expected checksum are unchanged.
+  //
+  // Cords built from many small appends, or trimmed by many calls to
+  // `RemovePrefix()`, can hold thousands of tiny chunks which slow down
+  // iteration and waste memory. Unlike `Flatten()`, `Compact()` copies only
+  // the fragmented parts of a cord. `chunk_size` is clamped to the range of
+  // sizes of a `CordBuffer` with a custom limit.
+  //
+  // Example:
+  //
+  //   absl::Cord message = ReadMessage();
+  //   message.Compact();
+  //   for (absl::string_view chunk : message.Chunks()) { ... }
+  void Compact(size_t chunk_size = kDefaultCompactChunkSize);
+
+  // The default chunk size of `Compact()`, which is the largest chunk size
+  // that does not require allocating large flats.
+  static constexpr size_t kDefaultCompactChunkSize =
+      cord_internal::kMaxFlatLength;
+
   // Cord::Find()
   //
   // Returns an iterator to the first occurrence of the substring `needle`.
@@ -0,0 +1,124 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <utility>
+
+#include "absl/profiling/benchmark.h"
+#include "absl/strings/cord.h"
+#include "absl/strings/cord_buffer.h"
+#include "absl/strings/internal/cord_rep_flat_cache.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+
+namespace {
+
+// Builds and destroys a Cord from `state.range(1)` appends of
+// `state.range(0)` bytes each, with the flat cache enabled when
+// `state.range(2)` is non-zero. This is the allocation pattern of small
+// request and response messages.
+void BM_CordAppendDestroy(benchmark::State& state) {
+  const std::string piece(static_cast<size_t>(state.range(0)), 'x');
+  const int64_t appends = state.range(1);
+  if (state.thread_index() == 0) {
+    absl::cord_internal::enable_flat_cache(state.range(2) != 0);
+  }
+  for (auto _ : state) {
+    absl::Cord cord;
+    for (int64_t i = 0; i < appends; ++i) {
+      // Appending a Cord, rather than a string, adds each piece as its own
+      // flat instead of filling the last one.
+      cord.Append(absl::Cord(piece));
+    }
+    benchmark::DoNotOptimize(cord);
+  }
+  absl::cord_internal::ReleaseThreadFlatCache();
+  if (state.thread_index() == 0) {
+    absl::cord_internal::enable_flat_cache(false);
+  }
+  state.SetItemsProcessed(state.iterations() * appends);
+}
+BENCHMARK(BM_CordAppendDestroy)
+    ->ArgsProduct({{64, 1024}, {4, 32}, {0, 1}})
+    ->ThreadRange(1, 32)
+    ->UseRealTime();
+
+// Returns a cord of at least `size` bytes appended in flats of `piece` bytes.
+absl::Cord FragmentedCord(size_t size, size_t piece) {
+  absl::Cord cord;
+  while (cord.size() < size) {
+    absl::CordBuffer buffer = absl::CordBuffer::CreateWithDefaultLimit(piece);
+    absl::Span<char> data = buffer.available_up_to(piece);
+    std::memset(data.data(), 'x', data.size());
+    buffer.IncreaseLengthBy(data.size());
+    cord.Append(std::move(buffer));
+  }
+  return cord;
+}
+
+// Iterates over the chunks of a 1MiB cord fragmented into pieces of
+// `state.range(0)` bytes, compacted first when `state.range(1)` is non-zero.
+// Reports the memory usage of the cord as `bytes`.
+void BM_CordIterateFragmented(benchmark::State& state) {
+  absl::Cord cord =
+      FragmentedCord(1 << 20, static_cast<size_t>(state.range(0)));
+  if (state.range(1) != 0) cord.Compact();
+  for (auto _ : state) {
+    size_t sum = 0;
+    for (absl::string_view chunk : cord.Chunks()) {
+      sum += static_cast<unsigned char>(chunk.back());
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(cord.size()));
+  state.counters["bytes"] = static_cast<double>(cord.EstimatedMemoryUsage());
+}
+BENCHMARK(BM_CordIterateFragmented)->ArgsProduct({{32, 256, 2048}, {0, 1}});
+
+// Compacts a 1MiB cord fragmented into pieces of `state.range(0)` bytes.
+void BM_CordCompact(benchmark::State& state) {
+  const absl::Cord fragmented =
+      FragmentedCord(1 << 20, static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    absl::Cord cord = fragmented;
+    cord.Compact();
+    benchmark::DoNotOptimize(cord);
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(fragmented.size()));
+}
+BENCHMARK(BM_CordCompact)->Arg(32)->Arg(256)->Arg(2048);
+
+// Compares two 1MiB cords of 4KiB flats. With `state.range(0)` set, the cords
+// are separate subcords of the same cord and share all but their boundary
+// nodes; otherwise they hold copies of the same data.
+void BM_CordEqualsSubcords(benchmark::State& state) {
+  const absl::Cord base = FragmentedCord(2 << 20, 4096);
+  const absl::Cord lhs = base.Subcord(100, 1 << 20);
+  const absl::Cord rhs = state.range(0) != 0
+                             ? base.Subcord(100, 1 << 20)
+                             : absl::Cord(std::string(lhs));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(lhs == rhs);
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(lhs.size()));
+}
+BENCHMARK(BM_CordEqualsSubcords)->Arg(0)->Arg(1);
+
+}  // namespace
@@ -0,0 +1,78 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/strings/cord_record_reader.h"
+
+#include <cstddef>
+
+#include "absl/base/config.h"
+#include "absl/strings/cord.h"
+#include "absl/strings/internal/str_split_internal.h"
+#include "absl/strings/string_view.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+CordRecordReader::CordRecordReader(const absl::Cord& cord, char delimiter)
+    : it_(cord.chunk_begin()),
+      end_(cord.chunk_end()),
+      matcher_(delimiter),
+      scanner_(matcher_) {
+  if (it_ != end_) chunk_ = *it_;
+}
+
+CordRecordReader::CordRecordReader(absl::string_view text, char delimiter)
+    : chunk_(text), matcher_(delimiter), scanner_(matcher_) {}
+
+bool CordRecordReader::NextChunk() {
+  if (it_ == end_ || ++it_ == end_) return false;
+  chunk_ = *it_;
+  pos_ = 0;
+  // The scanner caches its position within the previous chunk.
+  scanner_ = strings_internal::DelimiterBlockScanner(matcher_);
+  return true;
+}
+
+bool CordRecordReader::Next(absl::string_view& record) {
+  buffer_.clear();
+  bool straddles = false;
+  while (true) {
+    if (pos_ == chunk_.size() && !NextChunk()) {
+      // The input ends without a delimiter after the last record.
+      if (!straddles) return false;
+      record = buffer_;
+      return true;
+    }
+    const size_t found = scanner_.Find(chunk_, pos_);
+    if (found != absl::string_view::npos) {
+      const absl::string_view piece = chunk_.substr(pos_, found - pos_);
+      position_ += found + 1 - pos_;
+      pos_ = found + 1;
+      if (straddles) {
+        buffer_.append(piece.data(), piece.size());
+        record = buffer_;
+      } else {
+        record = piece;
+      }
+      return true;
+    }
+    buffer_.append(chunk_.data() + pos_, chunk_.size() - pos_);
+    position_ += chunk_.size() - pos_;
+    pos_ = chunk_.size();
+    straddles = true;
+  }
+}
+
+ABSL_NAMESPACE_END
+}  // namespace absl
@@ -0,0 +1,99 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// -----------------------------------------------------------------------------
+// File: cord_record_reader.h
+// -----------------------------------------------------------------------------
+//
+// This header file defines `absl::CordRecordReader`, which reads the lines, or
+// more generally the records separated by a single-byte delimiter, of an
+// `absl::Cord` or `absl::string_view` without flattening it.
+//
+// Example:
+//
+//   absl::Cord log = ReadLog();
+//   absl::CordRecordReader reader(log);
+//   absl::string_view line;
+//   while (reader.Next(line)) {
+//     ProcessLine(line);
+//   }
+
+#ifndef ABSL_STRINGS_CORD_RECORD_READER_H_
+#define ABSL_STRINGS_CORD_RECORD_READER_H_
+
+#include <cstddef>
+#include <string>
+
+#include "absl/base/attributes.h"
+#include "absl/base/config.h"
+#include "absl/strings/cord.h"
+#include "absl/strings/internal/str_split_internal.h"
+#include "absl/strings/string_view.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+// CordRecordReader
+//
+// Reads the records of a Cord or string_view, separated by `delimiter`. A
+// delimiter at the very end of the input terminates the last record rather than
+// starting an empty one, so that "a\nb\n" and "a\nb" both hold the records "a"
+// and "b", and an empty input holds no records.
+//
+// A record within a single chunk of the Cord is returned as a view into that
+// chunk. Only records straddling chunk boundaries are assembled into a buffer
+// owned by the reader. Delimiters are found 64 bytes at a time using SIMD
+// instructions where available.
+//
+// The input must outlive the reader and must not be modified while it is read.
+class CordRecordReader {
+ public:
+  explicit CordRecordReader(const absl::Cord& cord ABSL_ATTRIBUTE_LIFETIME_BOUND,
+                            char delimiter = '\n');
+  explicit CordRecordReader(absl::string_view text ABSL_ATTRIBUTE_LIFETIME_BOUND,
+                            char delimiter = '\n');
+
+  CordRecordReader(const CordRecordReader&) = delete;
+  CordRecordReader& operator=(const CordRecordReader&) = delete;
+
+  // Reads the next record, without its delimiter, into `record`. Returns false
+  // once all records have been read. `record` remains valid until the next
+  // call to `Next()` or the destruction of the reader or the input.
+  bool Next(absl::string_view& record);
+
+  // Returns the number of bytes of the input consumed by the records read so
+  // far, including their delimiters.
+  size_t position() const { return position_; }
+
+ private:
+  // Moves to the next chunk of the input. Returns false at the end of the
+  // input.
+  bool NextChunk();
+
+  absl::Cord::ChunkIterator it_;
+  absl::Cord::ChunkIterator end_;
+  absl::string_view chunk_;
+  // The position of the next record in `chunk_`.
+  size_t pos_ = 0;
+  size_t position_ = 0;
+  strings_internal::ByteSetMatcher matcher_;
+  strings_internal::DelimiterBlockScanner scanner_;
+  // Holds the current record if it straddles chunks.
+  std::string buffer_;
+};
+
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_STRINGS_CORD_RECORD_READER_H_
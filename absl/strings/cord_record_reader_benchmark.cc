@@ -0,0 +1,72 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "absl/profiling/benchmark.h"
+#include "absl/strings/cord.h"
+#include "absl/strings/cord_record_reader.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_split.h"
+#include "absl/strings/string_view.h"
+
+namespace {
+
+// Returns a cord of `size` bytes of JSONL-like lines of varying length.
+absl::Cord MakeLog(size_t size) {
+  absl::Cord log;
+  std::string line;
+  for (uint64_t i = 0; log.size() < size; ++i) {
+    line.clear();
+    absl::StrAppend(&line, "{\"id\":", i, ",\"msg\":\"",
+                    std::string(i * 7919 % 200, 'x'), "\"}\n");
+    log.Append(line);
+  }
+  return log;
+}
+
+size_t Consume(absl::string_view line) { return line.size(); }
+
+void BM_FlattenAndStrSplit(benchmark::State& state) {
+  const absl::Cord log = MakeLog(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    absl::Cord copy = log;
+    size_t total = 0;
+    for (absl::string_view line : absl::StrSplit(copy.Flatten(), '\n')) {
+      total += Consume(line);
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(log.size()));
+}
+BENCHMARK(BM_FlattenAndStrSplit)->Arg(1 << 20)->Arg(100 << 20);
+
+void BM_CordRecordReader(benchmark::State& state) {
+  const absl::Cord log = MakeLog(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    absl::CordRecordReader reader(log);
+    size_t total = 0;
+    absl::string_view line;
+    while (reader.Next(line)) total += Consume(line);
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(log.size()));
+}
+BENCHMARK(BM_CordRecordReader)->Arg(1 << 20)->Arg(100 << 20);
+
+}  // namespace
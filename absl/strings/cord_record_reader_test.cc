@@ -0,0 +1,134 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/strings/cord_record_reader.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "absl/strings/cord.h"
+#include "absl/strings/cord_test_helpers.h"
+#include "absl/strings/str_split.h"
+#include "absl/strings/string_view.h"
+
+namespace {
+
+using ::testing::ElementsAre;
+using ::testing::IsEmpty;
+
+std::vector<std::string> ReadAll(absl::CordRecordReader& reader) {
+  std::vector<std::string> records;
+  absl::string_view record;
+  while (reader.Next(record)) records.emplace_back(record);
+  return records;
+}
+
+std::vector<std::string> ReadAll(absl::string_view text,
+                                 char delimiter = '\n') {
+  absl::CordRecordReader reader(text, delimiter);
+  return ReadAll(reader);
+}
+
+std::vector<std::string> ReadAll(const absl::Cord& cord,
+                                 char delimiter = '\n') {
+  absl::CordRecordReader reader(cord, delimiter);
+  return ReadAll(reader);
+}
+
+TEST(CordRecordReaderTest, StringView) {
+  EXPECT_THAT(ReadAll(""), IsEmpty());
+  EXPECT_THAT(ReadAll("a"), ElementsAre("a"));
+  EXPECT_THAT(ReadAll("a\n"), ElementsAre("a"));
+  EXPECT_THAT(ReadAll("\n"), ElementsAre(""));
+  EXPECT_THAT(ReadAll("a\nbc\n\nd"), ElementsAre("a", "bc", "", "d"));
+  EXPECT_THAT(ReadAll("a\nbc\n\nd\n"), ElementsAre("a", "bc", "", "d"));
+  EXPECT_THAT(ReadAll("a\nb;c;", ';'), ElementsAre("a\nb", "c"));
+}
+
+TEST(CordRecordReaderTest, ReturnsViewsIntoInput) {
+  const absl::string_view text = "first\nsecond\n";
+  absl::CordRecordReader reader(text);
+  absl::string_view record;
+  ASSERT_TRUE(reader.Next(record));
+  EXPECT_EQ(record.data(), text.data());
+  EXPECT_EQ(reader.position(), 6);
+  ASSERT_TRUE(reader.Next(record));
+  EXPECT_EQ(record.data(), text.data() + 6);
+  EXPECT_EQ(reader.position(), 13);
+  EXPECT_FALSE(reader.Next(record));
+}
+
+TEST(CordRecordReaderTest, FragmentedCord) {
+  const absl::Cord cord =
+      absl::MakeFragmentedCord({"ab", "c\nde", "\n", "\nf", "gh", "i", "\nj"});
+  EXPECT_THAT(ReadAll(cord), ElementsAre("abc", "de", "", "fghi", "j"));
+  EXPECT_THAT(ReadAll(absl::Cord()), IsEmpty());
+  EXPECT_THAT(ReadAll(absl::MakeFragmentedCord({"a\n", "b\n"})),
+              ElementsAre("a", "b"));
+  EXPECT_THAT(ReadAll(absl::MakeFragmentedCord({"a", "\n", "b"})),
+              ElementsAre("a", "b"));
+}
+
+TEST(CordRecordReaderTest, AssemblesOnlyStraddlingRecords) {
+  const absl::Cord cord = absl::MakeFragmentedCord({"one\ntw", "o\nthree\n"});
+  absl::CordRecordReader reader(cord);
+  absl::string_view record;
+  ASSERT_TRUE(reader.Next(record));
+  EXPECT_EQ(record, "one");
+  EXPECT_EQ(record.data(), cord.chunk_begin()->data());
+  ASSERT_TRUE(reader.Next(record));
+  EXPECT_EQ(record, "two");
+  ASSERT_TRUE(reader.Next(record));
+  EXPECT_EQ(record, "three");
+  EXPECT_EQ(record.data(), std::next(cord.chunk_begin())->data() + 2);
+  EXPECT_EQ(reader.position(), cord.size());
+  EXPECT_FALSE(reader.Next(record));
+}
+
+TEST(CordRecordReaderTest, MatchesStrSplit) {
+  std::minstd_rand rng(42);
+  std::uniform_int_distribution<int> byte(0, 9);
+  std::uniform_int_distribution<size_t> size(0, 300);
+  for (int i = 0; i < 200; ++i) {
+    std::string text;
+    // Every tenth input is long, and spans many chunks.
+    const size_t n = size(rng) * (i % 10 == 0 ? 20 : 1);
+    for (size_t j = 0; j < n; ++j) {
+      text.push_back(byte(rng) == 0 && j % 3 != 0
+                         ? '\n'
+                         : static_cast<char>('a' + j % 26));
+    }
+
+    std::vector<std::string> expected = absl::StrSplit(text, '\n');
+    if (text.empty() || text.back() == '\n') expected.pop_back();
+
+    std::vector<std::string> pieces;
+    for (size_t pos = 0; pos < text.size();) {
+      const size_t piece = std::min(text.size() - pos, size(rng) / 4 + 1);
+      pieces.push_back(text.substr(pos, piece));
+      pos += piece;
+    }
+    EXPECT_EQ(ReadAll(text), expected);
+    EXPECT_EQ(ReadAll(absl::MakeFragmentedCord(pieces)), expected);
+    EXPECT_EQ(ReadAll(absl::Cord(text)), expected);
+  }
+}
+
+}  // namespace
@@ -1158,6 +1158,105 @@ TEST_P(CordTest, Flatten) {
   VerifyFlatten(MaybeHardened(absl::Cord(RandomLowercaseString(&rng, 8192))));
 }
 
+static size_t CountChunks(const absl::Cord& c) {
+  size_t count = 0;
+  for (absl::string_view chunk : c.Chunks()) {
+    static_cast<void>(chunk);
+    ++count;
+  }
+  return count;
+}
+
+// Appends `data` to `cord` in flats of `piece_size` bytes.
+static void AppendFragmented(absl::Cord& cord, absl::string_view data,
+                             size_t piece_size) {
+  while (!data.empty()) {
+    const size_t n = std::min(piece_size, data.size());
+    absl::CordBuffer buffer = absl::CordBuffer::CreateWithDefaultLimit(n);
+    memcpy(buffer.data(), data.data(), n);
+    buffer.SetLength(n);
+    cord.Append(std::move(buffer));
+    data.remove_prefix(n);
+  }
+}
+
+TEST_P(CordTest, Compact) {
+  absl::Cord empty;
+  empty.Compact();
+  EXPECT_TRUE(empty.empty());
+
+  // An empty cord with a checksum has a CRC node without a child.
+  absl::Cord empty_with_crc;
+  empty_with_crc.SetExpectedChecksum(0);
+  empty_with_crc.Compact();
+  EXPECT_TRUE(empty_with_crc.empty());
+  EXPECT_EQ(empty_with_crc.ExpectedChecksum(), 0);
+
+  absl::Cord small("small cord");
+  MaybeHarden(small);
+  small.Compact();
+  EXPECT_EQ(small, "small cord");
+
+  RandomEngine rng(GTEST_FLAG_GET(random_seed));
+  const std::string data = RandomLowercaseString(&rng, 50000);
+  absl::Cord cord;
+  AppendFragmented(cord, data, 50);
+  cord.RemovePrefix(25);
+  MaybeHarden(cord);
+  ASSERT_EQ(CountChunks(cord), 1000);
+  const size_t fragmented_memory = cord.EstimatedMemoryUsage();
+
+  cord.Compact();
+  EXPECT_EQ(cord, absl::string_view(data).substr(25));
+  EXPECT_EQ(CountChunks(cord), 13);
+  EXPECT_LT(cord.EstimatedMemoryUsage(), fragmented_memory);
+  if (UseCrc()) {
+    EXPECT_EQ(cord.ExpectedChecksum(), 1);
+  }
+
+  // Compacting again has nothing left to do.
+  const absl::string_view first_chunk = *cord.chunk_begin();
+  cord.Compact();
+  EXPECT_EQ(cord.chunk_begin()->data(), first_chunk.data());
+
+  cord.Compact(1 << 20);
+  EXPECT_EQ(cord, absl::string_view(data).substr(25));
+}
+
+TEST_P(CordTest, CompactKeepsLargeSharedChunks) {
+  RandomEngine rng(GTEST_FLAG_GET(random_seed));
+  const std::string big = RandomLowercaseString(&rng, 100000);
+  const absl::Cord shared(big);
+  absl::Cord cord;
+  std::string expected;
+  for (int i = 0; i < 3; ++i) {
+    const std::string pieces = RandomLowercaseString(&rng, 2000);
+    AppendFragmented(cord, pieces, 20);
+    expected += pieces;
+    cord.Append(shared);
+    expected += big;
+  }
+  MaybeHarden(cord);
+  const size_t shared_memory = shared.EstimatedMemoryUsage();
+
+  cord.Compact();
+  EXPECT_EQ(cord, expected);
+  // The large chunks of `shared` are not copied.
+  EXPECT_LT(cord.EstimatedMemoryUsage(absl::CordMemoryAccounting::kFairShare),
+            shared_memory);
+}
+
+TEST_P(CordTest, AutoCompact) {
+  absl::cord_internal::set_cord_auto_compact_threshold(512);
+  RandomEngine rng(GTEST_FLAG_GET(random_seed));
+  const std::string data = RandomLowercaseString(&rng, 150000);
+  absl::Cord cord;
+  AppendFragmented(cord, data, 30);
+  absl::cord_internal::set_cord_auto_compact_threshold(0);
+  EXPECT_EQ(cord, data);
+  EXPECT_LT(CountChunks(cord), 1000);
+}
+
 // Test data
 namespace {
 class TestData {
@@ -1593,6 +1692,36 @@ TEST_P(CordTest, CompareRandomComparisons) {
                 coin_flip(rng) ? d : absl::Cord(std::string(d)), &rng);
   }
 }
+
+TEST_P(CordTest, CompareSharedSubtrees) {
+  const int kIters = 500;
+  RandomEngine rng(GTEST_FLAG_GET(random_seed));
+  absl::Cord base;
+  AppendFragmented(base, RandomLowercaseString(&rng, 100000), 100);
+  const absl::Cord copy = MaybeHardened(base);
+  EXPECT_EQ(base, copy);
+  EXPECT_EQ(base.Compare(copy), 0);
+  EXPECT_TRUE(base.StartsWith(copy));
+
+  for (int i = 0; i < kIters; i++) {
+    const size_t offset = GetUniformRandomUpTo(&rng, size_t{50000});
+    const size_t size = GetUniformRandomUpTo(&rng, size_t{50000});
+    absl::Cord c = base.Subcord(offset, size);
+    absl::Cord d = base.Subcord(offset, size);
+    MaybeHarden(c);
+    EXPECT_EQ(c, d);
+    EXPECT_TRUE(base.Subcord(0, offset + size).EndsWith(d));
+
+    // Replace or remove a random byte of `d`, or cut it short.
+    const size_t pos = GetUniformRandomUpTo(&rng, size);
+    absl::Cord e = d.Subcord(0, pos);
+    e.Append(RandomLowercaseString(&rng, GetUniformRandomUpTo(&rng, 2)));
+    if (i % 2 == 0) e.Append(d.Subcord(pos + 1, size));
+    TestCompare(c, e, &rng);
+    TestCompare(e, c, &rng);
+    EXPECT_EQ(c == e, std::string(c) == std::string(e));
+  }
+}
 #endif
 
 template <typename T1, typename T2>
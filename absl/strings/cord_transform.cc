@@ -0,0 +1,497 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/strings/cord_transform.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <utility>
+
+#include "absl/base/config.h"
+#include "absl/base/internal/endian.h"
+#include "absl/base/nullability.h"
+#include "absl/base/optimization.h"
+#include "absl/crc/crc32c.h"
+#include "absl/numeric/bits.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/cord.h"
+#include "absl/strings/cord_buffer.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+absl::Span<char> CordTransformOutput::GetAppendBuffer(size_t min_size) {
+  assert(min_size <= kMaxAppendBufferSize);
+  if (buffer_.available().size() < min_size) {
+    Flush();
+    buffer_ = CordBuffer::CreateWithCustomLimit(
+        CordBuffer::kCustomLimit, (std::max)(min_size, CordBuffer::kDefaultLimit));
+    if (buffer_.capacity() < min_size) {
+      // The allocator rounded the request down to a power of two.
+      buffer_ = CordBuffer::CreateWithCustomLimit(CordBuffer::kCustomLimit,
+                                                  CordBuffer::kCustomLimit);
+    }
+  }
+  return buffer_.available();
+}
+
+void CordTransformOutput::Append(absl::string_view data) {
+  while (!data.empty()) {
+    absl::Span<char> buf = buffer_.available();
+    if (buf.empty()) {
+      buf = GetAppendBuffer(
+          (std::min)(data.size(), size_t{kMaxAppendBufferSize}));
+    }
+    const size_t n = (std::min)(buf.size(), data.size());
+    std::memcpy(buf.data(), data.data(), n);
+    buffer_.IncreaseLengthBy(n);
+    data.remove_prefix(n);
+  }
+}
+
+void CordTransformOutput::Flush() {
+  if (buffer_.length() != 0) dest_->Append(std::move(buffer_));
+  buffer_ = CordBuffer();
+}
+
+absl::Status TransformCord(const absl::Cord& src,
+                           CordTransform* absl_nonnull transform,
+                           absl::Cord* absl_nonnull dest) {
+  CordTransformOutput output(dest);
+  for (absl::string_view chunk : src.Chunks()) {
+    absl::Status status = transform->Update(chunk, &output);
+    if (!status.ok()) return status;
+  }
+  return transform->Finish(&output);
+}
+
+namespace {
+
+// Stream format
+//
+// The stream is a sequence of blocks, each introduced by an 11-byte header:
+//
+//   byte  0      block type (`BlockType`)
+//   bytes 1..3   stored payload size, little endian
+//   bytes 4..6   uncompressed size, little endian
+//   bytes 7..10  CRC32C of the uncompressed bytes, little endian
+//
+// The stream ends with a `kEnd` header whose other fields are zero.
+//
+// An LZ payload is a sequence of LZ4-style sequences: a token byte holding
+// the literal length in its high nibble and the match length minus
+// `kMinMatch` in its low nibble, extended by runs of 255-valued bytes when a
+// nibble is 15; the literals; a 2-byte little-endian match offset; and then
+// the match length extension. The final sequence of a block has literals
+// only, and ends exactly when the block's uncompressed size is reached.
+enum BlockType : uint8_t {
+  kEnd = 0,
+  kRaw = 1,
+  kLz = 2,
+};
+
+constexpr size_t kHeaderSize = 11;
+constexpr size_t kMinMatch = 4;
+constexpr size_t kMaxOffset = 65535;
+constexpr int kHashBits = 12;
+
+static_assert(kLzCordBlockSize + kHeaderSize ==
+                  CordTransformOutput::kMaxAppendBufferSize,
+              "kLzCordBlockSize does not match the block header size");
+static_assert(kLzCordBlockSize < (size_t{1} << 24),
+              "block sizes must fit in 24 bits");
+static_assert(kLzCordBlockSize <= kMaxOffset + 1,
+              "positions within a block must fit in 16 bits");
+
+void Store24(char* p, size_t v) {
+  p[0] = static_cast<char>(v);
+  p[1] = static_cast<char>(v >> 8);
+  p[2] = static_cast<char>(v >> 16);
+}
+
+size_t Load24(const char* p) {
+  return size_t{static_cast<uint8_t>(p[0])} |
+         size_t{static_cast<uint8_t>(p[1])} << 8 |
+         size_t{static_cast<uint8_t>(p[2])} << 16;
+}
+
+void EncodeHeader(char* p, BlockType type, size_t stored_size,
+                  size_t uncompressed_size, uint32_t crc) {
+  p[0] = static_cast<char>(type);
+  Store24(p + 1, stored_size);
+  Store24(p + 4, uncompressed_size);
+  absl::little_endian::Store32(p + 7, crc);
+}
+
+inline uint32_t Hash(uint32_t v) {
+  return (v * 2654435761u) >> (32 - kHashBits);
+}
+
+// Returns the length of the common prefix of `a` and `b`, comparing at most
+// `limit - b` bytes. `a` must precede `b`.
+inline size_t CommonPrefix(const char* a, const char* b,
+                           const char* limit) {
+  const char* const start = b;
+  while (limit - b >= 8) {
+    const uint64_t diff = absl::little_endian::Load64(a) ^
+                          absl::little_endian::Load64(b);
+    if (diff != 0) {
+      return static_cast<size_t>(b - start) +
+             static_cast<size_t>(absl::countr_zero(diff) >> 3);
+    }
+    a += 8;
+    b += 8;
+  }
+  while (b < limit && *a == *b) {
+    ++a;
+    ++b;
+  }
+  return static_cast<size_t>(b - start);
+}
+
+// Writes the extension bytes for a length whose nibble is 15.
+inline char* PutLengthExtension(char* op, size_t len) {
+  for (; len >= 255; len -= 255) *op++ = static_cast<char>(255);
+  *op++ = static_cast<char>(len);
+  return op;
+}
+
+// Appends one sequence to `op`, or returns nullptr if it would pass `end`.
+// A `match_len` of zero writes a final, literals-only sequence.
+char* PutSequence(char* op, const char* end, const char* literals,
+                  size_t literal_len, size_t offset, size_t match_len) {
+  const size_t match_code = match_len == 0 ? 0 : match_len - kMinMatch;
+  // Upper bound of the encoded size.
+  const size_t needed =
+      1 + literal_len / 255 + 1 + literal_len + 2 + match_code / 255 + 1;
+  if (static_cast<size_t>(end - op) < needed) return nullptr;
+  char* token = op++;
+  uint8_t t = 0;
+  if (literal_len >= 15) {
+    t = 15 << 4;
+    op = PutLengthExtension(op, literal_len - 15);
+  } else {
+    t = static_cast<uint8_t>(literal_len << 4);
+  }
+  std::memcpy(op, literals, literal_len);
+  op += literal_len;
+  if (match_len != 0) {
+    absl::little_endian::Store16(op, static_cast<uint16_t>(offset));
+    op += 2;
+    if (match_code >= 15) {
+      t |= 15;
+      op = PutLengthExtension(op, match_code - 15);
+    } else {
+      t |= static_cast<uint8_t>(match_code);
+    }
+  }
+  *token = static_cast<char>(t);
+  return op;
+}
+
+// Compresses `n` bytes at `src` into `dst`, returning the compressed size, or
+// zero if the result would not fit in `capacity` bytes.
+size_t LzCompress(const char* src, size_t n, char* dst, size_t capacity) {
+  uint16_t table[size_t{1} << kHashBits] = {};
+  const char* const base = src;
+  const char* const src_end = src + n;
+  char* op = dst;
+  char* const op_end = dst + capacity;
+  const char* anchor = src;
+  if (n >= kMinMatch + 1) {
+    const char* const match_limit = src_end - kMinMatch;
+    const char* ip = src + 1;
+    while (ip <= match_limit) {
+      const uint32_t v = absl::little_endian::Load32(ip);
+      const uint32_t h = Hash(v);
+      const char* candidate = base + table[h];
+      table[h] = static_cast<uint16_t>(ip - base);
+      if (candidate >= ip || absl::little_endian::Load32(candidate) != v) {
+        // Skip ahead faster the longer no match has been found, which keeps
+        // incompressible input cheap.
+        ip += 1 + (static_cast<size_t>(ip - anchor) >> 6);
+        continue;
+      }
+      // Extend the match backwards over pending literals.
+      while (ip > anchor && candidate > base && ip[-1] == candidate[-1]) {
+        --ip;
+        --candidate;
+      }
+      const size_t len =
+          kMinMatch + CommonPrefix(candidate + kMinMatch, ip + kMinMatch,
+                                   src_end);
+      op = PutSequence(op, op_end, anchor, static_cast<size_t>(ip - anchor),
+                       static_cast<size_t>(ip - candidate), len);
+      if (op == nullptr) return 0;
+      ip += len;
+      anchor = ip;
+      if (ip <= match_limit) {
+        // Index the position just before the new anchor so that runs are
+        // picked up again immediately.
+        table[Hash(absl::little_endian::Load32(ip - 2))] =
+            static_cast<uint16_t>(ip - 2 - base);
+      }
+    }
+  }
+  op = PutSequence(op, op_end, anchor, static_cast<size_t>(src_end - anchor),
+                   0, 0);
+  if (op == nullptr) return 0;
+  return static_cast<size_t>(op - dst);
+}
+
+// Reads a length extension, adding it to `*len`. Returns false if the input
+// ends first or the length exceeds `max_len`.
+inline bool GetLengthExtension(const char*& ip, const char* ip_end,
+                               size_t max_len, size_t* len) {
+  uint8_t b;
+  do {
+    if (ip == ip_end) return false;
+    b = static_cast<uint8_t>(*ip++);
+    *len += b;
+    if (*len > max_len) return false;
+  } while (b == 255);
+  return true;
+}
+
+// Decompresses the `src` payload into exactly `n` bytes at `dst`. Returns
+// false if the payload is malformed; every read and write is bounds checked.
+bool LzDecompress(absl::string_view src, char* dst, size_t n) {
+  const char* ip = src.data();
+  const char* const ip_end = ip + src.size();
+  char* op = dst;
+  char* const op_end = dst + n;
+  while (true) {
+    if (ip == ip_end) return false;
+    const uint8_t token = static_cast<uint8_t>(*ip++);
+    size_t literal_len = token >> 4;
+    if (literal_len == 15 &&
+        !GetLengthExtension(ip, ip_end, n, &literal_len)) {
+      return false;
+    }
+    if (literal_len > static_cast<size_t>(ip_end - ip) ||
+        literal_len > static_cast<size_t>(op_end - op)) {
+      return false;
+    }
+    std::memcpy(op, ip, literal_len);
+    ip += literal_len;
+    op += literal_len;
+    if (op == op_end) return ip == ip_end && (token & 15) == 0;
+
+    if (ip_end - ip < 2) return false;
+    const size_t offset = absl::little_endian::Load16(ip);
+    ip += 2;
+    if (offset == 0 || offset > static_cast<size_t>(op - dst)) return false;
+    size_t match_len = token & 15;
+    if (match_len == 15 && !GetLengthExtension(ip, ip_end, n, &match_len)) {
+      return false;
+    }
+    match_len += kMinMatch;
+    if (match_len > static_cast<size_t>(op_end - op)) return false;
+    const char* match = op - offset;
+    if (offset >= match_len) {
+      std::memcpy(op, match, match_len);
+      op += match_len;
+    } else {
+      // Overlapping copy, which repeats the last `offset` bytes.
+      for (size_t i = 0; i < match_len; ++i) *op++ = match[i];
+    }
+  }
+}
+
+absl::Status CorruptStream(absl::string_view what) {
+  return absl::DataLossError(
+      absl::StrCat("Corrupt LZ Cord stream: ", what));
+}
+
+}  // namespace
+
+void LzCordCompressor::CompressBlock(absl::string_view block,
+                                     CordTransformOutput* absl_nonnull output) {
+  scratch_.resize(kHeaderSize + kLzCordBlockSize);
+  char* payload = &scratch_[kHeaderSize];
+  const uint32_t crc = static_cast<uint32_t>(absl::ComputeCrc32c(block));
+  // Require the compressed form to be strictly smaller than the input.
+  const size_t compressed_size =
+      LzCompress(block.data(), block.size(), payload, block.size() - 1);
+  if (compressed_size != 0) {
+    EncodeHeader(&scratch_[0], kLz, compressed_size, block.size(), crc);
+    output->Append(
+        absl::string_view(scratch_.data(), kHeaderSize + compressed_size));
+  } else {
+    EncodeHeader(&scratch_[0], kRaw, block.size(), block.size(), crc);
+    output->Append(absl::string_view(scratch_.data(), kHeaderSize));
+    output->Append(block);
+  }
+}
+
+absl::Status LzCordCompressor::Update(
+    absl::string_view input, CordTransformOutput* absl_nonnull output) {
+  if (!pending_.empty()) {
+    const size_t n =
+        (std::min)(input.size(), kLzCordBlockSize - pending_.size());
+    pending_.append(input.data(), n);
+    input.remove_prefix(n);
+    if (pending_.size() < kLzCordBlockSize) return absl::OkStatus();
+    CompressBlock(pending_, output);
+    pending_.clear();
+  }
+  // Whole blocks are compressed straight from the input without copying.
+  while (input.size() >= kLzCordBlockSize) {
+    CompressBlock(input.substr(0, kLzCordBlockSize), output);
+    input.remove_prefix(kLzCordBlockSize);
+  }
+  if (!input.empty()) {
+    pending_.reserve(kLzCordBlockSize);
+    pending_.append(input.data(), input.size());
+  }
+  return absl::OkStatus();
+}
+
+absl::Status LzCordCompressor::Finish(
+    CordTransformOutput* absl_nonnull output) {
+  if (!pending_.empty()) {
+    CompressBlock(pending_, output);
+    pending_.clear();
+  }
+  char end[kHeaderSize];
+  EncodeHeader(end, kEnd, 0, 0, 0);
+  output->Append(absl::string_view(end, kHeaderSize));
+  return absl::OkStatus();
+}
+
+void LzCordDecompressor::Reset() {
+  header_size_ = 0;
+  pending_.clear();
+  done_ = false;
+  status_ = absl::OkStatus();
+}
+
+absl::Status LzCordDecompressor::DecodeBlock(
+    absl::string_view payload, CordTransformOutput* absl_nonnull output) {
+  const BlockType type = static_cast<BlockType>(header_[0]);
+  const size_t size = Load24(header_ + 4);
+  const uint32_t crc = absl::little_endian::Load32(header_ + 7);
+  absl::string_view data = payload;
+  if (type == kLz) {
+    // Decode straight into the memory that becomes part of the output Cord.
+    absl::Span<char> buf = output->GetAppendBuffer(size);
+    if (!LzDecompress(payload, buf.data(), size)) {
+      return CorruptStream("invalid compressed block");
+    }
+    data = absl::string_view(buf.data(), size);
+  }
+  if (static_cast<uint32_t>(absl::ComputeCrc32c(data)) != crc) {
+    return CorruptStream("checksum mismatch");
+  }
+  if (type == kLz) {
+    output->Commit(size);
+  } else {
+    output->Append(data);
+  }
+  header_size_ = 0;
+  return absl::OkStatus();
+}
+
+absl::Status LzCordDecompressor::Update(
+    absl::string_view input, CordTransformOutput* absl_nonnull output) {
+  if (!status_.ok()) return status_;
+  while (!input.empty()) {
+    if (done_) {
+      status_ = CorruptStream("trailing data after end of stream");
+      return status_;
+    }
+    if (header_size_ < kHeaderSize) {
+      const size_t n = (std::min)(input.size(), kHeaderSize - header_size_);
+      std::memcpy(header_ + header_size_, input.data(), n);
+      header_size_ += n;
+      input.remove_prefix(n);
+      if (header_size_ < kHeaderSize) break;
+      const uint8_t type = static_cast<uint8_t>(header_[0]);
+      const size_t stored = Load24(header_ + 1);
+      const size_t size = Load24(header_ + 4);
+      bool valid;
+      switch (type) {
+        case kEnd:
+          valid = stored == 0 && size == 0 &&
+                  absl::little_endian::Load32(header_ + 7) == 0;
+          done_ = true;
+          break;
+        case kRaw:
+          valid = size != 0 && size <= kLzCordBlockSize && stored == size;
+          break;
+        case kLz:
+          valid = size <= kLzCordBlockSize && stored != 0 && stored < size;
+          break;
+        default:
+          valid = false;
+          break;
+      }
+      if (!valid) {
+        status_ = CorruptStream("invalid block header");
+        return status_;
+      }
+      continue;
+    }
+    const size_t stored = Load24(header_ + 1);
+    if (pending_.empty() && input.size() >= stored) {
+      status_ = DecodeBlock(input.substr(0, stored), output);
+      input.remove_prefix(stored);
+    } else {
+      const size_t n = (std::min)(input.size(), stored - pending_.size());
+      pending_.append(input.data(), n);
+      input.remove_prefix(n);
+      if (pending_.size() < stored) break;
+      status_ = DecodeBlock(pending_, output);
+      pending_.clear();
+    }
+    if (!status_.ok()) return status_;
+  }
+  return absl::OkStatus();
+}
+
+absl::Status LzCordDecompressor::Finish(
+    CordTransformOutput* absl_nonnull output) {
+  static_cast<void>(output);
+  absl::Status status = status_;
+  if (status.ok() && !done_) status = CorruptStream("truncated stream");
+  Reset();
+  return status;
+}
+
+absl::StatusOr<absl::Cord> LzCompressCord(const absl::Cord& src) {
+  absl::Cord dest;
+  LzCordCompressor compressor;
+  absl::Status status = TransformCord(src, &compressor, &dest);
+  if (!status.ok()) return status;
+  return dest;
+}
+
+absl::StatusOr<absl::Cord> LzDecompressCord(const absl::Cord& src) {
+  absl::Cord dest;
+  LzCordDecompressor decompressor;
+  absl::Status status = TransformCord(src, &decompressor, &dest);
+  if (!status.ok()) return status;
+  return dest;
+}
+
+ABSL_NAMESPACE_END
+}  // namespace absl
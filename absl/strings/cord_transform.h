@@ -0,0 +1,235 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// -----------------------------------------------------------------------------
+// File: cord_transform.h
+// -----------------------------------------------------------------------------
+//
+// This header file defines a streaming interface for transforming the contents
+// of an `absl::Cord` chunk by chunk, such as compressing or decompressing it,
+// together with a built-in block-based LZ compression codec.
+//
+// A `CordTransform` consumes its input as a sequence of contiguous pieces of
+// arbitrary size, so a (possibly highly fragmented) Cord can be fed to it one
+// chunk at a time without first being flattened. Output is written through a
+// `CordTransformOutput`, which hands out writable memory backed by
+// `absl::CordBuffer`s that are appended to the destination Cord without an
+// extra copy.
+//
+// Codecs other than the built-in one (for example zstd or snappy stream
+// wrappers) plug in by implementing `CordTransform`:
+//
+//   class ZstdCordCompressor : public absl::CordTransform {
+//    public:
+//     absl::Status Update(absl::string_view input,
+//                         absl::CordTransformOutput* output) override {
+//       // Call ZSTD_compressStream2() writing into
+//       // output->GetAppendBuffer(ZSTD_CStreamOutSize()), then Commit().
+//     }
+//     absl::Status Finish(absl::CordTransformOutput* output) override;
+//   };
+//
+//   absl::Cord compressed;
+//   ZstdCordCompressor compressor;
+//   absl::Status s = absl::TransformCord(payload, &compressor, &compressed);
+//
+// The built-in codec splits its input into independent blocks of at most
+// `kLzCordBlockSize` bytes, so both directions use a bounded amount of memory
+// regardless of the size of the stream, and every block carries a CRC32C of its
+// uncompressed contents.
+//
+// Example:
+//
+//   absl::StatusOr<absl::Cord> compressed = absl::LzCompressCord(payload);
+//   ...
+//   absl::StatusOr<absl::Cord> restored = absl::LzDecompressCord(*compressed);
+
+#ifndef ABSL_STRINGS_CORD_TRANSFORM_H_
+#define ABSL_STRINGS_CORD_TRANSFORM_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "absl/base/config.h"
+#include "absl/base/nullability.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/cord.h"
+#include "absl/strings/cord_buffer.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+// CordTransformOutput
+//
+// The output side of a `CordTransform`. Bytes are either written directly into
+// memory obtained from `GetAppendBuffer()` and then committed, or copied in
+// with `Append()`. Output is added to the destination Cord in `CordBuffer`
+// sized pieces; `Flush()` (or destruction) appends anything still pending.
+//
+// Example:
+//
+//   absl::Span<char> buf = output->GetAppendBuffer(bound);
+//   size_t n = EncodeInto(buf.data(), buf.size());
+//   output->Commit(n);
+class CordTransformOutput {
+ public:
+  // The largest `min_size` that `GetAppendBuffer()` accepts.
+  static constexpr size_t kMaxAppendBufferSize =
+      CordBuffer::MaximumPayload(CordBuffer::kCustomLimit);
+
+  explicit CordTransformOutput(absl::Cord* absl_nonnull dest) : dest_(dest) {}
+
+  CordTransformOutput(const CordTransformOutput&) = delete;
+  CordTransformOutput& operator=(const CordTransformOutput&) = delete;
+
+  ~CordTransformOutput() { Flush(); }
+
+  // CordTransformOutput::GetAppendBuffer()
+  //
+  // Returns contiguous writable memory of at least `min_size` bytes, which
+  // must not exceed `kMaxAppendBufferSize`. The memory remains valid until the
+  // next call to any non-const method. Bytes written to it become part of the
+  // output only once passed to `Commit()`.
+  absl::Span<char> GetAppendBuffer(size_t min_size);
+
+  // CordTransformOutput::Commit()
+  //
+  // Adds the first `n` bytes of the memory returned by the last call to
+  // `GetAppendBuffer()` to the output.
+  void Commit(size_t n) { buffer_.IncreaseLengthBy(n); }
+
+  // CordTransformOutput::Append()
+  //
+  // Copies `data` to the output.
+  void Append(absl::string_view data);
+
+  // CordTransformOutput::Flush()
+  //
+  // Appends all committed output to the destination Cord.
+  void Flush();
+
+ private:
+  absl::Cord* absl_nonnull dest_;
+  CordBuffer buffer_;
+};
+
+// CordTransform
+//
+// Abstract interface for a streaming transformation of a byte sequence, such
+// as a compressor or decompressor. A transform is driven by any number of
+// calls to `Update()` followed by a single call to `Finish()`, after which the
+// transform is reset and may be used for a new stream. Once a call returns a
+// non-OK status, the stream is broken and further calls before the reset
+// return an error.
+class CordTransform {
+ public:
+  virtual ~CordTransform() = default;
+
+  // CordTransform::Update()
+  //
+  // Consumes `input`, which may have any length including zero, and writes
+  // any output that can be produced so far to `output`. The transform must
+  // not retain `input` after returning.
+  virtual absl::Status Update(absl::string_view input,
+                              CordTransformOutput* absl_nonnull output) = 0;
+
+  // CordTransform::Finish()
+  //
+  // Signals the end of the input and writes the remaining output.
+  virtual absl::Status Finish(CordTransformOutput* absl_nonnull output) = 0;
+};
+
+// TransformCord()
+//
+// Feeds each chunk of `src` through `transform`, finishes the stream, and
+// appends the output to `dest`. On error, `dest` may contain partial output.
+absl::Status TransformCord(const absl::Cord& src,
+                           CordTransform* absl_nonnull transform,
+                           absl::Cord* absl_nonnull dest);
+
+// The maximum number of uncompressed bytes in one block of the built-in LZ
+// codec. Each direction buffers at most one block of input. A block plus its
+// 11-byte header fits in a single `CordBuffer`.
+inline constexpr size_t kLzCordBlockSize =
+    CordTransformOutput::kMaxAppendBufferSize - 11;
+
+// LzCordCompressor
+//
+// A `CordTransform` that compresses its input with a fast byte-oriented LZ77
+// codec similar to LZ4. Blocks that do not compress are stored verbatim, so
+// incompressible input grows by only a few bytes per block.
+class LzCordCompressor final : public CordTransform {
+ public:
+  LzCordCompressor() = default;
+
+  absl::Status Update(absl::string_view input,
+                      CordTransformOutput* absl_nonnull output) override;
+  absl::Status Finish(CordTransformOutput* absl_nonnull output) override;
+
+ private:
+  void CompressBlock(absl::string_view block,
+                     CordTransformOutput* absl_nonnull output);
+
+  // Input that does not yet fill a whole block.
+  std::string pending_;
+  // Holds one compressed block so that output is packed densely into the
+  // destination Cord instead of leaving a partly used buffer per block.
+  std::string scratch_;
+};
+
+// LzCordDecompressor
+//
+// A `CordTransform` that reverses `LzCordCompressor`. Returns
+// `absl::StatusCode::kDataLoss` if the input is malformed, fails a checksum or
+// is truncated.
+class LzCordDecompressor final : public CordTransform {
+ public:
+  LzCordDecompressor() = default;
+
+  absl::Status Update(absl::string_view input,
+                      CordTransformOutput* absl_nonnull output) override;
+  absl::Status Finish(CordTransformOutput* absl_nonnull output) override;
+
+ private:
+  absl::Status DecodeBlock(absl::string_view payload,
+                           CordTransformOutput* absl_nonnull output);
+  void Reset();
+
+  // Bytes of the current block header received so far.
+  char header_[11];
+  size_t header_size_ = 0;
+  // Payload of the current block when it spans several `Update()` calls.
+  std::string pending_;
+  bool done_ = false;
+  absl::Status status_;
+};
+
+// LzCompressCord()
+//
+// Returns `src` compressed with `LzCordCompressor`.
+absl::StatusOr<absl::Cord> LzCompressCord(const absl::Cord& src);
+
+// LzDecompressCord()
+//
+// Returns `src` decompressed with `LzCordDecompressor`.
+absl::StatusOr<absl::Cord> LzDecompressCord(const absl::Cord& src);
+
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_STRINGS_CORD_TRANSFORM_H_
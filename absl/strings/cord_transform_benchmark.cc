@@ -0,0 +1,91 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "absl/profiling/benchmark.h"
+#include "absl/strings/cord.h"
+#include "absl/strings/cord_test_helpers.h"
+#include "absl/strings/cord_transform.h"
+
+namespace {
+
+constexpr size_t kSize = 4 << 20;
+
+std::string MakeText(size_t size) {
+  static const char* const kWords[] = {
+      "request ", "status ", "200 ", "404 ", "GET ",  "POST ", "/index.html ",
+      "user-agent ", "latency_ms=", "17 ", "3 ", "\n"};
+  std::minstd_rand rng(1);
+  std::string s;
+  while (s.size() < size) {
+    s += kWords[rng() % (sizeof(kWords) / sizeof(*kWords))];
+  }
+  s.resize(size);
+  return s;
+}
+
+// Returns `data` as a flat Cord when `fragment_size` is zero, and otherwise as
+// a Cord made of `fragment_size`-byte pieces.
+absl::Cord MakeInput(const std::string& data, size_t fragment_size) {
+  if (fragment_size == 0) return absl::Cord(data);
+  std::vector<std::string> pieces;
+  for (size_t i = 0; i < data.size(); i += fragment_size) {
+    pieces.push_back(data.substr(i, fragment_size));
+  }
+  return absl::MakeFragmentedCord(pieces);
+}
+
+void BM_LzCompressCord(benchmark::State& state) {
+  const absl::Cord src = MakeInput(MakeText(kSize), state.range(0));
+  for (auto _ : state) {
+    absl::Cord compressed = *absl::LzCompressCord(src);
+    benchmark::DoNotOptimize(compressed);
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(src.size()));
+}
+BENCHMARK(BM_LzCompressCord)->Arg(0)->Arg(64)->Arg(4096);
+
+void BM_LzDecompressCord(benchmark::State& state) {
+  const std::string text = MakeText(kSize);
+  const absl::Cord compressed = MakeInput(
+      std::string(*absl::LzCompressCord(absl::Cord(text))), state.range(0));
+  for (auto _ : state) {
+    absl::Cord restored = *absl::LzDecompressCord(compressed);
+    benchmark::DoNotOptimize(restored);
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(text.size()));
+}
+BENCHMARK(BM_LzDecompressCord)->Arg(0)->Arg(64)->Arg(4096);
+
+// Baseline: the cost of flattening a fragmented Cord, which a codec that
+// requires contiguous input would pay before compressing.
+void BM_FlattenCord(benchmark::State& state) {
+  const absl::Cord src = MakeInput(MakeText(kSize), state.range(0));
+  for (auto _ : state) {
+    absl::Cord copy = src;
+    benchmark::DoNotOptimize(copy.Flatten());
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(src.size()));
+}
+BENCHMARK(BM_FlattenCord)->Arg(64)->Arg(4096);
+
+}  // namespace
@@ -0,0 +1,246 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/strings/cord_transform.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/cord.h"
+#include "absl/strings/cord_test_helpers.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+
+namespace {
+
+// Returns `size` bytes of text-like data with plenty of repetition.
+std::string CompressibleData(size_t size, uint32_t seed = 1) {
+  static const char* const kWords[] = {
+      "the ",   "quick ", "brown ",  "fox ",   "jumps ",   "over ",
+      "lazy ",  "dog ",   "absl::", "Cord ",  "transform ", "\n"};
+  std::minstd_rand rng(seed);
+  std::string s;
+  while (s.size() < size) s += kWords[rng() % (sizeof(kWords) / sizeof(*kWords))];
+  s.resize(size);
+  return s;
+}
+
+std::string RandomData(size_t size, uint32_t seed = 1) {
+  std::minstd_rand rng(seed);
+  std::string s(size, '\0');
+  for (char& c : s) c = static_cast<char>(rng());
+  return s;
+}
+
+// Splits `s` into pieces of `piece_size` bytes (the last may be shorter).
+std::vector<std::string> Split(absl::string_view s, size_t piece_size) {
+  std::vector<std::string> pieces;
+  for (size_t i = 0; i < s.size(); i += piece_size) {
+    pieces.emplace_back(s.substr(i, piece_size));
+  }
+  return pieces;
+}
+
+absl::Cord RoundTrip(const absl::Cord& src) {
+  absl::StatusOr<absl::Cord> compressed = absl::LzCompressCord(src);
+  EXPECT_TRUE(compressed.ok()) << compressed.status();
+  absl::StatusOr<absl::Cord> restored = absl::LzDecompressCord(*compressed);
+  EXPECT_TRUE(restored.ok()) << restored.status();
+  return restored.ok() ? *restored : absl::Cord();
+}
+
+TEST(CordTransformOutput, AppendAndCommit) {
+  absl::Cord dest("prefix:");
+  {
+    absl::CordTransformOutput output(&dest);
+    output.Append("abc");
+    absl::Span<char> buf = output.GetAppendBuffer(3);
+    ASSERT_GE(buf.size(), 3u);
+    buf[0] = 'x';
+    buf[1] = 'y';
+    output.Commit(2);
+    const std::string big(100000, 'z');
+    output.Append(big);
+    buf = output.GetAppendBuffer(
+        absl::CordTransformOutput::kMaxAppendBufferSize);
+    EXPECT_GE(buf.size(), absl::CordTransformOutput::kMaxAppendBufferSize);
+    output.Commit(0);
+  }
+  EXPECT_EQ(dest, absl::StrCat("prefix:abcxy", std::string(100000, 'z')));
+}
+
+TEST(LzCord, RoundTripSizes) {
+  for (size_t size :
+       {size_t{0}, size_t{1}, size_t{4}, size_t{5}, size_t{17}, size_t{1000},
+        absl::kLzCordBlockSize - 1, absl::kLzCordBlockSize,
+        absl::kLzCordBlockSize + 1, size_t{3} * absl::kLzCordBlockSize + 7}) {
+    SCOPED_TRACE(size);
+    const absl::Cord text(CompressibleData(size));
+    EXPECT_EQ(RoundTrip(text), text);
+    const absl::Cord noise(RandomData(size));
+    EXPECT_EQ(RoundTrip(noise), noise);
+  }
+}
+
+TEST(LzCord, CompressesRepetitiveData) {
+  const absl::Cord text(CompressibleData(1 << 20));
+  absl::StatusOr<absl::Cord> compressed = absl::LzCompressCord(text);
+  ASSERT_TRUE(compressed.ok());
+  EXPECT_LT(compressed->size(), text.size() / 2);
+
+  const absl::Cord zeros(std::string(1 << 20, '\0'));
+  compressed = absl::LzCompressCord(zeros);
+  ASSERT_TRUE(compressed.ok());
+  EXPECT_LT(compressed->size(), zeros.size() / 100);
+  EXPECT_EQ(RoundTrip(zeros), zeros);
+}
+
+TEST(LzCord, IncompressibleDataGrowsLittle) {
+  const absl::Cord noise(RandomData(1 << 20));
+  absl::StatusOr<absl::Cord> compressed = absl::LzCompressCord(noise);
+  ASSERT_TRUE(compressed.ok());
+  EXPECT_LE(compressed->size(), noise.size() + noise.size() / 1000 + 64);
+}
+
+TEST(LzCord, FragmentedInputMatchesFlatInput) {
+  const std::string data = CompressibleData(300000, 7);
+  const absl::Cord flat(data);
+  absl::StatusOr<absl::Cord> expected = absl::LzCompressCord(flat);
+  ASSERT_TRUE(expected.ok());
+  for (size_t piece : {1, 7, 100, 4096, 70000}) {
+    SCOPED_TRACE(piece);
+    const absl::Cord fragmented = absl::MakeFragmentedCord(Split(data, piece));
+    absl::StatusOr<absl::Cord> compressed = absl::LzCompressCord(fragmented);
+    ASSERT_TRUE(compressed.ok());
+    // Block boundaries do not depend on how the input is fragmented.
+    EXPECT_EQ(*compressed, *expected);
+
+    const absl::Cord fragmented_compressed =
+        absl::MakeFragmentedCord(Split(std::string(*compressed), piece));
+    absl::StatusOr<absl::Cord> restored =
+        absl::LzDecompressCord(fragmented_compressed);
+    ASSERT_TRUE(restored.ok()) << restored.status();
+    EXPECT_EQ(*restored, flat);
+  }
+}
+
+TEST(LzCord, TransformIsReusable) {
+  absl::LzCordCompressor compressor;
+  absl::LzCordDecompressor decompressor;
+  for (uint32_t seed = 1; seed <= 3; ++seed) {
+    const absl::Cord src(CompressibleData(100000 * seed, seed));
+    absl::Cord compressed;
+    ASSERT_TRUE(absl::TransformCord(src, &compressor, &compressed).ok());
+    absl::Cord restored;
+    ASSERT_TRUE(absl::TransformCord(compressed, &decompressor, &restored).ok());
+    EXPECT_EQ(restored, src);
+  }
+}
+
+TEST(LzCord, DetectsTruncation) {
+  const std::string compressed =
+      std::string(*absl::LzCompressCord(absl::Cord(CompressibleData(200000))));
+  for (size_t len : {size_t{0}, size_t{5}, size_t{11}, size_t{100},
+                     compressed.size() / 2, compressed.size() - 1}) {
+    SCOPED_TRACE(len);
+    absl::StatusOr<absl::Cord> restored =
+        absl::LzDecompressCord(absl::Cord(compressed.substr(0, len)));
+    EXPECT_EQ(restored.status().code(), absl::StatusCode::kDataLoss);
+  }
+}
+
+TEST(LzCord, DetectsCorruption) {
+  const absl::Cord src(CompressibleData(200000));
+  const std::string compressed = std::string(*absl::LzCompressCord(src));
+  std::minstd_rand rng(42);
+  for (int i = 0; i < 500; ++i) {
+    std::string corrupt = compressed;
+    corrupt[rng() % corrupt.size()] ^= static_cast<char>(1 + rng() % 255);
+    absl::StatusOr<absl::Cord> restored =
+        absl::LzDecompressCord(absl::Cord(corrupt));
+    // A changed match offset may still point at identical bytes, which
+    // decodes to the original data.
+    if (restored.ok()) {
+      EXPECT_EQ(*restored, src);
+    } else {
+      EXPECT_EQ(restored.status().code(), absl::StatusCode::kDataLoss);
+    }
+  }
+
+  absl::StatusOr<absl::Cord> restored =
+      absl::LzDecompressCord(absl::Cord(compressed + "x"));
+  EXPECT_EQ(restored.status().code(), absl::StatusCode::kDataLoss);
+}
+
+TEST(LzCord, ErrorsAreSticky) {
+  absl::LzCordDecompressor decompressor;
+  absl::Cord dest;
+  absl::CordTransformOutput output(&dest);
+  EXPECT_FALSE(decompressor.Update(std::string(11, '\x7f'), &output).ok());
+  EXPECT_FALSE(decompressor.Update("", &output).ok());
+  EXPECT_FALSE(decompressor.Finish(&output).ok());
+  // Finish() resets the decompressor for a new stream.
+  const std::string compressed =
+      std::string(*absl::LzCompressCord(absl::Cord("hello")));
+  EXPECT_TRUE(decompressor.Update(compressed, &output).ok());
+  EXPECT_TRUE(decompressor.Finish(&output).ok());
+  output.Flush();
+  EXPECT_EQ(dest, "hello");
+}
+
+// A user-defined transform plugs into `TransformCord()` like the built-in
+// codec does.
+class Rot13 : public absl::CordTransform {
+ public:
+  absl::Status Update(absl::string_view input,
+                      absl::CordTransformOutput* output) override {
+    while (!input.empty()) {
+      const size_t n =
+          std::min(input.size(), absl::CordTransformOutput::kMaxAppendBufferSize);
+      absl::Span<char> buf = output->GetAppendBuffer(n);
+      for (size_t i = 0; i < n; ++i) {
+        char c = input[i];
+        if (c >= 'a' && c <= 'z') c = static_cast<char>('a' + (c - 'a' + 13) % 26);
+        buf[i] = c;
+      }
+      output->Commit(n);
+      input.remove_prefix(n);
+    }
+    return absl::OkStatus();
+  }
+  absl::Status Finish(absl::CordTransformOutput*) override {
+    return absl::OkStatus();
+  }
+};
+
+TEST(CordTransform, CustomTransform) {
+  Rot13 rot13;
+  absl::Cord dest;
+  ASSERT_TRUE(absl::TransformCord(
+                  absl::MakeFragmentedCord({"hello ", "cord ", "world"}),
+                  &rot13, &dest)
+                  .ok());
+  EXPECT_EQ(dest, "uryyb pbeq jbeyq");
+}
+
+}  // namespace
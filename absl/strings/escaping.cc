@@ -32,6 +32,7 @@
 #include "absl/strings/ascii.h"
 #include "absl/strings/charset.h"
 #include "absl/strings/internal/escaping.h"
+#include "absl/strings/internal/escaping_simd.h"
 #include "absl/strings/internal/resize_uninitialized.h"
 #include "absl/strings/internal/utf8.h"
 #include "absl/strings/numbers.h"
@@ -464,6 +465,7 @@ void CEscapeAndAppendInternal(absl::string_view src,
 bool Base64UnescapeInternal(const char* absl_nullable src_param, size_t szsrc,
                             char* absl_nullable dest, size_t szdest,
                             const std::array<signed char, 256>& unbase64,
+                            const char* absl_nonnull base64_chars,
                             size_t* absl_nonnull len) {
   static const char kPad64Equals = '=';
   static const char kPad64Dot = '.';
@@ -507,8 +509,24 @@ bool Base64UnescapeInternal(const char* absl_nullable src_param, size_t szsrc,
     // data left in the string for a full iteration, so the loop may
     // break out in the middle; if so 'state' will be set to the
     // number of input bytes read.
+    //
+    // Runs of clean input are first handed to the vector kernel, which stops
+    // at the first block containing whitespace, padding or an invalid
+    // character. The scalar code below then handles at least one group
+    // before the kernel is tried again.
 
+    bool try_simd = true;
     while (szsrc >= 4) {
+      if (try_simd) {
+        try_simd = false;
+        const size_t consumed = strings_internal::Base64UnescapeSimd(
+            src, szsrc, dest + destidx, szdest - destidx, base64_chars);
+        src += consumed;
+        szsrc -= consumed;
+        destidx += consumed / 4 * 3;
+        if (szsrc < 4) break;
+      }
+
       // We'll start by optimistically assuming that the next four
       // bytes of the string (src[0..3]) are four good data bytes
       // (that is, no nulls, whitespace, padding chars, or illegal
@@ -538,6 +556,7 @@ bool Base64UnescapeInternal(const char* absl_nullable src_param, size_t szsrc,
         temp = (temp << 6) | static_cast<unsigned char>(decode);
         GET_INPUT(fourth, 1);
         temp = (temp << 6) | static_cast<unsigned char>(decode);
+        try_simd = true;
       } else {
         // We really did have four good data bytes, so advance four
         // characters in the string.
@@ -799,33 +818,49 @@ constexpr std::array<signed char, 256> kUnWebSafeBase64 = {
 };
 /* clang-format on */
 
+// Decodes `src` and appends the result to `dest`. On failure, `dest` is
+// restored to its original size.
 template <typename String>
-bool Base64UnescapeInternal(const char* absl_nullable src, size_t slen,
-                            String* absl_nonnull dest,
-                            const std::array<signed char, 256>& unbase64) {
+bool Base64UnescapeAndAppendInternal(
+    const char* absl_nullable src, size_t slen, String* absl_nonnull dest,
+    const std::array<signed char, 256>& unbase64,
+    const char* absl_nonnull base64_chars) {
   // Determine the size of the output string.  Base64 encodes every 3 bytes into
   // 4 characters.  Any leftover chars are added directly for good measure.
   const size_t dest_len = 3 * (slen / 4) + (slen % 4);
+  const size_t orig_size = dest->size();
 
-  strings_internal::STLStringResizeUninitialized(dest, dest_len);
+  strings_internal::STLStringResizeUninitializedAmortized(dest,
+                                                          orig_size + dest_len);
 
   // We are getting the destination buffer by getting the beginning of the
   // string and converting it into a char *.
   size_t len;
-  const bool ok =
-      Base64UnescapeInternal(src, slen, &(*dest)[0], dest_len, unbase64, &len);
+  const bool ok = Base64UnescapeInternal(src, slen, &(*dest)[0] + orig_size,
+                                         dest_len, unbase64, base64_chars,
+                                         &len);
   if (!ok) {
-    dest->clear();
+    dest->erase(orig_size);
     return false;
   }
 
   // could be shorter if there was padding
   assert(len <= dest_len);
-  dest->erase(len);
+  dest->erase(orig_size + len);
 
   return true;
 }
 
+template <typename String>
+bool Base64UnescapeInternal(const char* absl_nullable src, size_t slen,
+                            String* absl_nonnull dest,
+                            const std::array<signed char, 256>& unbase64,
+                            const char* absl_nonnull base64_chars) {
+  dest->clear();
+  return Base64UnescapeAndAppendInternal(src, slen, dest, unbase64,
+                                         base64_chars);
+}
+
 /* clang-format off */
 constexpr std::array<char, 256> kHexValueLenient = {
     0,  0,  0,  0,  0,  0,  0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -884,7 +919,11 @@ template <typename T>
 void BytesToHexStringInternal(const unsigned char* absl_nullable src, T dest,
                               size_t num) {
   auto dest_ptr = &dest[0];
-  for (auto src_ptr = src; src_ptr != (src + num); ++src_ptr, dest_ptr += 2) {
+  const size_t simd_consumed = strings_internal::BytesToHexSimd(
+      src, num, dest_ptr);
+  dest_ptr += 2 * simd_consumed;
+  for (auto src_ptr = src + simd_consumed; src_ptr != (src + num);
+       ++src_ptr, dest_ptr += 2) {
     const char* hex_p = &numbers_internal::kHexTable[*src_ptr * 2];
     std::copy(hex_p, hex_p + 2, dest_ptr);
   }
@@ -921,12 +960,28 @@ std::string Utf8SafeCHexEscape(absl::string_view src) {
 }
 
 bool Base64Unescape(absl::string_view src, std::string* absl_nonnull dest) {
-  return Base64UnescapeInternal(src.data(), src.size(), dest, kUnBase64);
+  return Base64UnescapeInternal(src.data(), src.size(), dest, kUnBase64,
+                                strings_internal::kBase64Chars);
 }
 
 bool WebSafeBase64Unescape(absl::string_view src,
                            std::string* absl_nonnull dest) {
-  return Base64UnescapeInternal(src.data(), src.size(), dest, kUnWebSafeBase64);
+  return Base64UnescapeInternal(src.data(), src.size(), dest, kUnWebSafeBase64,
+                                strings_internal::kWebSafeBase64Chars);
+}
+
+bool Base64UnescapeAndAppend(absl::string_view src,
+                             std::string* absl_nonnull dest) {
+  return Base64UnescapeAndAppendInternal(src.data(), src.size(), dest,
+                                         kUnBase64,
+                                         strings_internal::kBase64Chars);
+}
+
+bool WebSafeBase64UnescapeAndAppend(absl::string_view src,
+                                    std::string* absl_nonnull dest) {
+  return Base64UnescapeAndAppendInternal(
+      src.data(), src.size(), dest, kUnWebSafeBase64,
+      strings_internal::kWebSafeBase64Chars);
 }
 
 void Base64Escape(absl::string_view src, std::string* absl_nonnull dest) {
@@ -958,28 +1013,51 @@ std::string WebSafeBase64Escape(absl::string_view src) {
   return dest;
 }
 
+void Base64EscapeAndAppend(absl::string_view src,
+                           std::string* absl_nonnull dest) {
+  strings_internal::Base64EscapeAndAppendInternal(
+      reinterpret_cast<const unsigned char*>(src.data()), src.size(), dest,
+      true, strings_internal::kBase64Chars);
+}
+
+void WebSafeBase64EscapeAndAppend(absl::string_view src,
+                                  std::string* absl_nonnull dest) {
+  strings_internal::Base64EscapeAndAppendInternal(
+      reinterpret_cast<const unsigned char*>(src.data()), src.size(), dest,
+      false, strings_internal::kWebSafeBase64Chars);
+}
+
 bool HexStringToBytes(absl::string_view hex, std::string* absl_nonnull bytes) {
   std::string output;
+  if (!HexStringToBytesAndAppend(hex, &output)) return false;
+  *bytes = std::move(output);
+  return true;
+}
 
+bool HexStringToBytesAndAppend(absl::string_view hex,
+                               std::string* absl_nonnull bytes) {
   size_t num_bytes = hex.size() / 2;
   if (hex.size() != num_bytes * 2) {
     return false;
   }
 
-  absl::strings_internal::STLStringResizeUninitialized(&output, num_bytes);
-  auto hex_p = hex.cbegin();
-  for (std::string::iterator bin_p = output.begin(); bin_p != output.end();
-       ++bin_p) {
-    int h1 = absl::kHexValueStrict[static_cast<size_t>(*hex_p++)];
-    int h2 = absl::kHexValueStrict[static_cast<size_t>(*hex_p++)];
+  const size_t orig_size = bytes->size();
+  absl::strings_internal::STLStringResizeUninitializedAmortized(
+      bytes, orig_size + num_bytes);
+  char* const out = &(*bytes)[0] + orig_size;
+  // The vector kernel stops at the first block containing a non-hex
+  // character; the scalar loop below finishes the job and detects the error.
+  const size_t simd_bytes =
+      strings_internal::HexToBytesSimd(hex.data(), num_bytes, out);
+  for (size_t i = simd_bytes; i < num_bytes; ++i) {
+    int h1 = absl::kHexValueStrict[static_cast<unsigned char>(hex[2 * i])];
+    int h2 = absl::kHexValueStrict[static_cast<unsigned char>(hex[2 * i + 1])];
     if (h1 == -1 || h2 == -1) {
-      output.resize(static_cast<size_t>(bin_p - output.begin()));
+      bytes->erase(orig_size);
       return false;
     }
-    *bin_p = static_cast<char>((h1 << 4) + h2);
+    out[i] = static_cast<char>((h1 << 4) + h2);
   }
-
-  *bytes = std::move(output);
   return true;
 }
 
@@ -999,5 +1077,15 @@ std::string BytesToHexString(absl::string_view from) {
   return result;
 }
 
+void BytesToHexStringAndAppend(absl::string_view from,
+                               std::string* absl_nonnull dest) {
+  const size_t orig_size = dest->size();
+  strings_internal::STLStringResizeUninitializedAmortized(
+      dest, orig_size + 2 * from.size());
+  absl::BytesToHexStringInternal<char*>(
+      reinterpret_cast<const unsigned char*>(from.data()),
+      &(*dest)[0] + orig_size, from.size());
+}
+
 ABSL_NAMESPACE_END
 }  // namespace absl
@@ -137,6 +137,17 @@ std::string Base64Escape(absl::string_view src);
 void WebSafeBase64Escape(absl::string_view src, std::string* absl_nonnull dest);
 std::string WebSafeBase64Escape(absl::string_view src);
 
+// Base64EscapeAndAppend()
+// WebSafeBase64EscapeAndAppend()
+//
+// Like `Base64Escape()` and `WebSafeBase64Escape()`, but append the encoding to
+// the existing contents of `dest` instead of replacing them. Appending into a
+// reused buffer avoids a reallocation per call.
+void Base64EscapeAndAppend(absl::string_view src,
+                           std::string* absl_nonnull dest);
+void WebSafeBase64EscapeAndAppend(absl::string_view src,
+                                  std::string* absl_nonnull dest);
+
 // Base64Unescape()
 //
 // Converts a `src` string encoded in Base64 (RFC 4648 section 4) to its binary
@@ -156,6 +167,17 @@ bool Base64Unescape(absl::string_view src, std::string* absl_nonnull dest);
 bool WebSafeBase64Unescape(absl::string_view src,
                            std::string* absl_nonnull dest);
 
+// Base64UnescapeAndAppend()
+// WebSafeBase64UnescapeAndAppend()
+//
+// Like `Base64Unescape()` and `WebSafeBase64Unescape()`, but append the decoded
+// bytes to the existing contents of `dest`. On failure, returns `false` and
+// leaves `dest` unchanged.
+bool Base64UnescapeAndAppend(absl::string_view src,
+                             std::string* absl_nonnull dest);
+bool WebSafeBase64UnescapeAndAppend(absl::string_view src,
+                                    std::string* absl_nonnull dest);
+
 // HexStringToBytes()
 //
 // Converts the hexadecimal encoded data in `hex` into raw bytes in the `bytes`
@@ -165,6 +187,13 @@ bool WebSafeBase64Unescape(absl::string_view src,
 [[nodiscard]] bool HexStringToBytes(absl::string_view hex,
                                     std::string* absl_nonnull bytes);
 
+// HexStringToBytesAndAppend()
+//
+// Like `HexStringToBytes()`, but appends the raw bytes to the existing contents
+// of `bytes`. On failure, returns `false` and leaves `bytes` unchanged.
+[[nodiscard]] bool HexStringToBytesAndAppend(absl::string_view hex,
+                                             std::string* absl_nonnull bytes);
+
 // HexStringToBytes()
 //
 // Converts an ASCII hex string into bytes, returning binary data of length
@@ -179,6 +208,13 @@ std::string HexStringToBytes(absl::string_view from);
 // `2*from.size()`.
 std::string BytesToHexString(absl::string_view from);
 
+// BytesToHexStringAndAppend()
+//
+// Like `BytesToHexString()`, but appends the `2*from.size()` characters of the
+// encoding to the existing contents of `dest`.
+void BytesToHexStringAndAppend(absl::string_view from,
+                               std::string* absl_nonnull dest);
+
 ABSL_NAMESPACE_END
 }  // namespace absl
 
@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <random>
@@ -87,6 +88,97 @@ void BM_HexStringToBytes_Fail(benchmark::State& state) {
 }
 BENCHMARK(BM_HexStringToBytes_Fail);
 
+// Returns `size` bytes of pseudo-random binary data.
+std::string RandomBytes(size_t size) {
+  std::minstd_rand rng(size);
+  std::string bytes(size, '\0');
+  for (char& c : bytes) c = static_cast<char>(rng());
+  return bytes;
+}
+
+void BM_Base64Escape(benchmark::State& state) {
+  const std::string raw = RandomBytes(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    std::string escaped;
+    benchmark::DoNotOptimize(raw);
+    absl::Base64Escape(raw, &escaped);
+    benchmark::DoNotOptimize(escaped);
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Base64Escape)->Range(1 << 10, 1 << 20);
+
+void BM_Base64EscapeAndAppend(benchmark::State& state) {
+  const std::string raw = RandomBytes(static_cast<size_t>(state.range(0)));
+  std::string escaped;
+  for (auto _ : state) {
+    escaped.clear();
+    benchmark::DoNotOptimize(raw);
+    absl::Base64EscapeAndAppend(raw, &escaped);
+    benchmark::DoNotOptimize(escaped);
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Base64EscapeAndAppend)->Range(1 << 10, 1 << 20);
+
+void BM_Base64Unescape(benchmark::State& state) {
+  const std::string escaped =
+      absl::Base64Escape(RandomBytes(static_cast<size_t>(state.range(0))));
+  for (auto _ : state) {
+    std::string raw;
+    benchmark::DoNotOptimize(escaped);
+    bool result = absl::Base64Unescape(escaped, &raw);
+    benchmark::DoNotOptimize(result);
+    benchmark::DoNotOptimize(raw);
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Base64Unescape)->Range(1 << 10, 1 << 20);
+
+// Base64 with a line break every 76 characters, as produced by MIME encoders.
+void BM_Base64Unescape_LineBreaks(benchmark::State& state) {
+  const std::string escaped =
+      absl::Base64Escape(RandomBytes(static_cast<size_t>(state.range(0))));
+  std::string wrapped;
+  for (size_t i = 0; i < escaped.size(); i += 76) {
+    absl::StrAppend(&wrapped, absl::string_view(escaped).substr(i, 76), "\r\n");
+  }
+  for (auto _ : state) {
+    std::string raw;
+    benchmark::DoNotOptimize(wrapped);
+    bool result = absl::Base64Unescape(wrapped, &raw);
+    benchmark::DoNotOptimize(result);
+    benchmark::DoNotOptimize(raw);
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Base64Unescape_LineBreaks)->Range(1 << 10, 1 << 20);
+
+void BM_BytesToHexString(benchmark::State& state) {
+  const std::string raw = RandomBytes(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(raw);
+    std::string hex = absl::BytesToHexString(raw);
+    benchmark::DoNotOptimize(hex);
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BytesToHexString)->Range(1 << 10, 1 << 20);
+
+void BM_HexStringToBytes_Large(benchmark::State& state) {
+  const std::string hex =
+      absl::BytesToHexString(RandomBytes(static_cast<size_t>(state.range(0))));
+  std::string output;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(hex);
+    bool result = absl::HexStringToBytes(hex, &output);
+    benchmark::DoNotOptimize(result);
+    benchmark::DoNotOptimize(output);
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_HexStringToBytes_Large)->Range(1 << 10, 1 << 20);
+
 // Used for the CEscape benchmarks
 const char kStringValueNoEscape[] = "1234567890";
 const char kStringValueSomeEscaped[] = "123\n56789\xA1";
@@ -25,13 +25,18 @@
 
 #include "gtest/gtest.h"
 #include "absl/log/check.h"
+#include "absl/strings/ascii.h"
 #include "absl/strings/str_cat.h"
 
 #include "absl/strings/internal/escaping_test_common.h"
+#include "absl/strings/internal/simd_dispatch.h"
+#include "absl/strings/internal/simd_dispatch_test_util.h"
 #include "absl/strings/string_view.h"
 
 namespace {
 
+using absl::strings_internal::ForEachSimdLevel;
+
 struct epair {
   std::string escaped;
   std::string unescaped;
@@ -757,4 +762,131 @@ TEST(HexAndBack, HexStringToBytes_and_BytesToHexString) {
   EXPECT_EQ(hex_only_lower, hex_result);
 }
 
+// Returns `size` bytes covering every byte value.
+std::string PatternBytes(size_t size) {
+  std::string bytes(size, '\0');
+  for (size_t i = 0; i < size; ++i) {
+    bytes[i] = static_cast<char>((i * 131 + (i >> 8) * 7) & 0xFF);
+  }
+  return bytes;
+}
+
+TEST(Base64, SimdMatchesScalar) {
+  std::vector<std::string> expected, expected_websafe;
+  std::vector<size_t> sizes;
+  for (size_t size = 0; size < 160; ++size) sizes.push_back(size);
+  for (size_t size : {1000, 4095, 4096, 65537}) sizes.push_back(size);
+
+  ASSERT_TRUE(absl::strings_internal::SetSimdLevelForTesting(
+      absl::strings_internal::SimdLevel::kScalar));
+  for (size_t size : sizes) {
+    expected.push_back(absl::Base64Escape(PatternBytes(size)));
+    expected_websafe.push_back(absl::WebSafeBase64Escape(PatternBytes(size)));
+  }
+
+  ForEachSimdLevel([&] {
+    for (size_t i = 0; i < sizes.size(); ++i) {
+      const std::string raw = PatternBytes(sizes[i]);
+      EXPECT_EQ(absl::Base64Escape(raw), expected[i]);
+      EXPECT_EQ(absl::WebSafeBase64Escape(raw), expected_websafe[i]);
+
+      std::string decoded;
+      EXPECT_TRUE(absl::Base64Unescape(expected[i], &decoded));
+      EXPECT_EQ(decoded, raw);
+      EXPECT_TRUE(absl::WebSafeBase64Unescape(expected_websafe[i], &decoded));
+      EXPECT_EQ(decoded, raw);
+    }
+  });
+}
+
+TEST(Base64, SimdPreservesValidation) {
+  const std::string raw = PatternBytes(3000);
+  const std::string encoded = absl::Base64Escape(raw);
+  ForEachSimdLevel([&] {
+    for (size_t pos : {0, 1, 5, 15, 16, 17, 31, 32, 63, 64, 100, 1999}) {
+      // Whitespace anywhere is skipped.
+      std::string with_space = encoded;
+      with_space.insert(pos, "\r\n ");
+      std::string decoded;
+      EXPECT_TRUE(absl::Base64Unescape(with_space, &decoded)) << pos;
+      EXPECT_EQ(decoded, raw);
+
+      // An invalid character anywhere is rejected.
+      for (char bad : {'*', '\0', '-', '\xC3'}) {
+        std::string with_bad = encoded;
+        with_bad[pos] = bad;
+        decoded = "junk";
+        EXPECT_FALSE(absl::Base64Unescape(with_bad, &decoded)) << pos;
+        EXPECT_TRUE(decoded.empty());
+      }
+
+      // Padding in the middle of the input is rejected.
+      std::string with_pad = encoded;
+      with_pad.insert(pos / 4 * 4, "====");
+      EXPECT_FALSE(absl::Base64Unescape(with_pad, &decoded)) << pos;
+    }
+  });
+}
+
+TEST(Base64, AppendVariants) {
+  std::string dest = "prefix:";
+  absl::Base64EscapeAndAppend("abcdefghijklmnop", &dest);
+  EXPECT_EQ(dest, "prefix:YWJjZGVmZ2hpamtsbW5vcA==");
+  absl::WebSafeBase64EscapeAndAppend("\xfb\xff", &dest);
+  EXPECT_EQ(dest, "prefix:YWJjZGVmZ2hpamtsbW5vcA==-_8");
+
+  std::string decoded = "prefix:";
+  EXPECT_TRUE(absl::Base64UnescapeAndAppend("YWJj", &decoded));
+  EXPECT_TRUE(absl::WebSafeBase64UnescapeAndAppend("-_8", &decoded));
+  EXPECT_EQ(decoded, "prefix:abc\xfb\xff");
+
+  // Failures leave the destination untouched.
+  EXPECT_FALSE(absl::Base64UnescapeAndAppend("YW*j", &decoded));
+  EXPECT_FALSE(absl::WebSafeBase64UnescapeAndAppend("YQ=", &decoded));
+  EXPECT_EQ(decoded, "prefix:abc\xfb\xff");
+}
+
+TEST(HexAndBack, SimdMatchesScalar) {
+  ForEachSimdLevel([&] {
+    for (size_t size : {0, 1, 15, 16, 17, 31, 32, 33, 63, 64, 65, 1000}) {
+      const std::string raw = PatternBytes(size);
+      std::string expected_hex;
+      for (unsigned char c : raw) {
+        absl::StrAppend(&expected_hex, absl::Hex(c, absl::kZeroPad2));
+      }
+      const std::string hex = absl::BytesToHexString(raw);
+      EXPECT_EQ(hex, expected_hex);
+
+      std::string bytes;
+      EXPECT_TRUE(absl::HexStringToBytes(hex, &bytes));
+      EXPECT_EQ(bytes, raw);
+      std::string upper_hex = hex;
+      for (char& c : upper_hex) c = absl::ascii_toupper(c);
+      EXPECT_TRUE(absl::HexStringToBytes(upper_hex, &bytes));
+      EXPECT_EQ(bytes, raw);
+
+      for (size_t pos = 0; pos < hex.size(); pos += 7) {
+        for (char bad : {'g', 'G', '/', ':', '@', '`', ' ', '\xB0'}) {
+          std::string with_bad = hex;
+          with_bad[pos] = bad;
+          EXPECT_FALSE(absl::HexStringToBytes(with_bad, &bytes)) << pos;
+        }
+      }
+    }
+  });
+}
+
+TEST(HexAndBack, AppendVariants) {
+  std::string hex = "0x";
+  absl::BytesToHexStringAndAppend("\x01\xab", &hex);
+  EXPECT_EQ(hex, "0x01ab");
+
+  std::string bytes = "a";
+  EXPECT_TRUE(absl::HexStringToBytesAndAppend("6263", &bytes));
+  EXPECT_EQ(bytes, "abc");
+  EXPECT_FALSE(absl::HexStringToBytesAndAppend("64zz", &bytes));
+  EXPECT_FALSE(absl::HexStringToBytesAndAppend("646", &bytes));
+  EXPECT_EQ(bytes, "abc");
+}
+
 }  // namespace
@@ -0,0 +1,482 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/strings/internal/ascii_simd.h"
+
+#include <cstddef>
+#include <cstdint>
+
+#include "absl/base/attributes.h"
+#include "absl/base/config.h"
+#include "absl/numeric/bits.h"
+#include "absl/strings/internal/simd_dispatch.h"
+
+#if defined(ABSL_INTERNAL_STRINGS_HAVE_X86_DISPATCH)
+#include <immintrin.h>
+#elif defined(ABSL_INTERNAL_HAVE_ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define ABSL_INTERNAL_STRINGS_ASCII_NEON 1
+#endif
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+namespace strings_internal {
+namespace {
+
+// The upper- and lowercase versions of an ASCII letter differ only in this bit.
+constexpr unsigned char kCaseBit = 'a' ^ 'A';
+
+inline unsigned char FoldToLower(unsigned char c) {
+  return c >= 'A' && c <= 'Z' ? static_cast<unsigned char>(c | kCaseBit) : c;
+}
+
+// Counts the leading bytes of `s1` and `s2` that are equal ignoring case.
+inline size_t MismatchScalar(const char* s1, const char* s2, size_t len) {
+  size_t i = 0;
+  while (i < len && FoldToLower(static_cast<unsigned char>(s1[i])) ==
+                        FoldToLower(static_cast<unsigned char>(s2[i]))) {
+    ++i;
+  }
+  return i;
+}
+
+#if defined(ABSL_INTERNAL_STRINGS_HAVE_X86_DISPATCH)
+
+// ----------------------------------------------------------------------
+// x86 kernels.
+//
+// SSE2 has no unsigned byte comparison, so a letter range ['A', 'Z'] (or
+// ['a', 'z']) is tested by adding a bias that moves it to the bottom of the
+// signed range and comparing against `SCHAR_MIN + 26`.
+//
+// The 16-byte kernels only use SSE2 instructions, but are selected together
+// with the other kernels at the SSSE3 level. They are force-inlined so that
+// the AVX2 kernels can use them for short inputs and tails: calling the
+// separately compiled, non-VEX encoded versions with dirty upper halves of the
+// YMM registers incurs a large transition penalty on some CPUs.
+//
+// Inputs that are not a multiple of the vector size are finished with an
+// overlapping final block. When converting case, that block is loaded before
+// anything is stored, which keeps in-place conversion correct and avoids a
+// store-forwarding stall on the overlap.
+
+#define ABSL_INTERNAL_STRINGS_SSE_INLINE \
+  ABSL_INTERNAL_STRINGS_TARGET_SSSE3 ABSL_ATTRIBUTE_ALWAYS_INLINE inline
+#define ABSL_INTERNAL_STRINGS_AVX2_INLINE \
+  ABSL_INTERNAL_STRINGS_TARGET_AVX2 ABSL_ATTRIBUTE_ALWAYS_INLINE inline
+
+// Holds the constants that fold the case of letters starting at `first`.
+struct FoldConstantsSse {
+  ABSL_INTERNAL_STRINGS_SSE_INLINE explicit FoldConstantsSse(char first)
+      : bias(_mm_set1_epi8(static_cast<char>(0x80 - first))),
+        limit(_mm_set1_epi8(static_cast<char>(-128 + 26))),
+        bit(_mm_set1_epi8(static_cast<char>(kCaseBit))) {}
+
+  __m128i bias;
+  __m128i limit;
+  __m128i bit;
+};
+
+ABSL_INTERNAL_STRINGS_SSE_INLINE __m128i FoldSse(__m128i v,
+                                                 const FoldConstantsSse& c) {
+  const __m128i in_range = _mm_cmpgt_epi8(c.limit, _mm_add_epi8(v, c.bias));
+  return _mm_xor_si128(v, _mm_and_si128(in_range, c.bit));
+}
+
+ABSL_INTERNAL_STRINGS_SSE_INLINE __m128i LoadSse(const char* p) {
+  return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+}
+
+ABSL_INTERNAL_STRINGS_SSE_INLINE void StoreSse(char* p, __m128i v) {
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v);
+}
+
+// Requires `n >= 16`.
+ABSL_INTERNAL_STRINGS_SSE_INLINE void CaseFoldSse(bool to_upper, char* dst,
+                                                  const char* src, size_t n) {
+  const FoldConstantsSse c(to_upper ? 'a' : 'A');
+  const __m128i tail = FoldSse(LoadSse(src + n - 16), c);
+  for (size_t i = 0; i + 16 <= n; i += 16) {
+    StoreSse(dst + i, FoldSse(LoadSse(src + i), c));
+  }
+  StoreSse(dst + n - 16, tail);
+}
+
+// Returns a bitmask of the bytes of the blocks at `s1` and `s2` that are not
+// equal ignoring case.
+ABSL_INTERNAL_STRINGS_SSE_INLINE uint32_t
+MismatchMaskSse(const char* s1, const char* s2, const FoldConstantsSse& c) {
+  const __m128i eq =
+      _mm_cmpeq_epi8(FoldSse(LoadSse(s1), c), FoldSse(LoadSse(s2), c));
+  return static_cast<uint32_t>(_mm_movemask_epi8(eq)) ^ 0xFFFF;
+}
+
+// Requires `len >= 16`.
+ABSL_INTERNAL_STRINGS_SSE_INLINE size_t MismatchSse(const char* s1,
+                                                    const char* s2,
+                                                    size_t len) {
+  const FoldConstantsSse c('A');
+  size_t i = 0;
+  for (; i + 16 <= len; i += 16) {
+    const uint32_t mask = MismatchMaskSse(s1 + i, s2 + i, c);
+    if (mask != 0) return i + static_cast<size_t>(absl::countr_zero(mask));
+  }
+  if (i < len) {
+    i = len - 16;
+    const uint32_t mask = MismatchMaskSse(s1 + i, s2 + i, c);
+    if (mask != 0) return i + static_cast<size_t>(absl::countr_zero(mask));
+  }
+  return len;
+}
+
+ABSL_INTERNAL_STRINGS_SSE_INLINE bool EqualsIgnoreCaseSse(const char* s1,
+                                                          const char* s2,
+                                                          size_t len) {
+  if (len < 16) return MismatchScalar(s1, s2, len) == len;
+  return MismatchSse(s1, s2, len) == len;
+}
+
+// Candidate start positions are those where both the first and the last byte
+// of the needle match; only these are compared in full. Searches the start
+// positions before `positions` 16 at a time, beginning at `i`, and returns
+// where it stopped or, via `*pos`, the first match.
+ABSL_INTERNAL_STRINGS_SSE_INLINE bool FindSse(const char* haystack,
+                                              size_t positions,
+                                              const char* needle,
+                                              size_t needle_size, size_t i,
+                                              size_t* pos) {
+  const FoldConstantsSse c('A');
+  const size_t last = needle_size - 1;
+  const __m128i first_byte = _mm_set1_epi8(
+      static_cast<char>(FoldToLower(static_cast<unsigned char>(needle[0]))));
+  const __m128i last_byte = _mm_set1_epi8(
+      static_cast<char>(FoldToLower(static_cast<unsigned char>(needle[last]))));
+  for (; i + 16 <= positions; i += 16) {
+    const __m128i a = FoldSse(LoadSse(haystack + i), c);
+    const __m128i b = FoldSse(LoadSse(haystack + i + last), c);
+    uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_and_si128(
+        _mm_cmpeq_epi8(a, first_byte), _mm_cmpeq_epi8(b, last_byte))));
+    while (mask != 0) {
+      const size_t candidate = i + static_cast<size_t>(absl::countr_zero(mask));
+      if (last < 2 || EqualsIgnoreCaseSse(haystack + candidate + 1, needle + 1,
+                                          last - 1)) {
+        *pos = candidate;
+        return true;
+      }
+      mask &= mask - 1;
+    }
+  }
+  *pos = i;
+  return false;
+}
+
+ABSL_INTERNAL_STRINGS_TARGET_SSSE3 size_t AsciiCaseFoldSsse3(bool to_upper,
+                                                             char* dst,
+                                                             const char* src,
+                                                             size_t n) {
+  CaseFoldSse(to_upper, dst, src, n);
+  return n;
+}
+
+ABSL_INTERNAL_STRINGS_TARGET_SSSE3 size_t CaseInsensitiveMismatchSsse3(
+    const char* s1, const char* s2, size_t len) {
+  return MismatchSse(s1, s2, len);
+}
+
+ABSL_INTERNAL_STRINGS_TARGET_SSSE3 bool FindIgnoreCaseSsse3(
+    const char* haystack, size_t haystack_size, const char* needle,
+    size_t needle_size, size_t* pos) {
+  return FindSse(haystack, haystack_size - needle_size + 1, needle,
+                 needle_size, 0, pos);
+}
+
+struct FoldConstantsAvx2 {
+  ABSL_INTERNAL_STRINGS_AVX2_INLINE explicit FoldConstantsAvx2(char first)
+      : bias(_mm256_set1_epi8(static_cast<char>(0x80 - first))),
+        limit(_mm256_set1_epi8(static_cast<char>(-128 + 26))),
+        bit(_mm256_set1_epi8(static_cast<char>(kCaseBit))) {}
+
+  __m256i bias;
+  __m256i limit;
+  __m256i bit;
+};
+
+ABSL_INTERNAL_STRINGS_AVX2_INLINE __m256i FoldAvx2(__m256i v,
+                                                   const FoldConstantsAvx2& c) {
+  const __m256i in_range =
+      _mm256_cmpgt_epi8(c.limit, _mm256_add_epi8(v, c.bias));
+  return _mm256_xor_si256(v, _mm256_and_si256(in_range, c.bit));
+}
+
+ABSL_INTERNAL_STRINGS_AVX2_INLINE __m256i LoadAvx2(const char* p) {
+  return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+}
+
+ABSL_INTERNAL_STRINGS_AVX2_INLINE void StoreAvx2(char* p, __m256i v) {
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v);
+}
+
+ABSL_INTERNAL_STRINGS_AVX2_INLINE uint32_t
+MismatchMaskAvx2(const char* s1, const char* s2, const FoldConstantsAvx2& c) {
+  const __m256i eq =
+      _mm256_cmpeq_epi8(FoldAvx2(LoadAvx2(s1), c), FoldAvx2(LoadAvx2(s2), c));
+  return ~static_cast<uint32_t>(_mm256_movemask_epi8(eq));
+}
+
+// Requires `len >= 16`.
+ABSL_INTERNAL_STRINGS_AVX2_INLINE size_t MismatchAvx2(const char* s1,
+                                                      const char* s2,
+                                                      size_t len) {
+  if (len < 32) return MismatchSse(s1, s2, len);
+  const FoldConstantsAvx2 c('A');
+  size_t i = 0;
+  for (; i + 32 <= len; i += 32) {
+    const uint32_t mask = MismatchMaskAvx2(s1 + i, s2 + i, c);
+    if (mask != 0) return i + static_cast<size_t>(absl::countr_zero(mask));
+  }
+  if (i < len) {
+    i = len - 32;
+    const uint32_t mask = MismatchMaskAvx2(s1 + i, s2 + i, c);
+    if (mask != 0) return i + static_cast<size_t>(absl::countr_zero(mask));
+  }
+  return len;
+}
+
+ABSL_INTERNAL_STRINGS_AVX2_INLINE bool EqualsIgnoreCaseAvx2(const char* s1,
+                                                            const char* s2,
+                                                            size_t len) {
+  if (len < 16) return MismatchScalar(s1, s2, len) == len;
+  return MismatchAvx2(s1, s2, len) == len;
+}
+
+ABSL_INTERNAL_STRINGS_TARGET_AVX2 size_t AsciiCaseFoldAvx2(bool to_upper,
+                                                           char* dst,
+                                                           const char* src,
+                                                           size_t n) {
+  if (n < 32) {
+    CaseFoldSse(to_upper, dst, src, n);
+    return n;
+  }
+  const FoldConstantsAvx2 c(to_upper ? 'a' : 'A');
+  const __m256i tail = FoldAvx2(LoadAvx2(src + n - 32), c);
+  size_t i = 0;
+  for (; i + 64 <= n; i += 64) {
+    const __m256i v0 = FoldAvx2(LoadAvx2(src + i), c);
+    const __m256i v1 = FoldAvx2(LoadAvx2(src + i + 32), c);
+    StoreAvx2(dst + i, v0);
+    StoreAvx2(dst + i + 32, v1);
+  }
+  if (i + 32 <= n) StoreAvx2(dst + i, FoldAvx2(LoadAvx2(src + i), c));
+  StoreAvx2(dst + n - 32, tail);
+  return n;
+}
+
+ABSL_INTERNAL_STRINGS_TARGET_AVX2 size_t CaseInsensitiveMismatchAvx2(
+    const char* s1, const char* s2, size_t len) {
+  return MismatchAvx2(s1, s2, len);
+}
+
+ABSL_INTERNAL_STRINGS_TARGET_AVX2 bool FindIgnoreCaseAvx2(
+    const char* haystack, size_t haystack_size, const char* needle,
+    size_t needle_size, size_t* pos) {
+  const FoldConstantsAvx2 c('A');
+  const size_t last = needle_size - 1;
+  const size_t positions = haystack_size - last;
+  const __m256i first_byte = _mm256_set1_epi8(
+      static_cast<char>(FoldToLower(static_cast<unsigned char>(needle[0]))));
+  const __m256i last_byte = _mm256_set1_epi8(
+      static_cast<char>(FoldToLower(static_cast<unsigned char>(needle[last]))));
+  size_t i = 0;
+  for (; i + 32 <= positions; i += 32) {
+    const __m256i a = FoldAvx2(LoadAvx2(haystack + i), c);
+    const __m256i b = FoldAvx2(LoadAvx2(haystack + i + last), c);
+    uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_and_si256(
+        _mm256_cmpeq_epi8(a, first_byte), _mm256_cmpeq_epi8(b, last_byte))));
+    while (mask != 0) {
+      const size_t candidate = i + static_cast<size_t>(absl::countr_zero(mask));
+      if (last < 2 || EqualsIgnoreCaseAvx2(haystack + candidate + 1,
+                                           needle + 1, last - 1)) {
+        *pos = candidate;
+        return true;
+      }
+      mask &= mask - 1;
+    }
+  }
+  // At most one 16-byte block of start positions remains.
+  return FindSse(haystack, positions, needle, needle_size, i, pos);
+}
+
+#undef ABSL_INTERNAL_STRINGS_SSE_INLINE
+#undef ABSL_INTERNAL_STRINGS_AVX2_INLINE
+
+#elif defined(ABSL_INTERNAL_STRINGS_ASCII_NEON)
+
+// ----------------------------------------------------------------------
+// NEON kernels.
+//
+// NEON has unsigned comparisons, so a letter is simply a byte whose distance
+// above 'A' (or 'a') is less than 26. Comparison results are reduced to 4 bits
+// per byte with a narrowing shift.
+
+inline uint8x16_t FoldNeon(uint8x16_t v, uint8x16_t first) {
+  const uint8x16_t in_range = vcltq_u8(vsubq_u8(v, first), vdupq_n_u8(26));
+  return veorq_u8(v, vandq_u8(in_range, vdupq_n_u8(kCaseBit)));
+}
+
+inline uint8x16_t LoadNeon(const char* p) {
+  return vld1q_u8(reinterpret_cast<const uint8_t*>(p));
+}
+
+// Returns 4 bits per byte of `m`, which must be a comparison result.
+inline uint64_t NibbleMaskNeon(uint8x16_t m) {
+  return vget_lane_u64(
+      vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(m), 4)), 0);
+}
+
+size_t AsciiCaseFoldNeon(bool to_upper, char* dst, const char* src,
+                         size_t n) {
+  const uint8x16_t first = vdupq_n_u8(to_upper ? 'a' : 'A');
+  uint8_t* out = reinterpret_cast<uint8_t*>(dst);
+  // As on x86, the overlapping final block is loaded first.
+  const uint8x16_t tail = FoldNeon(LoadNeon(src + n - 16), first);
+  for (size_t i = 0; i + 16 <= n; i += 16) {
+    vst1q_u8(out + i, FoldNeon(LoadNeon(src + i), first));
+  }
+  vst1q_u8(out + n - 16, tail);
+  return n;
+}
+
+inline uint64_t MismatchMaskNeon(const char* s1, const char* s2,
+                                 uint8x16_t first) {
+  return ~NibbleMaskNeon(vceqq_u8(FoldNeon(LoadNeon(s1), first),
+                                  FoldNeon(LoadNeon(s2), first)));
+}
+
+size_t CaseInsensitiveMismatchNeon(const char* s1, const char* s2,
+                                   size_t len) {
+  const uint8x16_t first = vdupq_n_u8('A');
+  size_t i = 0;
+  for (; i + 16 <= len; i += 16) {
+    const uint64_t mask = MismatchMaskNeon(s1 + i, s2 + i, first);
+    if (mask != 0) return i + static_cast<size_t>(absl::countr_zero(mask) >> 2);
+  }
+  if (i < len) {
+    i = len - 16;
+    const uint64_t mask = MismatchMaskNeon(s1 + i, s2 + i, first);
+    if (mask != 0) return i + static_cast<size_t>(absl::countr_zero(mask) >> 2);
+  }
+  return len;
+}
+
+bool FindIgnoreCaseNeon(const char* haystack, size_t haystack_size,
+                        const char* needle, size_t needle_size, size_t* pos) {
+  const uint8x16_t first = vdupq_n_u8('A');
+  const size_t last = needle_size - 1;
+  const size_t positions = haystack_size - last;
+  const uint8x16_t first_byte =
+      vdupq_n_u8(FoldToLower(static_cast<unsigned char>(needle[0])));
+  const uint8x16_t last_byte =
+      vdupq_n_u8(FoldToLower(static_cast<unsigned char>(needle[last])));
+  size_t i = 0;
+  for (; i + 16 <= positions; i += 16) {
+    const uint8x16_t a = FoldNeon(LoadNeon(haystack + i), first);
+    const uint8x16_t b = FoldNeon(LoadNeon(haystack + i + last), first);
+    uint64_t mask = NibbleMaskNeon(
+        vandq_u8(vceqq_u8(a, first_byte), vceqq_u8(b, last_byte)));
+    while (mask != 0) {
+      const size_t candidate =
+          i + static_cast<size_t>(absl::countr_zero(mask) >> 2);
+      const size_t middle = last < 2 ? 0 : last - 1;
+      const size_t matched =
+          middle < 16 ? MismatchScalar(haystack + candidate + 1, needle + 1,
+                                       middle)
+                      : CaseInsensitiveMismatchNeon(haystack + candidate + 1,
+                                                    needle + 1, middle);
+      if (matched == middle) {
+        *pos = candidate;
+        return true;
+      }
+      // Clear the 4 bits of this candidate.
+      mask &= ~(uint64_t{0xF} << (absl::countr_zero(mask) & ~3));
+    }
+  }
+  *pos = i;
+  return false;
+}
+
+#endif
+
+}  // namespace
+
+size_t AsciiCaseFoldSimd(bool to_upper, char* dst, const char* src,
+                         size_t n) {
+  if (n < 16) return 0;
+  switch (ActiveSimdLevel()) {
+#if defined(ABSL_INTERNAL_STRINGS_HAVE_X86_DISPATCH)
+    case SimdLevel::kAvx2:
+      return AsciiCaseFoldAvx2(to_upper, dst, src, n);
+    case SimdLevel::kSsse3:
+      return AsciiCaseFoldSsse3(to_upper, dst, src, n);
+#elif defined(ABSL_INTERNAL_STRINGS_ASCII_NEON)
+    case SimdLevel::kNeon:
+      return AsciiCaseFoldNeon(to_upper, dst, src, n);
+#endif
+    default:
+      return 0;
+  }
+}
+
+size_t CaseInsensitiveMismatchSimd(const char* s1, const char* s2,
+                                   size_t len) {
+  if (len < 16) return 0;
+  switch (ActiveSimdLevel()) {
+#if defined(ABSL_INTERNAL_STRINGS_HAVE_X86_DISPATCH)
+    case SimdLevel::kAvx2:
+      return CaseInsensitiveMismatchAvx2(s1, s2, len);
+    case SimdLevel::kSsse3:
+      return CaseInsensitiveMismatchSsse3(s1, s2, len);
+#elif defined(ABSL_INTERNAL_STRINGS_ASCII_NEON)
+    case SimdLevel::kNeon:
+      return CaseInsensitiveMismatchNeon(s1, s2, len);
+#endif
+    default:
+      return 0;
+  }
+}
+
+bool FindIgnoreCaseSimd(const char* haystack, size_t haystack_size,
+                        const char* needle, size_t needle_size, size_t* pos) {
+  *pos = 0;
+  if (haystack_size - needle_size < 15) return false;
+  switch (ActiveSimdLevel()) {
+#if defined(ABSL_INTERNAL_STRINGS_HAVE_X86_DISPATCH)
+    case SimdLevel::kAvx2:
+      return FindIgnoreCaseAvx2(haystack, haystack_size, needle, needle_size,
+                                pos);
+    case SimdLevel::kSsse3:
+      return FindIgnoreCaseSsse3(haystack, haystack_size, needle, needle_size,
+                                 pos);
+#elif defined(ABSL_INTERNAL_STRINGS_ASCII_NEON)
+    case SimdLevel::kNeon:
+      return FindIgnoreCaseNeon(haystack, haystack_size, needle, needle_size,
+                                pos);
+#endif
+    default:
+      return false;
+  }
+}
+
+}  // namespace strings_internal
+ABSL_NAMESPACE_END
+}  // namespace absl
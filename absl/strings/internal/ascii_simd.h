@@ -0,0 +1,58 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Vectorized kernels for ASCII case conversion and case-insensitive
+// comparison and search.
+//
+// As with the escaping kernels, each function returns how much of its input it
+// handled so that the caller can finish with the scalar code. All kernels
+// return immediately, having handled nothing, when the active `SimdLevel` is
+// `kScalar` or the input is shorter than a vector.
+
+#ifndef ABSL_STRINGS_INTERNAL_ASCII_SIMD_H_
+#define ABSL_STRINGS_INTERNAL_ASCII_SIMD_H_
+
+#include <cstddef>
+
+#include "absl/base/config.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+namespace strings_internal {
+
+// Writes the ASCII lowercase (or uppercase, if `to_upper`) version of the `n`
+// bytes of `src` to `dst`, which may be equal to `src` but must not otherwise
+// overlap it. Returns either 0 or `n`.
+size_t AsciiCaseFoldSimd(bool to_upper, char* dst, const char* src, size_t n);
+
+// Returns the length of a prefix over which `s1` and `s2` are equal ignoring
+// ASCII case. The result is either the position of the first such mismatch,
+// `len` if there is none, or 0 if the kernel did not run.
+size_t CaseInsensitiveMismatchSimd(const char* s1, const char* s2, size_t len);
+
+// Searches the start positions of `haystack` that leave room for `needle` for
+// an occurrence of `needle`, ignoring ASCII case. Requires
+// `1 <= needle_size <= haystack_size`.
+//
+// Returns true and stores the first match in `*pos` if one was found.
+// Otherwise returns false and stores in `*pos` the number of leading start
+// positions that were ruled out; the caller must check the remaining ones.
+bool FindIgnoreCaseSimd(const char* haystack, size_t haystack_size,
+                        const char* needle, size_t needle_size, size_t* pos);
+
+}  // namespace strings_internal
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_STRINGS_INTERNAL_ASCII_SIMD_H_
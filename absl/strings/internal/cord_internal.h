@@ -69,6 +69,15 @@ inline void enable_shallow_subcords(bool enable) {
   shallow_subcords_enabled.store(enable, std::memory_order_relaxed);
 }
 
+// The average data edge length below which a cord btree is compacted as it
+// grows through appends, or 0 if automatic compaction is disabled (default).
+// See `Cord::Compact()`.
+extern std::atomic<size_t> cord_auto_compact_threshold;
+
+inline void set_cord_auto_compact_threshold(size_t threshold) {
+  cord_auto_compact_threshold.store(threshold, std::memory_order_relaxed);
+}
+
 enum Constants {
   // The inlined size to use with absl::InlinedVector.
   //
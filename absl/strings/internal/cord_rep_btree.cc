@@ -14,9 +14,12 @@
 
 #include "absl/strings/internal/cord_rep_btree.h"
 
+#include <algorithm>
 #include <atomic>
 #include <cassert>
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <iostream>
 #include <ostream>
 #include <string>
@@ -1159,6 +1162,138 @@ CordRepBtree* CordRepBtree::Rebuild(CordRepBtree* tree) {
   return nullptr;
 }
 
+namespace {
+
+// Returns true if `tree` holds two adjacent data edges of less than
+// `small_length` bytes. `prev_small` holds whether the data edge preceding
+// `tree` is small, and is updated to whether the last edge of `tree` is.
+bool HasAdjacentSmallEdges(const CordRepBtree* tree, size_t small_length,
+                           bool& prev_small) {
+  if (tree->height() > 0) {
+    for (const CordRep* edge : tree->Edges()) {
+      if (HasAdjacentSmallEdges(edge->btree(), small_length, prev_small)) {
+        return true;
+      }
+    }
+    return false;
+  }
+  for (const CordRep* edge : tree->Edges()) {
+    const bool small = edge->length < small_length;
+    if (small && prev_small) return true;
+    prev_small = small;
+  }
+  return false;
+}
+
+// Builds a compacted tree from the data edges of a tree added in order.
+class TreeCompactor {
+ public:
+  explicit TreeCompactor(size_t chunk_size) : chunk_size_(chunk_size) {}
+
+  // Adds `edge`, without consuming a reference.
+  void Add(CordRep* edge) {
+    if (edge->length >= chunk_size_ / 2) {
+      FinishRun();
+      AddEdge(CordRep::Ref(edge));
+    } else if (in_run_) {
+      Copy(EdgeData(edge));
+    } else if (pending_ == nullptr) {
+      // Hold on to a single small edge until the next edge tells if it starts
+      // a run worth copying.
+      pending_ = edge;
+    } else {
+      in_run_ = true;
+      Copy(EdgeData(pending_));
+      pending_ = nullptr;
+      Copy(EdgeData(edge));
+    }
+  }
+
+  // Adds all data edges of `tree`.
+  void AddTree(const CordRepBtree* tree) {
+    for (CordRep* edge : tree->Edges()) {
+      if (tree->height() > 0) {
+        AddTree(edge->btree());
+      } else {
+        Add(edge);
+      }
+    }
+  }
+
+  CordRepBtree* Finish() {
+    FinishRun();
+    return tree_;
+  }
+
+ private:
+  void AddEdge(CordRep* rep) {
+    tree_ = tree_ == nullptr ? CordRepBtree::Create(rep)
+                             : CordRepBtree::Append(tree_, rep);
+  }
+
+  void Copy(absl::string_view data) {
+    while (!data.empty()) {
+      if (flat_ == nullptr) {
+        flat_ = CordRepFlat::New(CordRepFlat::Large(), chunk_size_);
+        flat_->length = 0;
+      }
+      const size_t n = (std::min)(data.size(), chunk_size_ - flat_->length);
+      memcpy(flat_->Data() + flat_->length, data.data(), n);
+      flat_->length += n;
+      data.remove_prefix(n);
+      if (flat_->length == chunk_size_) {
+        AddEdge(flat_);
+        flat_ = nullptr;
+      }
+    }
+  }
+
+  void FinishRun() {
+    if (pending_ != nullptr) {
+      AddEdge(CordRep::Ref(pending_));
+      pending_ = nullptr;
+    }
+    if (flat_ != nullptr) {
+      AddEdge(flat_);
+      flat_ = nullptr;
+    }
+    in_run_ = false;
+  }
+
+  const size_t chunk_size_;
+  CordRepBtree* tree_ = nullptr;
+  // A single small edge not yet added to the tree.
+  CordRep* pending_ = nullptr;
+  // Whether small edges are being copied into flats.
+  bool in_run_ = false;
+  // The flat being filled with copied small edges.
+  CordRepFlat* flat_ = nullptr;
+};
+
+}  // namespace
+
+CordRepBtree* CordRepBtree::Compact(const CordRepBtree* tree,
+                                    size_t chunk_size) {
+  assert(chunk_size >= kMinFlatLength);
+  assert(chunk_size <= kMaxLargeFlatLength);
+  bool prev_small = false;
+  if (!HasAdjacentSmallEdges(tree, chunk_size / 2, prev_small)) {
+    return nullptr;
+  }
+  TreeCompactor compactor(chunk_size);
+  compactor.AddTree(tree);
+  return AssertValid(compactor.Finish());
+}
+
+size_t CordRepBtree::CountDataEdges(const CordRepBtree* tree) {
+  if (tree->height() == 0) return tree->size();
+  size_t count = 0;
+  for (const CordRep* edge : tree->Edges()) {
+    count += CountDataEdges(edge->btree());
+  }
+  return count;
+}
+
 CordRepBtree::ExtractResult CordRepBtree::ExtractAppendBuffer(
     CordRepBtree* tree, size_t extra_capacity) {
   int depth = 0;
@@ -288,6 +288,19 @@ class CordRepBtree : public CordRep {
   static ExtractResult ExtractAppendBuffer(CordRepBtree* tree,
                                            size_t extra_capacity = 1);
 
+  // Returns a new tree holding the same data as `tree` in fewer data edges,
+  // or nullptr if `tree` holds no two adjacent small data edges.
+  // Data edges of less than `chunk_size / 2` bytes are small: every run of two
+  // or more adjacent small edges is copied into new flats of `chunk_size`
+  // bytes, except for the last flat of a run. All other data edges, including
+  // large shared flats and external edges, are shared with `tree`.
+  // Does not consume a reference on `tree`.
+  // Requires `kMinFlatLength <= chunk_size <= kMaxLargeFlatLength`.
+  static CordRepBtree* Compact(const CordRepBtree* tree, size_t chunk_size);
+
+  // Returns the number of data edges in `tree`.
+  static size_t CountDataEdges(const CordRepBtree* tree);
+
   // Returns the `height` of the tree. The height of a tree is limited to
   // kMaxHeight. `height` is implemented as an `int` as in some places we
   // use negative (-1) values for 'data edges'.
@@ -1562,6 +1562,90 @@ TEST(CordRepBtreeTest, ExtractAppendBufferShared) {
   CordRep::Unref(node);
 }
 
+TEST(CordRepBtreeTest, CountDataEdges) {
+  for (size_t n : {1, 6, 7, 36, 37, 500}) {
+    CordRepBtree* tree = MakeTree(n);
+    EXPECT_EQ(CordRepBtree::CountDataEdges(tree), n);
+    CordRep::Unref(tree);
+  }
+}
+
+TEST(CordRepBtreeTest, CompactNothingToCompact) {
+  // Large edges only.
+  const std::string data = CreateRandomString(5000);
+  CordRepBtree* tree = CreateTree(data, 1000);
+  EXPECT_EQ(CordRepBtree::Compact(tree, 1000), nullptr);
+  CordRep::Unref(tree);
+
+  // Small edges between large edges.
+  tree = CreateTree({MakeFlat(data.substr(0, 1000)), MakeFlat("a"),
+                     MakeFlat(data.substr(1000, 1000)), MakeFlat("b")});
+  EXPECT_EQ(CordRepBtree::Compact(tree, 1000), nullptr);
+  CordRep::Unref(tree);
+}
+
+TEST(CordRepBtreeTest, CompactSmallEdges) {
+  const std::string data = CreateRandomString(10000);
+  CordRepBtree* tree = CreateTree(data, 10);
+  ASSERT_THAT(tree, IsNode(3));
+
+  CordRepBtree* compacted = CordRepBtree::Compact(tree, 1000);
+  ASSERT_THAT(compacted, IsNode(1));
+  EXPECT_EQ(CordToString(compacted), data);
+  std::vector<CordRep*> edges = GetLeafEdges(compacted);
+  ASSERT_THAT(edges, SizeIs(10));
+  for (CordRep* edge : edges) {
+    EXPECT_TRUE(edge->IsFlat());
+    EXPECT_EQ(edge->length, 1000);
+  }
+
+  // The input tree is not modified.
+  EXPECT_EQ(CordToString(tree), data);
+  EXPECT_EQ(CordRepBtree::CountDataEdges(tree), 1000);
+  CordRep::Unref(tree);
+  CordRep::Unref(compacted);
+}
+
+TEST(CordRepBtreeTest, CompactSharesLargeEdges) {
+  const std::string data = CreateRandomString(4000);
+  CordRepExternal* external = MakeExternal(data.substr(0, 2000));
+  CordRepFlat* flat = MakeFlat(data.substr(2000, 1000));
+  std::vector<CordRep*> reps = {external};
+  for (size_t i = 3000; i < 3400; i += 100) {
+    reps.push_back(MakeFlat(data.substr(i, 100)));
+  }
+  reps.push_back(flat);
+  reps.push_back(MakeFlat(data.substr(3400, 100)));
+  for (size_t i = 3500; i < 4000; i += 50) {
+    reps.push_back(MakeSubstring(10, 50, MakeFlat(data.substr(i - 10, 100))));
+  }
+  CordRepBtree* tree = CreateTree(reps);
+  const std::string expected = absl::StrCat(
+      data.substr(0, 2000), data.substr(3000, 400), data.substr(2000, 1000),
+      data.substr(3400, 600));
+  ASSERT_EQ(CordToString(tree), expected);
+
+  CordRepBtree* compacted = CordRepBtree::Compact(tree, 256);
+  ASSERT_NE(compacted, nullptr);
+  EXPECT_EQ(CordToString(compacted), expected);
+  std::vector<CordRep*> edges = GetLeafEdges(compacted);
+  ASSERT_THAT(edges, SizeIs(7));
+  EXPECT_EQ(edges[0], external);
+  EXPECT_THAT(edges[1], EqFlatHolding(data.substr(3000, 256)));
+  EXPECT_THAT(edges[2], EqFlatHolding(data.substr(3256, 144)));
+  EXPECT_EQ(edges[3], flat);
+  EXPECT_THAT(edges[4], EqFlatHolding(data.substr(3400, 256)));
+  EXPECT_THAT(edges[5], EqFlatHolding(data.substr(3656, 256)));
+  EXPECT_THAT(edges[6], EqFlatHolding(data.substr(3912, 88)));
+  EXPECT_FALSE(external->refcount.IsOne());
+  EXPECT_FALSE(flat->refcount.IsOne());
+
+  CordRep::Unref(tree);
+  EXPECT_TRUE(external->refcount.IsOne());
+  EXPECT_TRUE(flat->refcount.IsOne());
+  CordRep::Unref(compacted);
+}
+
 }  // namespace
 }  // namespace cord_internal
 ABSL_NAMESPACE_END
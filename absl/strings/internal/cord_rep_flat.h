@@ -22,7 +22,9 @@
 
 #include "absl/base/config.h"
 #include "absl/base/macros.h"
+#include "absl/base/optimization.h"
 #include "absl/strings/internal/cord_internal.h"
+#include "absl/strings/internal/cord_rep_flat_cache.h"
 
 namespace absl {
 ABSL_NAMESPACE_BEGIN
@@ -119,14 +121,19 @@ struct CordRepFlat : public CordRep {
 
     // Round size up so it matches a size we can exactly express in a tag.
     const size_t size = RoundUpForTag(len + kFlatOverhead);
-    void* const raw_rep = ::operator new(size);
+    const uint8_t tag = AllocatedSizeToTag(size);
+    void* raw_rep = nullptr;
+    if (ABSL_PREDICT_FALSE(flat_cache_is_enabled())) {
+      raw_rep = TakeCachedFlat(tag);
+    }
+    if (raw_rep == nullptr) raw_rep = ::operator new(size);
     // GCC 13 has a false-positive -Wstringop-overflow warning here.
     #if ABSL_INTERNAL_HAVE_MIN_GNUC_VERSION(13, 0)
     #pragma GCC diagnostic push
     #pragma GCC diagnostic ignored "-Wstringop-overflow"
     #endif
     CordRepFlat* rep = new (raw_rep) CordRepFlat();
-    rep->tag = AllocatedSizeToTag(size);
+    rep->tag = tag;
     #if ABSL_INTERNAL_HAVE_MIN_GNUC_VERSION(13, 0)
     #pragma GCC diagnostic pop
     #endif
@@ -141,16 +148,19 @@ struct CordRepFlat : public CordRep {
 
   // Deletes a CordRepFlat instance created previously through a call to New().
   // Flat CordReps are allocated and constructed with raw ::operator new and
-  // placement new, and must be destructed and deallocated accordingly.
+  // placement new, and must be destructed and deallocated accordingly. If the
+  // flat cache is enabled, the memory may instead be kept for reuse.
   static void Delete(CordRep*rep) {
     assert(rep->tag >= FLAT && rep->tag <= MAX_FLAT_TAG);
 
-#if defined(__cpp_sized_deallocation)
-    size_t size = TagToAllocatedSize(rep->tag);
+    const uint8_t tag = rep->tag;
     rep->~CordRep();
-    ::operator delete(rep, size);
+    if (ABSL_PREDICT_FALSE(flat_cache_is_enabled()) && CacheFlat(rep, tag)) {
+      return;
+    }
+#if defined(__cpp_sized_deallocation)
+    ::operator delete(rep, TagToAllocatedSize(tag));
 #else
-    rep->~CordRep();
     ::operator delete(rep);
 #endif
   }
@@ -0,0 +1,244 @@
+// Copyright 2026 The Abseil Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/strings/internal/cord_rep_flat_cache.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+#include "absl/base/attributes.h"
+#include "absl/base/config.h"
+#include "absl/base/internal/spinlock.h"
+#include "absl/base/optimization.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/strings/internal/cord_internal.h"
+#include "absl/strings/internal/cord_rep_flat.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+namespace cord_internal {
+
+ABSL_CONST_INIT std::atomic<bool> flat_cache_enabled(false);
+
+namespace {
+
+constexpr uint8_t kMaxCachedTag = AllocatedSizeToTagUnchecked(kMaxFlatSize);
+constexpr size_t kNumCachedTags = kMaxCachedTag - FLAT + 1;
+
+// The maximum number of flats a thread takes from the global pool on a miss.
+constexpr size_t kRefillBatch = 8;
+
+// A cached flat. The node occupies the memory of the destroyed flat.
+struct FreeFlat {
+  FreeFlat* next;
+};
+
+enum class ThreadCacheState : uint8_t { kUninitialized, kActive, kDestroyed };
+
+struct ThreadCache {
+  FreeFlat* heads[kNumCachedTags];
+  size_t bytes;
+  // The size class to release first when the cache is over budget. Rotating
+  // it spreads the release over all size classes.
+  size_t next_release;
+  ThreadCacheState state;
+};
+
+// `ThreadCache` is trivially destructible so that it can be accessed without
+// an initialization guard; a separate thread-local object releases it at
+// thread exit.
+ABSL_CONST_INIT thread_local ThreadCache thread_cache = {};
+
+ABSL_CONST_INIT absl::base_internal::SpinLock global_pool_mu(
+    absl::base_internal::SCHEDULE_KERNEL_ONLY);
+ABSL_CONST_INIT FreeFlat* global_pool[kNumCachedTags] ABSL_GUARDED_BY(
+    global_pool_mu) = {};
+ABSL_CONST_INIT size_t global_pool_bytes ABSL_GUARDED_BY(global_pool_mu) = 0;
+
+// Per size class counts of `global_pool`, written under `global_pool_mu` and
+// read without it so that misses do not take the lock when the pool is empty.
+ABSL_CONST_INIT std::atomic<size_t> global_pool_counts[kNumCachedTags] = {};
+
+inline uint8_t IndexToTag(size_t index) {
+  return static_cast<uint8_t>(FLAT + index);
+}
+
+void DeallocateFlat(void* raw, uint8_t tag) {
+#if defined(__cpp_sized_deallocation)
+  ::operator delete(raw, TagToAllocatedSize(tag));
+#else
+  static_cast<void>(tag);
+  ::operator delete(raw);
+#endif
+}
+
+// Moves the list at `head` into the global pool, deallocating whatever
+// exceeds the pool's budget. Returns the number of flats in the list.
+size_t MoveToGlobalPool(size_t index, FreeFlat* head) {
+  const uint8_t tag = IndexToTag(index);
+  const size_t size = TagToAllocatedSize(tag);
+  size_t count = 0;
+  {
+    absl::base_internal::SpinLockHolder lock(&global_pool_mu);
+    size_t moved = 0;
+    while (head != nullptr &&
+           global_pool_bytes + size <= kFlatCacheGlobalBudget) {
+      FreeFlat* next = head->next;
+      head->next = global_pool[index];
+      global_pool[index] = head;
+      head = next;
+      global_pool_bytes += size;
+      ++moved;
+    }
+    global_pool_counts[index].store(
+        global_pool_counts[index].load(std::memory_order_relaxed) + moved,
+        std::memory_order_relaxed);
+    count = moved;
+  }
+  while (head != nullptr) {
+    FreeFlat* next = head->next;
+    DeallocateFlat(head, tag);
+    head = next;
+    ++count;
+  }
+  return count;
+}
+
+// Releases whole size classes of `cache` to the global pool until it holds at
+// most `target` bytes.
+void ReleaseToGlobalPool(ThreadCache* cache, size_t target) {
+  size_t index = cache->next_release;
+  for (size_t i = 0; i < kNumCachedTags && cache->bytes > target; ++i) {
+    FreeFlat* head = cache->heads[index];
+    if (head != nullptr) {
+      cache->heads[index] = nullptr;
+      const size_t count = MoveToGlobalPool(index, head);
+      cache->bytes -= count * TagToAllocatedSize(IndexToTag(index));
+    }
+    index = index + 1 == kNumCachedTags ? 0 : index + 1;
+  }
+  cache->next_release = index;
+}
+
+// Moves up to `kRefillBatch` flats of size class `index` from the global pool
+// to `cache`. Returns whether any were moved.
+bool RefillFromGlobalPool(ThreadCache* cache, size_t index) {
+  if (global_pool_counts[index].load(std::memory_order_relaxed) == 0) {
+    return false;
+  }
+  FreeFlat* batch = nullptr;
+  size_t count = 0;
+  {
+    absl::base_internal::SpinLockHolder lock(&global_pool_mu);
+    FreeFlat* head = global_pool[index];
+    while (head != nullptr && count < kRefillBatch) {
+      FreeFlat* next = head->next;
+      head->next = batch;
+      batch = head;
+      head = next;
+      ++count;
+    }
+    global_pool[index] = head;
+    global_pool_bytes -= count * TagToAllocatedSize(IndexToTag(index));
+    global_pool_counts[index].store(
+        global_pool_counts[index].load(std::memory_order_relaxed) - count,
+        std::memory_order_relaxed);
+  }
+  if (batch == nullptr) return false;
+  cache->heads[index] = batch;
+  cache->bytes += count * TagToAllocatedSize(IndexToTag(index));
+  return true;
+}
+
+struct ThreadCacheReclaimer {
+  ~ThreadCacheReclaimer() {
+    ReleaseToGlobalPool(&thread_cache, 0);
+    // Flats freed by later thread-local destructors bypass the cache.
+    thread_cache.state = ThreadCacheState::kDestroyed;
+  }
+};
+
+// Returns the current thread's cache, or nullptr if the thread is exiting.
+inline ThreadCache* GetThreadCache() {
+  ThreadCache* cache = &thread_cache;
+  if (ABSL_PREDICT_TRUE(cache->state == ThreadCacheState::kActive)) {
+    return cache;
+  }
+  if (cache->state == ThreadCacheState::kDestroyed) return nullptr;
+  // Constructing the reclaimer registers its destructor for thread exit.
+  static thread_local ThreadCacheReclaimer reclaimer;
+  static_cast<void>(reclaimer);
+  cache->state = ThreadCacheState::kActive;
+  return cache;
+}
+
+}  // namespace
+
+void enable_flat_cache(bool enable) {
+#if defined(ABSL_HAVE_ADDRESS_SANITIZER) || \
+    defined(ABSL_HAVE_MEMORY_SANITIZER) ||  \
+    defined(ABSL_HAVE_HWADDRESS_SANITIZER)
+  // Recycling flats would hide use-after-free bugs from the sanitizer.
+  enable = false;
+#endif
+  flat_cache_enabled.store(enable, std::memory_order_relaxed);
+}
+
+void* TakeCachedFlat(uint8_t tag) {
+  if (tag > kMaxCachedTag) return nullptr;
+  ThreadCache* cache = GetThreadCache();
+  if (ABSL_PREDICT_FALSE(cache == nullptr)) return nullptr;
+  const size_t index = tag - FLAT;
+  FreeFlat* flat = cache->heads[index];
+  if (flat == nullptr) {
+    if (!RefillFromGlobalPool(cache, index)) return nullptr;
+    flat = cache->heads[index];
+  }
+  cache->heads[index] = flat->next;
+  cache->bytes -= TagToAllocatedSize(tag);
+  return flat;
+}
+
+bool CacheFlat(void* raw, uint8_t tag) {
+  if (tag > kMaxCachedTag) return false;
+  ThreadCache* cache = GetThreadCache();
+  if (ABSL_PREDICT_FALSE(cache == nullptr)) return false;
+  const size_t size = TagToAllocatedSize(tag);
+  if (ABSL_PREDICT_FALSE(cache->bytes + size > kFlatCacheThreadBudget)) {
+    ReleaseToGlobalPool(cache, kFlatCacheThreadBudget / 2);
+  }
+  const size_t index = tag - FLAT;
+  cache->heads[index] = new (raw) FreeFlat{cache->heads[index]};
+  cache->bytes += size;
+  return true;
+}
+
+void ReleaseThreadFlatCache() {
+  if (thread_cache.state == ThreadCacheState::kActive) {
+    ReleaseToGlobalPool(&thread_cache, 0);
+  }
+}
+
+size_t ThreadFlatCacheBytesForTesting() { return thread_cache.bytes; }
+
+size_t GlobalFlatCacheBytesForTesting() {
+  absl::base_internal::SpinLockHolder lock(&global_pool_mu);
+  return global_pool_bytes;
+}
+
+}  // namespace cord_internal
+ABSL_NAMESPACE_END
+}  // namespace absl
@@ -0,0 +1,79 @@
+// Copyright 2026 The Abseil Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef ABSL_STRINGS_INTERNAL_CORD_REP_FLAT_CACHE_H_
+#define ABSL_STRINGS_INTERNAL_CORD_REP_FLAT_CACHE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "absl/base/config.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+namespace cord_internal {
+
+// Flat cache
+//
+// An opt-in cache of recently freed flat nodes, used to short-circuit the
+// allocator for the small flats that make up most Cords. Each thread keeps a
+// free list per flat tag (i.e. per allocation size class) holding at most
+// `kFlatCacheThreadBudget` bytes. When a thread exceeds its budget, or exits,
+// it moves its cached flats to a global pool with a budget of
+// `kFlatCacheGlobalBudget` bytes, from which other threads refill in batches;
+// flats beyond both budgets are returned to the allocator.
+//
+// Only flats of at most `kMaxFlatSize` bytes are cached. The cache is disabled
+// by default, and always disabled under address and memory sanitizers so that
+// use-after-free bugs on flats remain detectable.
+
+static constexpr size_t kFlatCacheThreadBudget = 256 * 1024;
+static constexpr size_t kFlatCacheGlobalBudget = 8 * 1024 * 1024;
+
+extern std::atomic<bool> flat_cache_enabled;
+
+// Enables or disables the flat cache. Flats cached while the cache was
+// enabled stay cached until their thread exits or calls
+// `ReleaseThreadFlatCache()`.
+void enable_flat_cache(bool enable);
+
+// Returns whether the flat cache is enabled.
+inline bool flat_cache_is_enabled() {
+  return flat_cache_enabled.load(std::memory_order_relaxed);
+}
+
+// Returns the memory of a cached flat allocation for `tag`, or nullptr if
+// none is available. Requires the flat cache to be enabled.
+void* TakeCachedFlat(uint8_t tag);
+
+// Adds the memory of the destroyed flat at `raw`, which was allocated for
+// `tag`, to the cache. Returns false if the cache does not accept it, in which
+// case the caller must deallocate it. Requires the flat cache to be enabled.
+bool CacheFlat(void* raw, uint8_t tag);
+
+// Moves all flats cached by the current thread to the global pool.
+void ReleaseThreadFlatCache();
+
+// Returns the number of bytes cached by the current thread.
+size_t ThreadFlatCacheBytesForTesting();
+
+// Returns the number of bytes held in the global pool.
+size_t GlobalFlatCacheBytesForTesting();
+
+}  // namespace cord_internal
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_STRINGS_INTERNAL_CORD_REP_FLAT_CACHE_H_
@@ -0,0 +1,141 @@
+// Copyright 2026 The Abseil Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/strings/internal/cord_rep_flat_cache.h"
+
+#include <cstddef>
+#include <string>
+#include <thread>  // NOLINT(build/c++11)
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "absl/base/config.h"
+#include "absl/strings/cord.h"
+#include "absl/strings/internal/cord_internal.h"
+#include "absl/strings/internal/cord_rep_flat.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+namespace cord_internal {
+namespace {
+
+class CordRepFlatCacheTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    enable_flat_cache(true);
+    if (!flat_cache_is_enabled()) {
+      GTEST_SKIP() << "The flat cache is disabled under sanitizers";
+    }
+    ReleaseThreadFlatCache();
+  }
+
+  void TearDown() override {
+    enable_flat_cache(false);
+    ReleaseThreadFlatCache();
+  }
+};
+
+TEST_F(CordRepFlatCacheTest, ReusesFreedFlat) {
+  CordRepFlat* flat = CordRepFlat::New(100);
+  const size_t allocated = flat->AllocatedSize();
+  CordRep* raw = flat;
+  CordRepFlat::Delete(flat);
+  EXPECT_EQ(ThreadFlatCacheBytesForTesting(), allocated);
+
+  CordRepFlat* reused = CordRepFlat::New(100);
+  EXPECT_EQ(reused, raw);
+  EXPECT_EQ(reused->AllocatedSize(), allocated);
+  EXPECT_EQ(reused->refcount.Get(), 1);
+  EXPECT_EQ(ThreadFlatCacheBytesForTesting(), 0u);
+
+  // A different size class does not reuse the cached flat.
+  CordRepFlat::Delete(reused);
+  CordRepFlat* other = CordRepFlat::New(1000);
+  EXPECT_NE(other, raw);
+  CordRepFlat::Delete(other);
+}
+
+TEST_F(CordRepFlatCacheTest, LargeFlatsAreNotCached) {
+  CordRepFlat* flat = CordRepFlat::New(CordRepFlat::Large(), 100000);
+  CordRepFlat::Delete(flat);
+  EXPECT_EQ(ThreadFlatCacheBytesForTesting(), 0u);
+}
+
+TEST_F(CordRepFlatCacheTest, ThreadBudgetIsBounded) {
+  std::vector<CordRepFlat*> flats;
+  for (size_t i = 0; i < 4 * kFlatCacheThreadBudget / kMaxFlatSize; ++i) {
+    flats.push_back(CordRepFlat::New(kMaxFlatLength));
+  }
+  for (CordRepFlat* flat : flats) {
+    CordRepFlat::Delete(flat);
+    EXPECT_LE(ThreadFlatCacheBytesForTesting(), kFlatCacheThreadBudget);
+  }
+  EXPECT_GT(GlobalFlatCacheBytesForTesting(), 0u);
+  EXPECT_LE(GlobalFlatCacheBytesForTesting(), kFlatCacheGlobalBudget);
+
+  ReleaseThreadFlatCache();
+  EXPECT_EQ(ThreadFlatCacheBytesForTesting(), 0u);
+}
+
+TEST_F(CordRepFlatCacheTest, ExitingThreadReleasesToGlobalPool) {
+  CordRep* freed = nullptr;
+  std::thread([&freed] {
+    CordRepFlat* flat = CordRepFlat::New(200);
+    freed = flat;
+    CordRepFlat::Delete(flat);
+  }).join();
+
+  // This thread refills from the global pool, which now holds the flat freed
+  // by the other thread.
+  std::vector<CordRepFlat*> flats;
+  bool found = false;
+  for (int i = 0; i < 1000 && !found; ++i) {
+    flats.push_back(CordRepFlat::New(200));
+    found = flats.back() == freed;
+  }
+  EXPECT_TRUE(found);
+  for (CordRepFlat* flat : flats) CordRepFlat::Delete(flat);
+}
+
+TEST_F(CordRepFlatCacheTest, CordsFreedOnOtherThreads) {
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([t] {
+      for (int round = 0; round < 50; ++round) {
+        std::vector<absl::Cord> cords;
+        for (int i = 0; i < 100; ++i) {
+          absl::Cord cord;
+          for (int j = 0; j <= i % 7; ++j) {
+            cord.Append(std::string(static_cast<size_t>(10 + 300 * j), 'a'));
+          }
+          cords.push_back(cord);
+        }
+        std::thread([cords = std::move(cords), t] {
+          for (const absl::Cord& cord : cords) {
+            for (absl::string_view chunk : cord.Chunks()) {
+              ASSERT_EQ(chunk.find_first_not_of('a'), chunk.npos) << t;
+            }
+          }
+        }).join();
+      }
+    });
+  }
+  for (std::thread& thread : threads) thread.join();
+}
+
+}  // namespace
+}  // namespace cord_internal
+ABSL_NAMESPACE_END
+}  // namespace absl
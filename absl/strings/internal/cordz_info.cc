@@ -95,6 +95,8 @@ class CordRepAnalyzer {
 
     switch (repref.tag()) {
       case CordRepKind::BTREE:
+        statistics_.btree_depth =
+            static_cast<size_t>(repref.rep->btree()->height()) + 1;
         AnalyzeBtree(repref);
         break;
       default:
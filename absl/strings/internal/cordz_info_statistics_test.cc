@@ -182,6 +182,7 @@ MATCHER_P(EqStatistics, stats, "Statistics equal expected values") {
   STATS_MATCHER_EXPECT_EQ(node_counts.substring);
   STATS_MATCHER_EXPECT_EQ(node_counts.ring);
   STATS_MATCHER_EXPECT_EQ(node_counts.btree);
+  STATS_MATCHER_EXPECT_EQ(btree_depth);
   STATS_MATCHER_EXPECT_EQ(estimated_memory_usage);
   STATS_MATCHER_EXPECT_EQ(estimated_fair_share_memory_usage);
 
@@ -316,6 +317,7 @@ TEST(CordzInfoStatisticsTest, BtreeLeaf) {
   expected.node_counts.external = 1;
   expected.node_counts.substring = 1;
   expected.node_counts.btree = 1;
+  expected.btree_depth = 1;
 
   EXPECT_THAT(SampleCord(tree), EqStatistics(expected));
 }
@@ -376,6 +378,7 @@ TEST(CordzInfoStatisticsTest, BtreeNodeShared) {
   expected.node_counts.external = leaf_count;
   expected.node_counts.substring = leaf_count;
   expected.node_counts.btree = 1 + leaf_count;
+  expected.btree_depth = 2;
 
   EXPECT_THAT(SampleCord(tree), EqStatistics(expected));
 }
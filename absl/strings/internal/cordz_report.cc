@@ -0,0 +1,320 @@
+// Copyright 2026 The Abseil Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/strings/internal/cordz_report.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "absl/base/config.h"
+#include "absl/debugging/symbolize.h"
+#include "absl/strings/internal/cordz_info.h"
+#include "absl/strings/internal/cordz_sample_token.h"
+#include "absl/strings/internal/cordz_statistics.h"
+#include "absl/strings/internal/cordz_update_tracker.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_format.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+namespace cord_internal {
+
+namespace {
+
+using MethodIdentifier = CordzUpdateTracker::MethodIdentifier;
+
+using EntryKey = std::tuple<MethodIdentifier, MethodIdentifier,
+                            std::vector<void*>>;
+
+void AddEntry(const CordzReportEntry& src, CordzReportEntry& dst) {
+  dst.sampled_cords += src.sampled_cords;
+  dst.cords += src.cords;
+  dst.size += src.size;
+  dst.memory_usage += src.memory_usage;
+  dst.fair_share_memory_usage += src.fair_share_memory_usage;
+  dst.chunks += src.chunks;
+  dst.flats += src.flats;
+  dst.tiny_flats += src.tiny_flats;
+  dst.substrings += src.substrings;
+  dst.btree_nodes += src.btree_nodes;
+  dst.total_btree_depth += src.total_btree_depth;
+  dst.max_btree_depth = std::max(dst.max_btree_depth, src.max_btree_depth);
+  dst.updates.LossyAdd(src.updates);
+}
+
+// Protocol buffer wire format encoding.
+
+enum WireType { kVarint = 0, kLengthDelimited = 2 };
+
+void EncodeVarint(uint64_t value, std::string* out) {
+  while (value >= 0x80) {
+    out->push_back(static_cast<char>((value & 0x7f) | 0x80));
+    value >>= 7;
+  }
+  out->push_back(static_cast<char>(value));
+}
+
+void EncodeTag(int field, WireType type, std::string* out) {
+  EncodeVarint((static_cast<uint64_t>(field) << 3) | type, out);
+}
+
+void EncodeInt64(int field, int64_t value, std::string* out) {
+  if (value == 0) return;
+  EncodeTag(field, kVarint, out);
+  EncodeVarint(static_cast<uint64_t>(value), out);
+}
+
+void EncodeBytes(int field, absl::string_view value, std::string* out) {
+  if (value.empty()) return;
+  EncodeTag(field, kLengthDelimited, out);
+  EncodeVarint(value.size(), out);
+  out->append(value.data(), value.size());
+}
+
+std::string EncodeEntry(const CordzReportEntry& entry) {
+  std::string out;
+  EncodeBytes(1, CordzMethodName(entry.method), &out);
+  EncodeBytes(2, CordzMethodName(entry.parent_method), &out);
+  if (!entry.stack.empty()) {
+    std::string packed;
+    for (void* pc : entry.stack) {
+      EncodeVarint(reinterpret_cast<uintptr_t>(pc), &packed);
+    }
+    EncodeBytes(3, packed, &out);
+  }
+  EncodeInt64(4, entry.sampled_cords, &out);
+  EncodeInt64(5, entry.cords, &out);
+  EncodeInt64(6, entry.size, &out);
+  EncodeInt64(7, entry.memory_usage, &out);
+  EncodeInt64(8, entry.fair_share_memory_usage, &out);
+  EncodeInt64(9, entry.chunks, &out);
+  EncodeInt64(10, entry.flats, &out);
+  EncodeInt64(11, entry.tiny_flats, &out);
+  EncodeInt64(12, entry.substrings, &out);
+  EncodeInt64(13, entry.btree_nodes, &out);
+  EncodeInt64(14, entry.total_btree_depth, &out);
+  EncodeInt64(15, entry.max_btree_depth, &out);
+  for (int i = 0; i < CordzUpdateTracker::kNumMethods; ++i) {
+    const auto method = static_cast<MethodIdentifier>(i);
+    if (const int64_t count = entry.updates.Value(method)) {
+      std::string method_count;
+      EncodeBytes(1, CordzMethodName(method), &method_count);
+      EncodeInt64(2, count, &method_count);
+      EncodeBytes(16, method_count, &out);
+    }
+  }
+  return out;
+}
+
+void AppendEntryText(const CordzReportEntry& entry, std::string* out) {
+  absl::StrAppendFormat(
+      out,
+      "  cords: %d sampled, ~%d total; size: %d; memory: %d (fair share %d)\n"
+      "  avg chunk: %.1f; tiny flats: %.1f%%; substrings: %d; "
+      "btree depth: avg %.2f, max %d; shared: %.1f%%\n",
+      entry.sampled_cords, entry.cords, entry.size, entry.memory_usage,
+      entry.fair_share_memory_usage, entry.AverageChunkSize(),
+      100 * entry.TinyFlatRatio(), entry.substrings,
+      entry.AverageBtreeDepth(), entry.max_btree_depth,
+      100 * entry.SharingRatio());
+  std::string updates;
+  for (int i = 0; i < CordzUpdateTracker::kNumMethods; ++i) {
+    const auto method = static_cast<MethodIdentifier>(i);
+    if (const int64_t count = entry.updates.Value(method)) {
+      absl::StrAppend(&updates, " ", CordzMethodName(method), "=", count);
+    }
+  }
+  if (!updates.empty()) absl::StrAppend(out, "  updates:", updates, "\n");
+  for (void* pc : entry.stack) {
+    char symbol[256];
+    if (absl::Symbolize(pc, symbol, sizeof(symbol))) {
+      absl::StrAppendFormat(out, "    @ %p  %s\n", pc, symbol);
+    } else {
+      absl::StrAppendFormat(out, "    @ %p\n", pc);
+    }
+  }
+}
+
+}  // namespace
+
+absl::string_view CordzMethodName(MethodIdentifier method) {
+  switch (method) {
+    case MethodIdentifier::kUnknown:
+      return "Unknown";
+    case MethodIdentifier::kAppendCord:
+      return "AppendCord";
+    case MethodIdentifier::kAppendCordBuffer:
+      return "AppendCordBuffer";
+    case MethodIdentifier::kAppendExternalMemory:
+      return "AppendExternalMemory";
+    case MethodIdentifier::kAppendString:
+      return "AppendString";
+    case MethodIdentifier::kAssignCord:
+      return "AssignCord";
+    case MethodIdentifier::kAssignString:
+      return "AssignString";
+    case MethodIdentifier::kClear:
+      return "Clear";
+    case MethodIdentifier::kCompact:
+      return "Compact";
+    case MethodIdentifier::kConstructorCord:
+      return "ConstructorCord";
+    case MethodIdentifier::kConstructorString:
+      return "ConstructorString";
+    case MethodIdentifier::kCordReader:
+      return "CordReader";
+    case MethodIdentifier::kFlatten:
+      return "Flatten";
+    case MethodIdentifier::kGetAppendBuffer:
+      return "GetAppendBuffer";
+    case MethodIdentifier::kGetAppendRegion:
+      return "GetAppendRegion";
+    case MethodIdentifier::kMakeCordFromExternal:
+      return "MakeCordFromExternal";
+    case MethodIdentifier::kMoveAppendCord:
+      return "MoveAppendCord";
+    case MethodIdentifier::kMoveAssignCord:
+      return "MoveAssignCord";
+    case MethodIdentifier::kMovePrependCord:
+      return "MovePrependCord";
+    case MethodIdentifier::kPrependCord:
+      return "PrependCord";
+    case MethodIdentifier::kPrependCordBuffer:
+      return "PrependCordBuffer";
+    case MethodIdentifier::kPrependString:
+      return "PrependString";
+    case MethodIdentifier::kRemovePrefix:
+      return "RemovePrefix";
+    case MethodIdentifier::kRemoveSuffix:
+      return "RemoveSuffix";
+    case MethodIdentifier::kSetExpectedChecksum:
+      return "SetExpectedChecksum";
+    case MethodIdentifier::kSubCord:
+      return "SubCord";
+    case MethodIdentifier::kNumMethods:
+      break;
+  }
+  return "Invalid";
+}
+
+void AddToCordzReportEntry(const CordzStatistics& stats,
+                           int64_t sampling_stride, CordzReportEntry& entry) {
+  const int64_t weight = std::max<int64_t>(sampling_stride, 1);
+  auto weighted = [weight](size_t value) {
+    return static_cast<int64_t>(value) * weight;
+  };
+  entry.sampled_cords += 1;
+  entry.cords += weight;
+  entry.size += weighted(stats.size);
+  entry.memory_usage += weighted(stats.estimated_memory_usage);
+  entry.fair_share_memory_usage +=
+      weighted(stats.estimated_fair_share_memory_usage);
+  entry.chunks +=
+      weighted(stats.node_counts.flat + stats.node_counts.external);
+  entry.flats += weighted(stats.node_counts.flat);
+  entry.tiny_flats +=
+      weighted(stats.node_counts.flat_64 + stats.node_counts.flat_128);
+  entry.substrings += weighted(stats.node_counts.substring);
+  entry.btree_nodes += weighted(stats.node_counts.btree);
+  entry.total_btree_depth += weighted(stats.btree_depth);
+  entry.max_btree_depth = std::max(entry.max_btree_depth,
+                                   static_cast<int64_t>(stats.btree_depth));
+  for (int i = 0; i < CordzUpdateTracker::kNumMethods; ++i) {
+    const auto method = static_cast<MethodIdentifier>(i);
+    if (const int64_t count = stats.update_tracker.Value(method)) {
+      entry.updates.LossyAdd(method, count * weight);
+    }
+  }
+}
+
+CordzReport CollectCordzReport(const CordzReportOptions& options) {
+  std::map<EntryKey, CordzReportEntry> entries;
+  {
+    CordzSampleToken token;
+    for (const CordzInfo& info : token) {
+      const CordzStatistics stats = info.GetCordzStatistics();
+      std::vector<void*> stack;
+      if (options.group_by_stack) {
+        absl::Span<void* const> frames = info.GetStack();
+        frames = frames.subspan(0, options.max_stack_depth);
+        stack.assign(frames.begin(), frames.end());
+      }
+      EntryKey key(stats.method, stats.parent_method, std::move(stack));
+      auto it = entries.find(key);
+      if (it == entries.end()) {
+        CordzReportEntry entry;
+        entry.method = stats.method;
+        entry.parent_method = stats.parent_method;
+        entry.stack = std::get<2>(key);
+        it = entries.emplace(std::move(key), std::move(entry)).first;
+      }
+      AddToCordzReportEntry(stats, info.sampling_stride(), it->second);
+    }
+  }
+
+  CordzReport report;
+  report.entries.reserve(entries.size());
+  for (auto& key_and_entry : entries) {
+    AddEntry(key_and_entry.second, report.total);
+    report.entries.push_back(std::move(key_and_entry.second));
+  }
+  std::stable_sort(report.entries.begin(), report.entries.end(),
+                   [](const CordzReportEntry& a, const CordzReportEntry& b) {
+                     return a.fair_share_memory_usage >
+                            b.fair_share_memory_usage;
+                   });
+  if (options.max_entries > 0 && report.entries.size() > options.max_entries) {
+    report.entries.erase(report.entries.begin() +
+                             static_cast<ptrdiff_t>(options.max_entries),
+                         report.entries.end());
+  }
+  return report;
+}
+
+std::string CordzReportToText(const CordzReport& report) {
+  std::string out = "Cordz report\n\nTotal:\n";
+  AppendEntryText(report.total, &out);
+  for (size_t i = 0; i < report.entries.size(); ++i) {
+    const CordzReportEntry& entry = report.entries[i];
+    absl::StrAppend(&out, "\n#", i + 1, " ", CordzMethodName(entry.method));
+    if (entry.parent_method != MethodIdentifier::kUnknown) {
+      absl::StrAppend(&out, " (parent ", CordzMethodName(entry.parent_method),
+                      ")");
+    }
+    out.append(":\n");
+    AppendEntryText(entry, &out);
+  }
+  return out;
+}
+
+std::string CordzReportToProto(const CordzReport& report) {
+  std::string out;
+  for (const CordzReportEntry& entry : report.entries) {
+    EncodeBytes(1, EncodeEntry(entry), &out);
+  }
+  EncodeBytes(2, EncodeEntry(report.total), &out);
+  return out;
+}
+
+}  // namespace cord_internal
+ABSL_NAMESPACE_END
+}  // namespace absl
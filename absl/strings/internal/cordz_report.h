@@ -0,0 +1,183 @@
+// Copyright 2026 The Abseil Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef ABSL_STRINGS_INTERNAL_CORDZ_REPORT_H_
+#define ABSL_STRINGS_INTERNAL_CORDZ_REPORT_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "absl/base/config.h"
+#include "absl/strings/internal/cordz_statistics.h"
+#include "absl/strings/internal/cordz_update_tracker.h"
+#include "absl/strings/string_view.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+namespace cord_internal {
+
+// Cordz report
+//
+// A `CordzReport` aggregates the statistics of all currently sampled cords by
+// the method that sampled them and, optionally, the stack at which they were
+// sampled. Each entry tells how much memory a call site holds in cords, how
+// fragmented those cords are and how much of their memory is shared, which
+// points at places where flattening cords or appending in larger pieces pays
+// off.
+//
+// Counts in an entry are sums over the sampled cords of the entry, each
+// weighted by its sampling stride, so that they estimate the totals over all
+// cords of the call site. Reports can be rendered as text with
+// `CordzReportToText()`, or encoded with `CordzReportToProto()` in the protocol
+// buffer wire format of the messages described there.
+
+// Returns the name of `method`, e.g. "AppendString".
+absl::string_view CordzMethodName(CordzUpdateTracker::MethodIdentifier method);
+
+struct CordzReportEntry {
+  using MethodIdentifier = CordzUpdateTracker::MethodIdentifier;
+
+  MethodIdentifier method = MethodIdentifier::kUnknown;
+  MethodIdentifier parent_method = MethodIdentifier::kUnknown;
+
+  // The stack at which the cords were sampled. Empty unless the report is
+  // grouped by stack.
+  std::vector<void*> stack;
+
+  // The number of sampled cords.
+  int64_t sampled_cords = 0;
+
+  // The estimated number of cords, i.e. the sum of the sampling strides.
+  int64_t cords = 0;
+
+  // The following are estimated totals over all cords.
+  int64_t size = 0;
+  int64_t memory_usage = 0;
+  int64_t fair_share_memory_usage = 0;
+  // Data nodes, i.e. flats and externals.
+  int64_t chunks = 0;
+  int64_t flats = 0;
+  // Flats with an allocated size of at most `kCordzTinyFlatSize` bytes.
+  int64_t tiny_flats = 0;
+  int64_t substrings = 0;
+  int64_t btree_nodes = 0;
+  // The sum of the btree depths, and the maximum depth of any sampled cord.
+  int64_t total_btree_depth = 0;
+  int64_t max_btree_depth = 0;
+
+  // The estimated number of calls per mutating method.
+  CordzUpdateTracker updates;
+
+  // Returns the average number of bytes per data node.
+  double AverageChunkSize() const {
+    return chunks > 0 ? static_cast<double>(size) / chunks : 0;
+  }
+
+  // Returns the average btree depth.
+  double AverageBtreeDepth() const {
+    return cords > 0 ? static_cast<double>(total_btree_depth) / cords : 0;
+  }
+
+  // Returns the fraction of flats that are tiny.
+  double TinyFlatRatio() const {
+    return flats > 0 ? static_cast<double>(tiny_flats) / flats : 0;
+  }
+
+  // Returns the fraction of the memory used by the cords that is shared with
+  // other cords: 0 if nothing is shared, approaching 1 if the cords mostly
+  // reference nodes that are also referenced elsewhere.
+  double SharingRatio() const {
+    return memory_usage > 0 ? 1 - static_cast<double>(fair_share_memory_usage) /
+                                      memory_usage
+                            : 0;
+  }
+};
+
+// The allocated size up to which a flat counts as tiny.
+static constexpr size_t kCordzTinyFlatSize = 128;
+
+struct CordzReport {
+  // The entries, in decreasing order of fair share memory usage.
+  std::vector<CordzReportEntry> entries;
+
+  // The sum of all entries.
+  CordzReportEntry total;
+};
+
+struct CordzReportOptions {
+  // Whether to group cords by the stack at which they were sampled, in
+  // addition to the sampling methods.
+  bool group_by_stack = true;
+
+  // The maximum number of frames of the stack used for grouping.
+  size_t max_stack_depth = 64;
+
+  // The maximum number of entries to report, or 0 for all. The total
+  // includes omitted entries.
+  size_t max_entries = 0;
+};
+
+// Collects a report over all currently sampled cords.
+CordzReport CollectCordzReport(const CordzReportOptions& options = {});
+
+// Adds the statistics of a cord sampled with `sampling_stride` to `entry`.
+void AddToCordzReportEntry(const CordzStatistics& stats,
+                           int64_t sampling_stride, CordzReportEntry& entry);
+
+// Renders `report` as human readable text. Stack frames are symbolized where
+// possible.
+std::string CordzReportToText(const CordzReport& report);
+
+// Encodes `report` as a serialized `CordzReport` message of the following
+// schema:
+//
+//   message CordzReport {
+//     repeated Entry entry = 1;
+//     Entry total = 2;
+//   }
+//
+//   message Entry {
+//     string method = 1;
+//     string parent_method = 2;
+//     repeated uint64 stack = 3 [packed = true];
+//     int64 sampled_cords = 4;
+//     int64 cords = 5;
+//     int64 size = 6;
+//     int64 memory_usage = 7;
+//     int64 fair_share_memory_usage = 8;
+//     int64 chunks = 9;
+//     int64 flats = 10;
+//     int64 tiny_flats = 11;
+//     int64 substrings = 12;
+//     int64 btree_nodes = 13;
+//     int64 total_btree_depth = 14;
+//     int64 max_btree_depth = 15;
+//     repeated MethodCount updates = 16;
+//   }
+//
+//   message MethodCount {
+//     string method = 1;
+//     int64 count = 2;
+//   }
+//
+// Fields with default values are omitted.
+std::string CordzReportToProto(const CordzReport& report);
+
+}  // namespace cord_internal
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_STRINGS_INTERNAL_CORDZ_REPORT_H_
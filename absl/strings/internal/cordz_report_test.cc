@@ -0,0 +1,201 @@
+// Copyright 2026 The Abseil Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/strings/internal/cordz_report.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <utility>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "absl/base/config.h"
+#include "absl/strings/cord.h"
+#include "absl/strings/cord_buffer.h"
+#include "absl/strings/cordz_test_helpers.h"
+#include "absl/strings/internal/cordz_statistics.h"
+#include "absl/strings/internal/cordz_update_tracker.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+namespace cord_internal {
+namespace {
+
+using ::testing::DoubleEq;
+using ::testing::HasSubstr;
+using Method = CordzUpdateTracker::MethodIdentifier;
+
+TEST(CordzReportTest, MethodNames) {
+  EXPECT_EQ(CordzMethodName(Method::kUnknown), "Unknown");
+  EXPECT_EQ(CordzMethodName(Method::kAppendString), "AppendString");
+  EXPECT_EQ(CordzMethodName(Method::kSubCord), "SubCord");
+  for (int i = 0; i < CordzUpdateTracker::kNumMethods; ++i) {
+    EXPECT_NE(CordzMethodName(static_cast<Method>(i)), "Invalid") << i;
+  }
+}
+
+TEST(CordzReportTest, AddToEntryWeightsByStride) {
+  CordzStatistics stats;
+  stats.size = 1000;
+  stats.estimated_memory_usage = 1200;
+  stats.estimated_fair_share_memory_usage = 900;
+  stats.node_counts.flat = 8;
+  stats.node_counts.flat_64 = 2;
+  stats.node_counts.flat_128 = 2;
+  stats.node_counts.external = 2;
+  stats.node_counts.btree = 3;
+  stats.btree_depth = 2;
+  stats.update_tracker.LossyAdd(Method::kAppendString, 5);
+
+  CordzReportEntry entry;
+  AddToCordzReportEntry(stats, 10, entry);
+  AddToCordzReportEntry(stats, 10, entry);
+  EXPECT_EQ(entry.sampled_cords, 2);
+  EXPECT_EQ(entry.cords, 20);
+  EXPECT_EQ(entry.size, 20000);
+  EXPECT_EQ(entry.chunks, 200);
+  EXPECT_EQ(entry.tiny_flats, 80);
+  EXPECT_EQ(entry.btree_nodes, 60);
+  EXPECT_EQ(entry.max_btree_depth, 2);
+  EXPECT_EQ(entry.updates.Value(Method::kAppendString), 100);
+  EXPECT_THAT(entry.AverageChunkSize(), DoubleEq(100));
+  EXPECT_THAT(entry.TinyFlatRatio(), DoubleEq(0.5));
+  EXPECT_THAT(entry.AverageBtreeDepth(), DoubleEq(2));
+  EXPECT_THAT(entry.SharingRatio(), DoubleEq(0.25));
+}
+
+TEST(CordzReportTest, ProtoEncoding) {
+  CordzReport report;
+  CordzReportEntry entry;
+  entry.method = Method::kAppendString;
+  entry.stack = {reinterpret_cast<void*>(0x81)};
+  entry.sampled_cords = 1;
+  entry.size = 300;
+  report.entries.push_back(entry);
+  report.total = entry;
+  report.total.method = Method::kUnknown;
+  report.total.stack.clear();
+
+  const std::string entry_bytes =
+      std::string("\x0a\x0c"
+                  "AppendString"
+                  "\x12\x07"
+                  "Unknown"
+                  "\x1a\x02\x81\x01"
+                  "\x20\x01"
+                  "\x30\xac\x02",
+                  32);
+  const std::string total_bytes =
+      std::string("\x0a\x07"
+                  "Unknown"
+                  "\x12\x07"
+                  "Unknown"
+                  "\x20\x01"
+                  "\x30\xac\x02",
+                  23);
+  EXPECT_EQ(CordzReportToProto(report),
+            absl::StrCat("\x0a", std::string(1, static_cast<char>(32)),
+                         entry_bytes, "\x12",
+                         std::string(1, static_cast<char>(23)), total_bytes));
+}
+
+#ifdef ABSL_INTERNAL_CORDZ_ENABLED
+
+// Returns a cord of `n` flats of 100 bytes each.
+absl::Cord FragmentedCord(size_t n) {
+  absl::Cord cord;
+  for (size_t i = 0; i < n; ++i) {
+    absl::CordBuffer buffer = absl::CordBuffer::CreateWithDefaultLimit(100);
+    std::memset(buffer.data(), 'x', 100);
+    buffer.SetLength(100);
+    cord.Append(std::move(buffer));
+  }
+  return cord;
+}
+
+const CordzReportEntry* FindEntry(const CordzReport& report, Method method) {
+  for (const CordzReportEntry& entry : report.entries) {
+    if (entry.method == method) return &entry;
+  }
+  return nullptr;
+}
+
+TEST(CordzReportTest, CollectsSampledCords) {
+  CordzSamplingIntervalHelper sample_all(1);
+  const absl::Cord fragmented = FragmentedCord(100);
+  const absl::Cord big(std::string(100000, 'y'));
+  const absl::Cord copy = big;
+
+  CordzReportOptions options;
+  options.group_by_stack = false;
+  const CordzReport report = CollectCordzReport(options);
+
+  const CordzReportEntry* entry = FindEntry(report, Method::kAppendCordBuffer);
+  ASSERT_NE(entry, nullptr);
+  EXPECT_EQ(entry->sampled_cords, 1);
+  EXPECT_EQ(entry->size, 10000);
+  EXPECT_EQ(entry->flats, 100);
+  EXPECT_THAT(entry->TinyFlatRatio(), DoubleEq(1));
+  EXPECT_THAT(entry->AverageChunkSize(), DoubleEq(100));
+  EXPECT_GE(entry->max_btree_depth, 2);
+  EXPECT_THAT(entry->SharingRatio(), DoubleEq(0));
+  EXPECT_EQ(entry->updates.Value(Method::kAppendCordBuffer), 100);
+
+  // `big` and `copy` share all of their memory.
+  const CordzReportEntry* original =
+      FindEntry(report, Method::kConstructorString);
+  ASSERT_NE(original, nullptr);
+  EXPECT_EQ(original->size, 100000);
+  EXPECT_GT(original->AverageChunkSize(), 1000);
+  EXPECT_NEAR(original->SharingRatio(), 0.5, 0.01);
+  const CordzReportEntry* copied = FindEntry(report, Method::kConstructorCord);
+  ASSERT_NE(copied, nullptr);
+  EXPECT_EQ(copied->parent_method, Method::kConstructorString);
+  EXPECT_NEAR(copied->SharingRatio(), 0.5, 0.01);
+
+  EXPECT_GE(report.total.sampled_cords, 3);
+  EXPECT_GE(report.total.size, 210000);
+
+  const std::string text = CordzReportToText(report);
+  EXPECT_THAT(text, HasSubstr("AppendCordBuffer"));
+  EXPECT_THAT(text, HasSubstr("ConstructorCord (parent ConstructorString)"));
+}
+
+TEST(CordzReportTest, GroupsByStack) {
+  CordzSamplingIntervalHelper sample_all(1);
+  absl::Cord cords[4];
+  for (absl::Cord& cord : cords) cord = FragmentedCord(10);
+
+  CordzReportOptions options;
+  options.max_stack_depth = 4;
+  const CordzReport report = CollectCordzReport(options);
+  const CordzReportEntry* entry = FindEntry(report, Method::kAppendCordBuffer);
+  ASSERT_NE(entry, nullptr);
+  EXPECT_EQ(entry->sampled_cords, 4);
+  EXPECT_LE(entry->stack.size(), 4u);
+
+  options.max_entries = 1;
+  EXPECT_EQ(CollectCordzReport(options).entries.size(), 1u);
+}
+
+#endif  // ABSL_INTERNAL_CORDZ_ENABLED
+
+}  // namespace
+}  // namespace cord_internal
+ABSL_NAMESPACE_END
+}  // namespace absl
@@ -71,6 +71,9 @@ struct CordzStatistics {
   // Detailed node counts per type
   NodeCounts node_counts;
 
+  // The number of levels of btree nodes, or 0 if the cord is not a btree.
+  size_t btree_depth = 0;
+
   // The cord method responsible for sampling the cord.
   MethodIdentifier method = MethodIdentifier::kUnknown;
 
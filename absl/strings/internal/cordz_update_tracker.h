@@ -46,6 +46,7 @@ class CordzUpdateTracker {
     kAssignCord,
     kAssignString,
     kClear,
+    kCompact,
     kConstructorCord,
     kConstructorString,
     kCordReader,
@@ -44,6 +44,7 @@ Methods AllMethods() {
                  Method::kAssignCord,
                  Method::kAssignString,
                  Method::kClear,
+                 Method::kCompact,
                  Method::kConstructorCord,
                  Method::kConstructorString,
                  Method::kCordReader,
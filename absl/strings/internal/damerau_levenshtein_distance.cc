@@ -16,12 +16,88 @@
 
 #include <algorithm>
 #include <array>
+#include <cstddef>
+#include <cstdint>
 #include <numeric>
+#include <vector>
 
 #include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+
 namespace absl {
 ABSL_NAMESPACE_BEGIN
 namespace strings_internal {
+namespace {
+
+// The longest strings that `CappedDamerauLevenshteinDistance` compares.
+constexpr size_t kMaxSize = 100;
+
+// Computes the distance between the query `s1`, of `m` characters with
+// `0 < m <= 64` and per-character masks `masks`, and `s2`, using Hyyrö's
+// extension of Myers' bit-vector algorithm to adjacent transpositions. Column
+// `j` of the dynamic programming matrix is encoded by the vertical deltas
+// between its cells: bit `i` of `vp` (`vn`) is set if cell `i + 1` is one more
+// (less) than cell `i`. Only the last cell, the distance between `s1` and the
+// prefix of `s2` seen so far, is tracked explicitly.
+//
+// Requires `cutoff < 255`, and returns `cutoff + 1` if the distance exceeds
+// `cutoff`.
+uint8_t BitParallelDistance(const std::array<uint64_t, 256>& masks, size_t m,
+                            absl::string_view s2, uint8_t cutoff) {
+  const uint64_t last = uint64_t{1} << (m - 1);
+  uint64_t vp = ~uint64_t{0} >> (64 - m);
+  uint64_t vn = 0;
+  uint64_t d0 = 0;
+  uint64_t prev_mask = 0;
+  size_t distance = m;
+  // The distance changes by at most one per remaining character of `s2`.
+  size_t remaining = s2.size();
+  for (const char c : s2) {
+    const uint64_t mask = masks[static_cast<unsigned char>(c)];
+    // Diagonal zero deltas: matches, transpositions, and cells reached
+    // through a run of matches from a vertical negative delta.
+    const uint64_t transpositions = ((~d0 & mask) << 1) & prev_mask;
+    d0 = (((mask & vp) + vp) ^ vp) | mask | vn | transpositions;
+    const uint64_t hp = vn | ~(d0 | vp);
+    const uint64_t hn = vp & d0;
+    if (hp & last) ++distance;
+    if (hn & last) --distance;
+    --remaining;
+    if (distance > cutoff + remaining) return static_cast<uint8_t>(cutoff + 1);
+    const uint64_t x = (hp << 1) | 1;
+    vp = (hn << 1) | ~(d0 | x);
+    vn = d0 & x;
+    prev_mask = mask;
+  }
+  return static_cast<uint8_t>(distance);
+}
+
+using Histogram = DamerauLevenshteinDictionary::Histogram;
+
+// Counts the characters of `s` by their low bits. Only used for strings of at
+// most `kMaxSize` characters, so the counts cannot overflow.
+Histogram MakeHistogram(absl::string_view s) {
+  Histogram histogram = {};
+  for (const char c : s) {
+    ++histogram[static_cast<unsigned char>(c) %
+                DamerauLevenshteinDictionary::kHistogramBuckets];
+  }
+  return histogram;
+}
+
+// Returns a lower bound on the distance between strings with histograms `a`
+// and `b`: a substitution changes two counts by one, an insertion or deletion
+// one count, and a transposition none.
+size_t HistogramDistance(const Histogram& a, const Histogram& b) {
+  size_t l1 = 0;
+  for (size_t i = 0; i < a.size(); ++i) {
+    l1 += static_cast<size_t>(a[i] > b[i] ? a[i] - b[i] : b[i] - a[i]);
+  }
+  return (l1 + 1) / 2;
+}
+
+}  // namespace
+
 // Calculate DamerauLevenshtein (adjacent transpositions) distance
 // between two strings,
 // https://en.wikipedia.org/wiki/Damerau%E2%80%93Levenshtein_distance. The
@@ -44,6 +120,18 @@ uint8_t CappedDamerauLevenshteinDistance(absl::string_view s1,
   if (s1.empty())
     return static_cast<uint8_t>(s2.size());
 
+  if (s1.size() <= 64) {
+    // Only the masks of the characters of `s1` and `s2` are read, and clearing
+    // just those is cheaper than clearing the whole table for short strings.
+    std::array<uint64_t, 256> masks;
+    for (const char c : s1) masks[static_cast<unsigned char>(c)] = 0;
+    for (const char c : s2) masks[static_cast<unsigned char>(c)] = 0;
+    for (size_t i = 0; i < s1.size(); ++i) {
+      masks[static_cast<unsigned char>(s1[i])] |= uint64_t{1} << i;
+    }
+    return BitParallelDistance(masks, s1.size(), s2, _cutoff);
+  }
+
   // Lower diagonal bound: y = x - lower_diag
   const uint8_t lower_diag =
       _cutoff - static_cast<uint8_t>(s2.size() - s1.size());
@@ -87,6 +175,79 @@ uint8_t CappedDamerauLevenshteinDistance(absl::string_view s1,
   return d[s1.size()][s2.size()];
 }
 
+DamerauLevenshteinMatcher::DamerauLevenshteinMatcher(absl::string_view query)
+    : query_(query), masks_() {
+  if (query.size() > 64) return;
+  for (size_t i = 0; i < query.size(); ++i) {
+    masks_[static_cast<unsigned char>(query[i])] |= uint64_t{1} << i;
+  }
+}
+
+uint8_t DamerauLevenshteinMatcher::Distance(absl::string_view s,
+                                            uint8_t cutoff) const {
+  if (query_.size() > 64) {
+    return CappedDamerauLevenshteinDistance(query_, s, cutoff);
+  }
+  const uint8_t capped =
+      static_cast<uint8_t>(std::min(kMaxSize, size_t{cutoff}));
+  const size_t length_difference = query_.size() > s.size()
+                                       ? query_.size() - s.size()
+                                       : s.size() - query_.size();
+  if (length_difference > capped || s.size() > kMaxSize) {
+    return static_cast<uint8_t>(capped + 1);
+  }
+  if (query_.empty()) return static_cast<uint8_t>(s.size());
+  return BitParallelDistance(masks_, query_.size(), s, capped);
+}
+
+std::vector<size_t> FindWithinDamerauLevenshteinDistance(
+    absl::string_view query, absl::Span<const absl::string_view> candidates,
+    uint8_t cutoff) {
+  const DamerauLevenshteinMatcher matcher(query);
+  const size_t capped = std::min(kMaxSize, size_t{cutoff});
+  std::vector<size_t> matches;
+  for (size_t i = 0; i < candidates.size(); ++i) {
+    if (matcher.Distance(candidates[i], cutoff) <= capped) matches.push_back(i);
+  }
+  return matches;
+}
+
+DamerauLevenshteinDictionary::DamerauLevenshteinDictionary(
+    absl::Span<const absl::string_view> words) {
+  entries_.reserve(words.size());
+  for (size_t i = 0; i < words.size(); ++i) {
+    // Words longer than `kMaxSize` are never within any distance.
+    if (words[i].size() > kMaxSize) continue;
+    entries_.push_back({MakeHistogram(words[i]), words[i], i});
+  }
+  std::stable_sort(entries_.begin(), entries_.end(),
+                   [](const Entry& a, const Entry& b) {
+                     return a.word.size() < b.word.size();
+                   });
+}
+
+std::vector<size_t> DamerauLevenshteinDictionary::FindWithin(
+    absl::string_view query, uint8_t cutoff) const {
+  std::vector<size_t> matches;
+  if (query.size() > kMaxSize) return matches;
+  const size_t capped = std::min(kMaxSize, size_t{cutoff});
+  const size_t min_size = query.size() > capped ? query.size() - capped : 0;
+  const size_t max_size = query.size() + capped;
+  const DamerauLevenshteinMatcher matcher(query);
+  const Histogram histogram = MakeHistogram(query);
+  auto it = std::lower_bound(
+      entries_.begin(), entries_.end(), min_size,
+      [](const Entry& e, size_t size) { return e.word.size() < size; });
+  for (; it != entries_.end() && it->word.size() <= max_size; ++it) {
+    if (HistogramDistance(histogram, it->histogram) > capped) continue;
+    if (matcher.Distance(it->word, cutoff) <= capped) {
+      matches.push_back(it->index);
+    }
+  }
+  std::sort(matches.begin(), matches.end());
+  return matches;
+}
+
 }  // namespace strings_internal
 
 ABSL_NAMESPACE_END
@@ -15,9 +15,13 @@
 #ifndef ABSL_STRINGS_INTERNAL_DAMERAU_LEVENSHTEIN_DISTANCE_H_
 #define ABSL_STRINGS_INTERNAL_DAMERAU_LEVENSHTEIN_DISTANCE_H_
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
+#include <vector>
 
 #include "absl/strings/string_view.h"
+#include "absl/types/span.h"
 
 namespace absl {
 ABSL_NAMESPACE_BEGIN
@@ -27,6 +31,70 @@ namespace strings_internal {
 uint8_t CappedDamerauLevenshteinDistance(absl::string_view s1,
                                          absl::string_view s2, uint8_t cutoff);
 
+// Computes `CappedDamerauLevenshteinDistance(query, s, cutoff)` for one query
+// against many strings `s`. Queries of up to 64 characters are matched with a
+// bit-parallel kernel that processes one character of `s` per step, and stops
+// as soon as the distance is known to exceed `cutoff`. Longer queries fall
+// back to `CappedDamerauLevenshteinDistance`.
+//
+// The matcher refers to `query`, which must outlive it.
+class DamerauLevenshteinMatcher {
+ public:
+  explicit DamerauLevenshteinMatcher(absl::string_view query);
+
+  // Returns `CappedDamerauLevenshteinDistance(query(), s, cutoff)`.
+  uint8_t Distance(absl::string_view s, uint8_t cutoff) const;
+
+  absl::string_view query() const { return query_; }
+
+ private:
+  absl::string_view query_;
+  // The bit `i` of `masks_[c]` is set if `query_[i] == c`.
+  std::array<uint64_t, 256> masks_;
+};
+
+// Returns the indices of the `candidates` within distance `cutoff` of `query`,
+// in increasing order. As with `CappedDamerauLevenshteinDistance`, strings of
+// more than 100 characters match nothing, and `cutoff` is capped at 100.
+std::vector<size_t> FindWithinDamerauLevenshteinDistance(
+    absl::string_view query, absl::Span<const absl::string_view> candidates,
+    uint8_t cutoff);
+
+// DamerauLevenshteinDictionary
+//
+// Indexes a fixed set of words for repeated "all words within distance k"
+// queries. Words are grouped by length and summarized by a histogram of their
+// characters, so that most words are ruled out without computing a distance:
+// the distance between two strings is at least the difference of their
+// lengths, and at least half the L1 distance between their histograms.
+//
+// The dictionary refers to the words, which must outlive it.
+class DamerauLevenshteinDictionary {
+ public:
+  explicit DamerauLevenshteinDictionary(
+      absl::Span<const absl::string_view> words);
+
+  // Returns the indices of the words within distance `cutoff` of `query`, in
+  // increasing order, with the limits of
+  // `FindWithinDamerauLevenshteinDistance()`.
+  std::vector<size_t> FindWithin(absl::string_view query,
+                                 uint8_t cutoff) const;
+
+  // The number of histogram buckets that characters are hashed into.
+  static constexpr size_t kHistogramBuckets = 16;
+  using Histogram = std::array<uint8_t, kHistogramBuckets>;
+
+ private:
+  struct Entry {
+    Histogram histogram;
+    absl::string_view word;
+    size_t index;
+  };
+
+  // Sorted by word length.
+  std::vector<Entry> entries_;
+};
+
 }  // namespace strings_internal
 ABSL_NAMESPACE_END
 }  // namespace absl
@@ -12,10 +12,15 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <cstddef>
+#include <cstdint>
+#include <random>
 #include <string>
+#include <vector>
 
 #include "absl/profiling/benchmark.h"
 #include "absl/strings/internal/damerau_levenshtein_distance.h"
+#include "absl/strings/string_view.h"
 
 namespace {
 
@@ -53,4 +58,77 @@ void BM_Distance(benchmark::State& state) {
 }
 BENCHMARK(BM_Distance)->Apply(BenchmarkArgs);
 
+using absl::strings_internal::DamerauLevenshteinMatcher;
+void BM_MatcherDistance(benchmark::State& state) {
+  std::string s1 = MakeTestString(state.range(0), 0);
+  std::string s2 = MakeTestString(state.range(0), state.range(1));
+  const DamerauLevenshteinMatcher matcher(s1);
+  const size_t cap = state.range(2);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(matcher.Distance(s2, cap));
+  }
+}
+BENCHMARK(BM_MatcherDistance)->Apply(BenchmarkArgs);
+
+// Returns `n` random words shaped like flag names, from 4 to 30 characters.
+std::vector<std::string> MakeDictionary(size_t n) {
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<int> size(4, 30);
+  std::uniform_int_distribution<int> c('a', 'z' + 1);
+  std::vector<std::string> words(n);
+  for (std::string& word : words) {
+    word.resize(size(rng));
+    for (char& ch : word) {
+      const int r = c(rng);
+      ch = r > 'z' ? '_' : static_cast<char>(r);
+    }
+  }
+  return words;
+}
+
+// Finds the words within distance 2 of a misspelled word from a dictionary of
+// `state.range(0)` words, one pair at a time.
+void BM_FindWithinPairwise(benchmark::State& state) {
+  const std::vector<std::string> words = MakeDictionary(state.range(0));
+  std::string query = words[words.size() / 2];
+  std::swap(query[1], query[2]);
+  for (auto _ : state) {
+    size_t found = 0;
+    for (const std::string& word : words) {
+      found += CappedDamerauLevenshteinDistance(query, word, 2) <= 2;
+    }
+    benchmark::DoNotOptimize(found);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_FindWithinPairwise)->Arg(1000)->Arg(30000);
+
+using absl::strings_internal::FindWithinDamerauLevenshteinDistance;
+void BM_FindWithin(benchmark::State& state) {
+  const std::vector<std::string> storage = MakeDictionary(state.range(0));
+  const std::vector<absl::string_view> words(storage.begin(), storage.end());
+  std::string query = storage[storage.size() / 2];
+  std::swap(query[1], query[2]);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        FindWithinDamerauLevenshteinDistance(query, words, 2));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_FindWithin)->Arg(1000)->Arg(30000);
+
+using absl::strings_internal::DamerauLevenshteinDictionary;
+void BM_DictionaryFindWithin(benchmark::State& state) {
+  const std::vector<std::string> storage = MakeDictionary(state.range(0));
+  const std::vector<absl::string_view> words(storage.begin(), storage.end());
+  const DamerauLevenshteinDictionary dictionary(words);
+  std::string query = storage[storage.size() / 2];
+  std::swap(query[1], query[2]);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(dictionary.FindWithin(query, 2));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_DictionaryFindWithin)->Arg(1000)->Arg(30000);
+
 }  // namespace
@@ -14,14 +14,79 @@
 
 #include "absl/strings/internal/damerau_levenshtein_distance.h"
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
+#include "absl/strings/string_view.h"
 
 namespace {
 
 using absl::strings_internal::CappedDamerauLevenshteinDistance;
+using absl::strings_internal::DamerauLevenshteinDictionary;
+using absl::strings_internal::DamerauLevenshteinMatcher;
+using absl::strings_internal::FindWithinDamerauLevenshteinDistance;
+
+// Computes the capped distance with the full dynamic programming matrix.
+uint8_t ReferenceDistance(absl::string_view s1, absl::string_view s2,
+                          uint8_t cutoff) {
+  const size_t capped = std::min<size_t>(cutoff, 100);
+  if (s1.size() > 100 || s2.size() > 100) {
+    return static_cast<uint8_t>(capped + 1);
+  }
+  std::vector<std::vector<size_t>> d(s1.size() + 1,
+                                     std::vector<size_t>(s2.size() + 1));
+  for (size_t i = 0; i <= s1.size(); ++i) d[i][0] = i;
+  for (size_t j = 0; j <= s2.size(); ++j) d[0][j] = j;
+  for (size_t i = 1; i <= s1.size(); ++i) {
+    for (size_t j = 1; j <= s2.size(); ++j) {
+      d[i][j] = std::min({d[i - 1][j] + 1, d[i][j - 1] + 1,
+                          d[i - 1][j - 1] + (s1[i - 1] == s2[j - 1] ? 0 : 1)});
+      if (i > 1 && j > 1 && s1[i - 1] == s2[j - 2] && s1[i - 2] == s2[j - 1]) {
+        d[i][j] = std::min(d[i][j], d[i - 2][j - 2] + 1);
+      }
+    }
+  }
+  return static_cast<uint8_t>(std::min(d[s1.size()][s2.size()], capped + 1));
+}
+
+// Returns a random string over a small alphabet, so that random strings share
+// characters, transpositions and runs.
+std::string RandomString(std::mt19937& rng, size_t max_size) {
+  std::uniform_int_distribution<size_t> size(0, max_size);
+  std::uniform_int_distribution<int> c('a', 'd');
+  std::string s(size(rng), '\0');
+  for (char& ch : s) ch = static_cast<char>(c(rng));
+  return s;
+}
+
+// Returns `s` with `n` random edits applied.
+std::string Edit(std::mt19937& rng, std::string s, int n) {
+  std::uniform_int_distribution<int> c('a', 'e');
+  for (int i = 0; i < n; ++i) {
+    const size_t pos = std::uniform_int_distribution<size_t>(0, s.size())(rng);
+    switch (std::uniform_int_distribution<int>(0, 3)(rng)) {
+      case 0:
+        s.insert(pos, 1, static_cast<char>(c(rng)));
+        break;
+      case 1:
+        if (pos < s.size()) s.erase(pos, 1);
+        break;
+      case 2:
+        if (pos < s.size()) s[pos] = static_cast<char>(c(rng));
+        break;
+      default:
+        if (pos + 1 < s.size()) std::swap(s[pos], s[pos + 1]);
+        break;
+    }
+  }
+  return s;
+}
 
 TEST(Distance, TestDistances) {
   EXPECT_THAT(CappedDamerauLevenshteinDistance("ab", "ab", 6), uint8_t{0});
@@ -96,4 +161,75 @@ TEST(Distance, TestCutoff) {
                                                UINT8_MAX),
               uint8_t{101});
 }
+
+TEST(Distance, MatchesReference) {
+  std::mt19937 rng(11);
+  for (int i = 0; i < 5000; ++i) {
+    // Covers both the bit-parallel kernel, for strings of up to 64
+    // characters, and the banded matrix used for longer ones.
+    const std::string s1 = RandomString(rng, i % 4 == 0 ? 110 : 66);
+    const std::string s2 = i % 2 == 0 ? Edit(rng, s1, i % 7)
+                                      : RandomString(rng, s1.size() + 3);
+    const uint8_t cutoff = static_cast<uint8_t>(i % 5 == 0 ? 255 : i % 9);
+    ASSERT_EQ(CappedDamerauLevenshteinDistance(s1, s2, cutoff),
+              ReferenceDistance(s1, s2, cutoff))
+        << s1 << " " << s2 << " " << int{cutoff};
+  }
+}
+
+TEST(Matcher, MatchesReference) {
+  std::mt19937 rng(17);
+  for (int i = 0; i < 5000; ++i) {
+    // Queries are mostly short enough for the bit-parallel kernel, but cover
+    // the boundary at 64 characters and the limit at 100.
+    const std::string query = RandomString(rng, i % 4 == 0 ? 110 : 66);
+    const std::string s = i % 2 == 0 ? Edit(rng, query, i % 7)
+                                     : RandomString(rng, query.size() + 3);
+    const uint8_t cutoff = static_cast<uint8_t>(i % 5 == 0 ? 255 : i % 9);
+    const DamerauLevenshteinMatcher matcher(query);
+    ASSERT_EQ(matcher.Distance(s, cutoff), ReferenceDistance(query, s, cutoff))
+        << query << " " << s << " " << int{cutoff};
+  }
+}
+
+TEST(Matcher, Transpositions) {
+  const DamerauLevenshteinMatcher matcher("abcd");
+  EXPECT_EQ(matcher.Distance("abcd", 6), 0);
+  EXPECT_EQ(matcher.Distance("bacd", 6), 1);
+  EXPECT_EQ(matcher.Distance("badc", 6), 2);
+  EXPECT_EQ(matcher.Distance("cadb", 6), 4);
+  EXPECT_EQ(matcher.Distance("bdac", 6), 4);
+  EXPECT_EQ(matcher.Distance("bdac", 2), 3);
+  EXPECT_EQ(DamerauLevenshteinMatcher("").Distance("ab", 6), 2);
+  EXPECT_EQ(DamerauLevenshteinMatcher("").Distance("ab", 1), 2);
+}
+
+TEST(Dictionary, FindWithin) {
+  std::mt19937 rng(29);
+  std::vector<std::string> storage;
+  for (int i = 0; i < 2000; ++i) {
+    storage.push_back(RandomString(rng, i % 10 == 0 ? 120 : 12));
+  }
+  const std::vector<absl::string_view> words(storage.begin(), storage.end());
+  const DamerauLevenshteinDictionary dictionary(words);
+  for (int i = 0; i < 20; ++i) {
+    const std::string query =
+        i % 2 == 0 ? Edit(rng, storage[i], 2) : RandomString(rng, 12);
+    for (uint8_t cutoff : {0, 1, 2, 4, 200}) {
+      std::vector<size_t> expected;
+      for (size_t j = 0; j < words.size(); ++j) {
+        if (ReferenceDistance(query, words[j], cutoff) <=
+            std::min<uint8_t>(cutoff, 100)) {
+          expected.push_back(j);
+        }
+      }
+      ASSERT_EQ(dictionary.FindWithin(query, cutoff), expected)
+          << query << " " << int{cutoff};
+      ASSERT_EQ(FindWithinDamerauLevenshteinDistance(query, words, cutoff),
+                expected)
+          << query << " " << int{cutoff};
+    }
+  }
+}
+
 }  // namespace
@@ -50,6 +50,24 @@ void Base64EscapeInternal(const unsigned char* src, size_t szsrc, String* dest,
   dest->erase(escaped_len);
 }
 
+// Like `Base64EscapeInternal()` above, but appends the encoding to the
+// existing contents of `dest`.
+template <typename String>
+void Base64EscapeAndAppendInternal(const unsigned char* src, size_t szsrc,
+                                   String* dest, bool do_padding,
+                                   const char* base64_chars) {
+  const size_t calc_escaped_size =
+      CalculateBase64EscapedLenInternal(szsrc, do_padding);
+  const size_t orig_size = dest->size();
+  STLStringResizeUninitializedAmortized(dest, orig_size + calc_escaped_size);
+
+  const size_t escaped_len =
+      Base64EscapeInternal(src, szsrc, &(*dest)[0] + orig_size,
+                           calc_escaped_size, base64_chars, do_padding);
+  assert(calc_escaped_size == escaped_len);
+  dest->erase(orig_size + escaped_len);
+}
+
 }  // namespace strings_internal
 ABSL_NAMESPACE_END
 }  // namespace absl
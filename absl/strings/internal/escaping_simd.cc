@@ -0,0 +1,575 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/strings/internal/escaping_simd.h"
+
+#include <cstddef>
+#include <cstdint>
+
+#include "absl/base/config.h"
+#include "absl/strings/internal/simd_dispatch.h"
+
+#if defined(ABSL_INTERNAL_STRINGS_HAVE_X86_DISPATCH)
+#include <immintrin.h>
+#elif defined(ABSL_INTERNAL_HAVE_ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define ABSL_INTERNAL_STRINGS_ESCAPING_NEON 1
+#endif
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+namespace strings_internal {
+namespace {
+
+#if defined(ABSL_INTERNAL_STRINGS_HAVE_X86_DISPATCH)
+
+// ----------------------------------------------------------------------
+// x86 kernels.
+//
+// Base64 encoding follows the well-known multiply-shift scheme: each 32-bit
+// lane holds one 3-byte group (shuffled into the order `b1 b0 b2 b1`) from
+// which the four 6-bit indices are extracted with two masked multiplies. The
+// indices are then turned into alphabet characters by adding a per-range
+// offset selected with `pshufb`, which keeps the kernels independent of the
+// particular alphabet (standard or web-safe).
+//
+// Decoding classifies each character by range ('A'-'Z', 'a'-'z', '0'-'9' and
+// the two alphabet-specific characters), bails out of the block if anything
+// else is present, then packs the 6-bit values with multiply-add
+// instructions.
+// ----------------------------------------------------------------------
+
+// Returns a mask of the bytes of `v` in the range [0, `max`] when interpreted
+// as unsigned.
+ABSL_INTERNAL_STRINGS_TARGET_SSSE3 inline __m128i LessEqualU8(__m128i v,
+                                                             char max) {
+  return _mm_cmpeq_epi8(_mm_min_epu8(v, _mm_set1_epi8(max)), v);
+}
+
+ABSL_INTERNAL_STRINGS_TARGET_AVX2 inline __m256i LessEqualU8(__m256i v,
+                                                            char max) {
+  return _mm256_cmpeq_epi8(_mm256_min_epu8(v, _mm256_set1_epi8(max)), v);
+}
+
+ABSL_INTERNAL_STRINGS_TARGET_SSSE3 inline __m128i Base64Indices(__m128i in) {
+  in = _mm_shuffle_epi8(
+      in, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+  const __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00));
+  const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+  const __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003f03f0));
+  const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+  return _mm_or_si128(t1, t3);
+}
+
+ABSL_INTERNAL_STRINGS_TARGET_SSSE3 inline __m128i Base64Chars(
+    __m128i indices, __m128i offsets) {
+  __m128i reduced = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+  const __m128i upper = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+  reduced = _mm_or_si128(reduced, _mm_and_si128(upper, _mm_set1_epi8(13)));
+  return _mm_add_epi8(indices, _mm_shuffle_epi8(offsets, reduced));
+}
+
+// Per-range offsets added to a 6-bit index to produce its character. Entry 0
+// covers 'a'-'z', entries 1-10 cover '0'-'9', 11 and 12 are the two
+// alphabet-specific characters and 13 covers 'A'-'Z'.
+ABSL_INTERNAL_STRINGS_TARGET_SSSE3 inline __m128i Base64Offsets(
+    const char* base64) {
+  const char c62 = static_cast<char>(base64[62] - 62);
+  const char c63 = static_cast<char>(base64[63] - 63);
+  return _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                       '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                       '0' - 52, c62, c63, 'A', 0, 0);
+}
+
+ABSL_INTERNAL_STRINGS_TARGET_SSSE3 size_t Base64EscapeSsse3(
+    const unsigned char* src, size_t szsrc, char* dest, const char* base64) {
+  const __m128i offsets = Base64Offsets(base64);
+  size_t consumed = 0;
+  // Each iteration loads 16 bytes but only encodes the first 12.
+  while (szsrc - consumed >= 16) {
+    const __m128i in =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + consumed));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dest),
+                     Base64Chars(Base64Indices(in), offsets));
+    consumed += 12;
+    dest += 16;
+  }
+  return consumed;
+}
+
+// Returns the 6-bit values of the characters in `in`, and sets `*valid` to
+// false if any of them is not in the alphabet.
+ABSL_INTERNAL_STRINGS_TARGET_SSSE3 inline __m128i Base64Values(
+    __m128i in, __m128i c62, __m128i c63, bool* valid) {
+  const __m128i u = _mm_sub_epi8(in, _mm_set1_epi8('A'));
+  const __m128i l = _mm_sub_epi8(in, _mm_set1_epi8('a'));
+  const __m128i d = _mm_sub_epi8(in, _mm_set1_epi8('0'));
+  const __m128i is_upper = LessEqualU8(u, 25);
+  const __m128i is_lower = LessEqualU8(l, 25);
+  const __m128i is_digit = LessEqualU8(d, 9);
+  const __m128i is_62 = _mm_cmpeq_epi8(in, c62);
+  const __m128i is_63 = _mm_cmpeq_epi8(in, c63);
+  const __m128i ok = _mm_or_si128(_mm_or_si128(is_upper, is_lower),
+                                  _mm_or_si128(is_digit,
+                                               _mm_or_si128(is_62, is_63)));
+  *valid = _mm_movemask_epi8(ok) == 0xFFFF;
+  __m128i v = _mm_and_si128(is_upper, u);
+  v = _mm_or_si128(
+      v, _mm_and_si128(is_lower, _mm_add_epi8(l, _mm_set1_epi8(26))));
+  v = _mm_or_si128(
+      v, _mm_and_si128(is_digit, _mm_add_epi8(d, _mm_set1_epi8(52))));
+  v = _mm_or_si128(v, _mm_and_si128(is_62, _mm_set1_epi8(62)));
+  v = _mm_or_si128(v, _mm_and_si128(is_63, _mm_set1_epi8(63)));
+  return v;
+}
+
+// Packs sixteen 6-bit values into 12 bytes (in the low 12 bytes of the
+// result).
+ABSL_INTERNAL_STRINGS_TARGET_SSSE3 inline __m128i Base64Pack(__m128i v) {
+  const __m128i merged =
+      _mm_maddubs_epi16(v, _mm_set1_epi32(0x01400140));
+  const __m128i packed = _mm_madd_epi16(merged, _mm_set1_epi32(0x00011000));
+  return _mm_shuffle_epi8(packed, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14,
+                                                13, 12, -1, -1, -1, -1));
+}
+
+ABSL_INTERNAL_STRINGS_TARGET_SSSE3 size_t Base64UnescapeSsse3(
+    const unsigned char* src, size_t szsrc, char* dest, size_t szdest,
+    const char* base64) {
+  const __m128i c62 = _mm_set1_epi8(base64[62]);
+  const __m128i c63 = _mm_set1_epi8(base64[63]);
+  size_t consumed = 0;
+  size_t written = 0;
+  // Each iteration stores 16 bytes of which only 12 are decoded output.
+  while (szsrc - consumed >= 16 && szdest - written >= 16) {
+    const __m128i in =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + consumed));
+    bool valid;
+    const __m128i values = Base64Values(in, c62, c63, &valid);
+    if (!valid) break;
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + written),
+                     Base64Pack(values));
+    consumed += 16;
+    written += 12;
+  }
+  return consumed;
+}
+
+ABSL_INTERNAL_STRINGS_TARGET_AVX2 size_t Base64EscapeAvx2(
+    const unsigned char* src, size_t szsrc, char* dest, const char* base64) {
+  const __m128i offsets128 = Base64Offsets(base64);
+  const __m256i offsets = _mm256_broadcastsi128_si256(offsets128);
+  const __m256i shuffle = _mm256_broadcastsi128_si256(
+      _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+  size_t consumed = 0;
+  // Each 128-bit lane encodes 12 bytes; the second lane's load ends 28 bytes
+  // past the start of the block.
+  while (szsrc - consumed >= 28) {
+    const unsigned char* p = src + consumed;
+    __m256i in = _mm256_inserti128_si256(
+        _mm256_castsi128_si256(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(p))),
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 12)), 1);
+    in = _mm256_shuffle_epi8(in, shuffle);
+    const __m256i t0 = _mm256_and_si256(in, _mm256_set1_epi32(0x0fc0fc00));
+    const __m256i t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+    const __m256i t2 = _mm256_and_si256(in, _mm256_set1_epi32(0x003f03f0));
+    const __m256i t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+    const __m256i indices = _mm256_or_si256(t1, t3);
+    __m256i reduced = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+    const __m256i upper = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices);
+    reduced = _mm256_or_si256(reduced,
+                              _mm256_and_si256(upper, _mm256_set1_epi8(13)));
+    const __m256i out =
+        _mm256_add_epi8(indices, _mm256_shuffle_epi8(offsets, reduced));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest), out);
+    consumed += 24;
+    dest += 32;
+  }
+  return consumed + Base64EscapeSsse3(src + consumed, szsrc - consumed, dest,
+                                      base64);
+}
+
+ABSL_INTERNAL_STRINGS_TARGET_AVX2 size_t Base64UnescapeAvx2(
+    const unsigned char* src, size_t szsrc, char* dest, size_t szdest,
+    const char* base64) {
+  const __m256i c62 = _mm256_set1_epi8(base64[62]);
+  const __m256i c63 = _mm256_set1_epi8(base64[63]);
+  const __m256i pack_shuffle = _mm256_broadcastsi128_si256(_mm_setr_epi8(
+      2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+  size_t consumed = 0;
+  size_t written = 0;
+  // The second 16-byte store starts 12 bytes in, so 28 bytes must be
+  // writable for 24 bytes of output.
+  while (szsrc - consumed >= 32 && szdest - written >= 28) {
+    const __m256i in =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + consumed));
+    const __m256i u = _mm256_sub_epi8(in, _mm256_set1_epi8('A'));
+    const __m256i l = _mm256_sub_epi8(in, _mm256_set1_epi8('a'));
+    const __m256i d = _mm256_sub_epi8(in, _mm256_set1_epi8('0'));
+    const __m256i is_upper = LessEqualU8(u, 25);
+    const __m256i is_lower = LessEqualU8(l, 25);
+    const __m256i is_digit = LessEqualU8(d, 9);
+    const __m256i is_62 = _mm256_cmpeq_epi8(in, c62);
+    const __m256i is_63 = _mm256_cmpeq_epi8(in, c63);
+    const __m256i ok =
+        _mm256_or_si256(_mm256_or_si256(is_upper, is_lower),
+                        _mm256_or_si256(is_digit, _mm256_or_si256(is_62, is_63)));
+    if (_mm256_movemask_epi8(ok) != -1) break;
+    __m256i v = _mm256_and_si256(is_upper, u);
+    v = _mm256_or_si256(
+        v, _mm256_and_si256(is_lower, _mm256_add_epi8(l, _mm256_set1_epi8(26))));
+    v = _mm256_or_si256(
+        v, _mm256_and_si256(is_digit, _mm256_add_epi8(d, _mm256_set1_epi8(52))));
+    v = _mm256_or_si256(v, _mm256_and_si256(is_62, _mm256_set1_epi8(62)));
+    v = _mm256_or_si256(v, _mm256_and_si256(is_63, _mm256_set1_epi8(63)));
+    const __m256i merged =
+        _mm256_maddubs_epi16(v, _mm256_set1_epi32(0x01400140));
+    const __m256i packed =
+        _mm256_madd_epi16(merged, _mm256_set1_epi32(0x00011000));
+    const __m256i out = _mm256_shuffle_epi8(packed, pack_shuffle);
+    char* d_out = dest + written;
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(d_out),
+                     _mm256_castsi256_si128(out));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(d_out + 12),
+                     _mm256_extracti128_si256(out, 1));
+    consumed += 32;
+    written += 24;
+  }
+  return consumed + Base64UnescapeSsse3(src + consumed, szsrc - consumed,
+                                        dest + written, szdest - written,
+                                        base64);
+}
+
+ABSL_INTERNAL_STRINGS_TARGET_SSSE3 size_t BytesToHexSsse3(
+    const unsigned char* src, size_t num, char* dest) {
+  const __m128i digits = _mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7',
+                                       '8', '9', 'a', 'b', 'c', 'd', 'e', 'f');
+  const __m128i low_nibble = _mm_set1_epi8(0x0f);
+  size_t consumed = 0;
+  while (num - consumed >= 16) {
+    const __m128i in =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + consumed));
+    const __m128i hi = _mm_shuffle_epi8(
+        digits, _mm_and_si128(_mm_srli_epi16(in, 4), low_nibble));
+    const __m128i lo = _mm_shuffle_epi8(digits, _mm_and_si128(in, low_nibble));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dest),
+                     _mm_unpacklo_epi8(hi, lo));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + 16),
+                     _mm_unpackhi_epi8(hi, lo));
+    consumed += 16;
+    dest += 32;
+  }
+  return consumed;
+}
+
+ABSL_INTERNAL_STRINGS_TARGET_AVX2 size_t BytesToHexAvx2(
+    const unsigned char* src, size_t num, char* dest) {
+  const __m256i digits = _mm256_broadcastsi128_si256(
+      _mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b',
+                    'c', 'd', 'e', 'f'));
+  const __m256i low_nibble = _mm256_set1_epi8(0x0f);
+  size_t consumed = 0;
+  while (num - consumed >= 32) {
+    const __m256i in =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + consumed));
+    const __m256i hi = _mm256_shuffle_epi8(
+        digits, _mm256_and_si256(_mm256_srli_epi16(in, 4), low_nibble));
+    const __m256i lo =
+        _mm256_shuffle_epi8(digits, _mm256_and_si256(in, low_nibble));
+    // The unpack instructions interleave within 128-bit lanes, so the halves
+    // need to be put back in order.
+    const __m256i a = _mm256_unpacklo_epi8(hi, lo);
+    const __m256i b = _mm256_unpackhi_epi8(hi, lo);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest),
+                        _mm256_permute2x128_si256(a, b, 0x20));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + 32),
+                        _mm256_permute2x128_si256(a, b, 0x31));
+    consumed += 32;
+    dest += 64;
+  }
+  return consumed + BytesToHexSsse3(src + consumed, num - consumed, dest);
+}
+
+// Returns the nibble values of the hex characters in `in`, and sets `*valid`
+// to false if any of them is not a hex digit.
+ABSL_INTERNAL_STRINGS_TARGET_SSSE3 inline __m128i HexValues(__m128i in,
+                                                           bool* valid) {
+  const __m128i d = _mm_sub_epi8(in, _mm_set1_epi8('0'));
+  const __m128i a = _mm_sub_epi8(_mm_or_si128(in, _mm_set1_epi8(0x20)),
+                                 _mm_set1_epi8('a'));
+  const __m128i is_digit = LessEqualU8(d, 9);
+  const __m128i is_alpha = LessEqualU8(a, 5);
+  *valid = _mm_movemask_epi8(_mm_or_si128(is_digit, is_alpha)) == 0xFFFF;
+  return _mm_or_si128(
+      _mm_and_si128(is_digit, d),
+      _mm_and_si128(is_alpha, _mm_add_epi8(a, _mm_set1_epi8(10))));
+}
+
+ABSL_INTERNAL_STRINGS_TARGET_SSSE3 size_t HexToBytesSsse3(const char* hex,
+                                                          size_t num,
+                                                          char* dest) {
+  // Combines each (high, low) pair of nibbles as `high * 16 + low`.
+  const __m128i weights = _mm_set1_epi16(0x0110);
+  size_t written = 0;
+  while (num - written >= 16) {
+    const char* p = hex + 2 * written;
+    bool valid0, valid1;
+    const __m128i v0 = HexValues(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)), &valid0);
+    const __m128i v1 = HexValues(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 16)), &valid1);
+    if (!(valid0 && valid1)) break;
+    const __m128i out = _mm_packus_epi16(_mm_maddubs_epi16(v0, weights),
+                                         _mm_maddubs_epi16(v1, weights));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + written), out);
+    written += 16;
+  }
+  return written;
+}
+
+ABSL_INTERNAL_STRINGS_TARGET_AVX2 size_t HexToBytesAvx2(const char* hex,
+                                                        size_t num,
+                                                        char* dest) {
+  const __m256i weights = _mm256_set1_epi16(0x0110);
+  size_t written = 0;
+  while (num - written >= 32) {
+    const char* p = hex + 2 * written;
+    __m256i v[2];
+    bool valid = true;
+    for (int i = 0; i < 2; ++i) {
+      const __m256i in =
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + 32 * i));
+      const __m256i d = _mm256_sub_epi8(in, _mm256_set1_epi8('0'));
+      const __m256i a = _mm256_sub_epi8(
+          _mm256_or_si256(in, _mm256_set1_epi8(0x20)), _mm256_set1_epi8('a'));
+      const __m256i is_digit = LessEqualU8(d, 9);
+      const __m256i is_alpha = LessEqualU8(a, 5);
+      valid &= _mm256_movemask_epi8(_mm256_or_si256(is_digit, is_alpha)) == -1;
+      v[i] = _mm256_or_si256(
+          _mm256_and_si256(is_digit, d),
+          _mm256_and_si256(is_alpha, _mm256_add_epi8(a, _mm256_set1_epi8(10))));
+    }
+    if (!valid) break;
+    // `packus` works within 128-bit lanes; restore the byte order afterwards.
+    const __m256i packed =
+        _mm256_packus_epi16(_mm256_maddubs_epi16(v[0], weights),
+                            _mm256_maddubs_epi16(v[1], weights));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + written),
+                        _mm256_permute4x64_epi64(packed, 0xD8));
+    written += 32;
+  }
+  return written + HexToBytesSsse3(hex + 2 * written, num - written,
+                                   dest + written);
+}
+
+#elif defined(ABSL_INTERNAL_STRINGS_ESCAPING_NEON)
+
+// ----------------------------------------------------------------------
+// NEON kernels. The structured load/store instructions do the 3 <-> 4 and
+// 1 <-> 2 byte (de)interleaving, so both encoders are table lookups and both
+// decoders are range classifications followed by shifts.
+// ----------------------------------------------------------------------
+
+size_t Base64EscapeNeon(const unsigned char* src, size_t szsrc, char* dest,
+                        const char* base64) {
+  const uint8_t* alphabet = reinterpret_cast<const uint8_t*>(base64);
+  uint8x16x4_t table;
+  table.val[0] = vld1q_u8(alphabet);
+  table.val[1] = vld1q_u8(alphabet + 16);
+  table.val[2] = vld1q_u8(alphabet + 32);
+  table.val[3] = vld1q_u8(alphabet + 48);
+  size_t consumed = 0;
+  while (szsrc - consumed >= 48) {
+    const uint8x16x3_t in = vld3q_u8(src + consumed);
+    uint8x16x4_t out;
+    out.val[0] = vshrq_n_u8(in.val[0], 2);
+    out.val[1] = vorrq_u8(vshlq_n_u8(vandq_u8(in.val[0], vdupq_n_u8(0x03)), 4),
+                          vshrq_n_u8(in.val[1], 4));
+    out.val[2] = vorrq_u8(vshlq_n_u8(vandq_u8(in.val[1], vdupq_n_u8(0x0f)), 2),
+                          vshrq_n_u8(in.val[2], 6));
+    out.val[3] = vandq_u8(in.val[2], vdupq_n_u8(0x3f));
+    for (int i = 0; i < 4; ++i) out.val[i] = vqtbl4q_u8(table, out.val[i]);
+    vst4q_u8(reinterpret_cast<uint8_t*>(dest), out);
+    consumed += 48;
+    dest += 64;
+  }
+  return consumed;
+}
+
+// Maps alphabet characters to their 6-bit values, clearing `*valid` for any
+// other character.
+inline uint8x16_t Base64ValuesNeon(uint8x16_t in, uint8x16_t c62,
+                                   uint8x16_t c63, uint8x16_t* valid) {
+  const uint8x16_t u = vsubq_u8(in, vdupq_n_u8('A'));
+  const uint8x16_t l = vsubq_u8(in, vdupq_n_u8('a'));
+  const uint8x16_t d = vsubq_u8(in, vdupq_n_u8('0'));
+  const uint8x16_t is_upper = vcleq_u8(u, vdupq_n_u8(25));
+  const uint8x16_t is_lower = vcleq_u8(l, vdupq_n_u8(25));
+  const uint8x16_t is_digit = vcleq_u8(d, vdupq_n_u8(9));
+  const uint8x16_t is_62 = vceqq_u8(in, c62);
+  const uint8x16_t is_63 = vceqq_u8(in, c63);
+  *valid = vandq_u8(*valid, vorrq_u8(vorrq_u8(is_upper, is_lower),
+                                     vorrq_u8(is_digit, vorrq_u8(is_62, is_63))));
+  uint8x16_t v = vandq_u8(is_upper, u);
+  v = vorrq_u8(v, vandq_u8(is_lower, vaddq_u8(l, vdupq_n_u8(26))));
+  v = vorrq_u8(v, vandq_u8(is_digit, vaddq_u8(d, vdupq_n_u8(52))));
+  v = vorrq_u8(v, vandq_u8(is_62, vdupq_n_u8(62)));
+  v = vorrq_u8(v, vandq_u8(is_63, vdupq_n_u8(63)));
+  return v;
+}
+
+size_t Base64UnescapeNeon(const unsigned char* src, size_t szsrc, char* dest,
+                          size_t szdest, const char* base64) {
+  const uint8x16_t c62 = vdupq_n_u8(static_cast<uint8_t>(base64[62]));
+  const uint8x16_t c63 = vdupq_n_u8(static_cast<uint8_t>(base64[63]));
+  size_t consumed = 0;
+  size_t written = 0;
+  while (szsrc - consumed >= 64 && szdest - written >= 48) {
+    const uint8x16x4_t in = vld4q_u8(src + consumed);
+    uint8x16_t valid = vdupq_n_u8(0xff);
+    uint8x16_t v[4];
+    for (int i = 0; i < 4; ++i) {
+      v[i] = Base64ValuesNeon(in.val[i], c62, c63, &valid);
+    }
+    if (vminvq_u8(valid) != 0xff) break;
+    uint8x16x3_t out;
+    out.val[0] = vorrq_u8(vshlq_n_u8(v[0], 2), vshrq_n_u8(v[1], 4));
+    out.val[1] = vorrq_u8(vshlq_n_u8(v[1], 4), vshrq_n_u8(v[2], 2));
+    out.val[2] = vorrq_u8(vshlq_n_u8(v[2], 6), v[3]);
+    vst3q_u8(reinterpret_cast<uint8_t*>(dest + written), out);
+    consumed += 64;
+    written += 48;
+  }
+  return consumed;
+}
+
+size_t BytesToHexNeon(const unsigned char* src, size_t num, char* dest) {
+  static constexpr uint8_t kDigits[16] = {'0', '1', '2', '3', '4', '5',
+                                          '6', '7', '8', '9', 'a', 'b',
+                                          'c', 'd', 'e', 'f'};
+  const uint8x16_t digits = vld1q_u8(kDigits);
+  size_t consumed = 0;
+  while (num - consumed >= 16) {
+    const uint8x16_t in = vld1q_u8(src + consumed);
+    uint8x16x2_t out;
+    out.val[0] = vqtbl1q_u8(digits, vshrq_n_u8(in, 4));
+    out.val[1] = vqtbl1q_u8(digits, vandq_u8(in, vdupq_n_u8(0x0f)));
+    vst2q_u8(reinterpret_cast<uint8_t*>(dest), out);
+    consumed += 16;
+    dest += 32;
+  }
+  return consumed;
+}
+
+inline uint8x16_t HexValuesNeon(uint8x16_t in, uint8x16_t* valid) {
+  const uint8x16_t d = vsubq_u8(in, vdupq_n_u8('0'));
+  const uint8x16_t a =
+      vsubq_u8(vorrq_u8(in, vdupq_n_u8(0x20)), vdupq_n_u8('a'));
+  const uint8x16_t is_digit = vcleq_u8(d, vdupq_n_u8(9));
+  const uint8x16_t is_alpha = vcleq_u8(a, vdupq_n_u8(5));
+  *valid = vandq_u8(*valid, vorrq_u8(is_digit, is_alpha));
+  return vorrq_u8(vandq_u8(is_digit, d),
+                  vandq_u8(is_alpha, vaddq_u8(a, vdupq_n_u8(10))));
+}
+
+size_t HexToBytesNeon(const char* hex, size_t num, char* dest) {
+  size_t written = 0;
+  while (num - written >= 16) {
+    const uint8x16x2_t in =
+        vld2q_u8(reinterpret_cast<const uint8_t*>(hex + 2 * written));
+    uint8x16_t valid = vdupq_n_u8(0xff);
+    const uint8x16_t hi = HexValuesNeon(in.val[0], &valid);
+    const uint8x16_t lo = HexValuesNeon(in.val[1], &valid);
+    if (vminvq_u8(valid) != 0xff) break;
+    vst1q_u8(reinterpret_cast<uint8_t*>(dest + written),
+             vorrq_u8(vshlq_n_u8(hi, 4), lo));
+    written += 16;
+  }
+  return written;
+}
+
+#endif
+
+}  // namespace
+
+size_t Base64EscapeSimd(const unsigned char* src, size_t szsrc, char* dest,
+                        const char* base64) {
+  switch (ActiveSimdLevel()) {
+#if defined(ABSL_INTERNAL_STRINGS_HAVE_X86_DISPATCH)
+    case SimdLevel::kAvx2:
+      return Base64EscapeAvx2(src, szsrc, dest, base64);
+    case SimdLevel::kSsse3:
+      return Base64EscapeSsse3(src, szsrc, dest, base64);
+#elif defined(ABSL_INTERNAL_STRINGS_ESCAPING_NEON)
+    case SimdLevel::kNeon:
+      return Base64EscapeNeon(src, szsrc, dest, base64);
+#endif
+    default:
+      return 0;
+  }
+}
+
+size_t Base64UnescapeSimd(const unsigned char* src, size_t szsrc, char* dest,
+                          size_t szdest, const char* base64) {
+  switch (ActiveSimdLevel()) {
+#if defined(ABSL_INTERNAL_STRINGS_HAVE_X86_DISPATCH)
+    case SimdLevel::kAvx2:
+      return Base64UnescapeAvx2(src, szsrc, dest, szdest, base64);
+    case SimdLevel::kSsse3:
+      return Base64UnescapeSsse3(src, szsrc, dest, szdest, base64);
+#elif defined(ABSL_INTERNAL_STRINGS_ESCAPING_NEON)
+    case SimdLevel::kNeon:
+      return Base64UnescapeNeon(src, szsrc, dest, szdest, base64);
+#endif
+    default:
+      return 0;
+  }
+}
+
+size_t BytesToHexSimd(const unsigned char* src, size_t num, char* dest) {
+  switch (ActiveSimdLevel()) {
+#if defined(ABSL_INTERNAL_STRINGS_HAVE_X86_DISPATCH)
+    case SimdLevel::kAvx2:
+      return BytesToHexAvx2(src, num, dest);
+    case SimdLevel::kSsse3:
+      return BytesToHexSsse3(src, num, dest);
+#elif defined(ABSL_INTERNAL_STRINGS_ESCAPING_NEON)
+    case SimdLevel::kNeon:
+      return BytesToHexNeon(src, num, dest);
+#endif
+    default:
+      return 0;
+  }
+}
+
+size_t HexToBytesSimd(const char* hex, size_t num, char* dest) {
+  switch (ActiveSimdLevel()) {
+#if defined(ABSL_INTERNAL_STRINGS_HAVE_X86_DISPATCH)
+    case SimdLevel::kAvx2:
+      return HexToBytesAvx2(hex, num, dest);
+    case SimdLevel::kSsse3:
+      return HexToBytesSsse3(hex, num, dest);
+#elif defined(ABSL_INTERNAL_STRINGS_ESCAPING_NEON)
+    case SimdLevel::kNeon:
+      return HexToBytesNeon(hex, num, dest);
+#endif
+    default:
+      return 0;
+  }
+}
+
+}  // namespace strings_internal
+ABSL_NAMESPACE_END
+}  // namespace absl
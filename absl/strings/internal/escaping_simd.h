@@ -0,0 +1,64 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Vectorized bulk kernels for Base64 and hex encoding and decoding.
+//
+// Each kernel processes the longest prefix of its input that it can handle
+// with whole vector blocks and returns how much it consumed; the caller is
+// responsible for finishing the remainder with the scalar code. Decoders stop
+// at the first block containing anything other than alphabet characters
+// (whitespace, padding, invalid bytes), so the scalar code observes exactly
+// the same input it would have seen at that position and reports errors
+// identically.
+
+#ifndef ABSL_STRINGS_INTERNAL_ESCAPING_SIMD_H_
+#define ABSL_STRINGS_INTERNAL_ESCAPING_SIMD_H_
+
+#include <cstddef>
+
+#include "absl/base/config.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+namespace strings_internal {
+
+// Base64-encodes whole 3-byte groups from the front of `src` using the 64
+// character alphabet `base64`, writing 4 characters per group to `dest`.
+// Returns the number of input bytes consumed, which is a multiple of 3.
+// `dest` must have room for `4 * szsrc / 3` characters.
+size_t Base64EscapeSimd(const unsigned char* src, size_t szsrc, char* dest,
+                        const char* base64);
+
+// Decodes whole 4-character groups from the front of `src`, stopping at the
+// first vector block that contains a character outside the `base64` alphabet.
+// Writes 3 bytes per group to `dest`, never more than `szdest` bytes, and
+// returns the number of input characters consumed (a multiple of 4).
+size_t Base64UnescapeSimd(const unsigned char* src, size_t szsrc, char* dest,
+                          size_t szdest, const char* base64);
+
+// Writes the lowercase hex encoding of a prefix of `src` to `dest` (two
+// characters per byte). Returns the number of input bytes consumed. `dest`
+// must have room for `2 * num` characters.
+size_t BytesToHexSimd(const unsigned char* src, size_t num, char* dest);
+
+// Decodes a prefix of the `2 * num` hex characters in `hex` into `dest`,
+// stopping at the first vector block that contains a non-hex character.
+// Returns the number of bytes written.
+size_t HexToBytesSimd(const char* hex, size_t num, char* dest);
+
+}  // namespace strings_internal
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_STRINGS_INTERNAL_ESCAPING_SIMD_H_
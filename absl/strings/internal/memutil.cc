@@ -17,6 +17,7 @@
 #include <cstdlib>
 
 #include "absl/strings/ascii.h"
+#include "absl/strings/internal/ascii_simd.h"
 
 namespace absl {
 ABSL_NAMESPACE_BEGIN
@@ -26,7 +27,10 @@ int memcasecmp(const char* s1, const char* s2, size_t len) {
   const unsigned char* us1 = reinterpret_cast<const unsigned char*>(s1);
   const unsigned char* us2 = reinterpret_cast<const unsigned char*>(s2);
 
-  for (size_t i = 0; i < len; i++) {
+  // Skip the prefix that is equal ignoring case, 16 or 32 bytes at a time.
+  // Shorter inputs, such as most header names, avoid the call.
+  size_t i = len < 16 ? 0 : CaseInsensitiveMismatchSimd(s1, s2, len);
+  for (; i < len; i++) {
     unsigned char c1 = us1[i];
     unsigned char c2 = us2[i];
     // If bytes are the same, they will be the same when converted to lower.
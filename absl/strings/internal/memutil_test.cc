@@ -16,7 +16,9 @@
 
 #include "absl/strings/internal/memutil.h"
 
+#include <cstddef>
 #include <cstdlib>
+#include <string>
 
 #include "gtest/gtest.h"
 
@@ -38,4 +40,28 @@ TEST(MemUtil, memcasecmp) {
   EXPECT_EQ(absl::strings_internal::memcasecmp(a, "whatever", 0), 0);
 }
 
+TEST(MemUtil, memcasecmpLong) {
+  const std::string lower(100, 'x');
+  const std::string upper(100, 'X');
+  for (size_t len = 0; len <= lower.size(); ++len) {
+    EXPECT_EQ(absl::strings_internal::memcasecmp(lower.data(), upper.data(),
+                                                 len),
+              0);
+    // The first difference determines the sign of the result.
+    for (size_t pos = 0; pos < len; ++pos) {
+      std::string smaller = upper;
+      smaller[pos] = 'W';
+      if (pos + 1 < len) smaller[pos + 1] = 'Z';
+      EXPECT_GT(absl::strings_internal::memcasecmp(lower.data(),
+                                                   smaller.data(), len),
+                0)
+          << len << " " << pos;
+      EXPECT_LT(absl::strings_internal::memcasecmp(smaller.data(),
+                                                   lower.data(), len),
+                0)
+          << len << " " << pos;
+    }
+  }
+}
+
 }  // namespace
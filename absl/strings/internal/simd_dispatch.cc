@@ -0,0 +1,101 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/strings/internal/simd_dispatch.h"
+
+#include <atomic>
+
+#include "absl/base/config.h"
+#include "absl/base/optimization.h"
+
+#if defined(ABSL_INTERNAL_STRINGS_HAVE_X86_DISPATCH) && defined(_MSC_VER)
+#include <immintrin.h>
+#include <intrin.h>
+#endif
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+namespace strings_internal {
+namespace {
+
+SimdLevel DetectSimdLevel() {
+#if defined(ABSL_INTERNAL_HAVE_ARM_NEON) && defined(__aarch64__)
+  return SimdLevel::kNeon;
+#elif defined(ABSL_INTERNAL_STRINGS_HAVE_X86_DISPATCH) && defined(_MSC_VER)
+  int cpu_info[4];
+  __cpuid(cpu_info, 0);
+  const int max_leaf = cpu_info[0];
+  if (max_leaf < 1) return SimdLevel::kScalar;
+  __cpuid(cpu_info, 1);
+  const bool ssse3 = (cpu_info[2] & (1 << 9)) != 0;
+  const bool osxsave = (cpu_info[2] & (1 << 27)) != 0;
+  if (!ssse3) return SimdLevel::kScalar;
+  if (max_leaf >= 7 && osxsave) {
+    // AVX2 is only usable if the OS saves the YMM registers on context switch.
+    const bool ymm_enabled = (_xgetbv(0) & 0x6) == 0x6;
+    __cpuidex(cpu_info, 7, 0);
+    if (ymm_enabled && (cpu_info[1] & (1 << 5)) != 0) return SimdLevel::kAvx2;
+  }
+  return SimdLevel::kSsse3;
+#elif defined(ABSL_INTERNAL_STRINGS_HAVE_X86_DISPATCH)
+  // The builtins below also verify that the OS has enabled the extended
+  // register state needed by AVX.
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) return SimdLevel::kAvx2;
+  if (__builtin_cpu_supports("ssse3")) return SimdLevel::kSsse3;
+  return SimdLevel::kScalar;
+#else
+  return SimdLevel::kScalar;
+#endif
+}
+
+bool HostSupports(SimdLevel level) {
+  const SimdLevel host = GetSimdLevel();
+  switch (level) {
+    case SimdLevel::kScalar:
+      return true;
+    case SimdLevel::kSsse3:
+      return host == SimdLevel::kSsse3 || host == SimdLevel::kAvx2;
+    case SimdLevel::kAvx2:
+    case SimdLevel::kNeon:
+      return host == level;
+  }
+  return false;
+}
+
+// -1 means "no override"; otherwise holds a `SimdLevel`.
+ABSL_CONST_INIT std::atomic<int> simd_level_override{-1};
+
+}  // namespace
+
+SimdLevel GetSimdLevel() {
+  static const SimdLevel level = DetectSimdLevel();
+  return level;
+}
+
+SimdLevel ActiveSimdLevel() {
+  const int override_level = simd_level_override.load(std::memory_order_relaxed);
+  if (ABSL_PREDICT_TRUE(override_level < 0)) return GetSimdLevel();
+  return static_cast<SimdLevel>(override_level);
+}
+
+bool SetSimdLevelForTesting(SimdLevel level) {
+  if (!HostSupports(level)) return false;
+  simd_level_override.store(static_cast<int>(level), std::memory_order_relaxed);
+  return true;
+}
+
+}  // namespace strings_internal
+ABSL_NAMESPACE_END
+}  // namespace absl
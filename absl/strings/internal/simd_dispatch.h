@@ -0,0 +1,76 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Runtime selection of the vector instruction set used by the string
+// kernels. x86 kernels are compiled with per-function target attributes so
+// that the library itself does not need to be built with `-mssse3`/`-mavx2`;
+// the kernel is only called once `GetSimdLevel()` has confirmed that the host
+// CPU (and OS) support it. On AArch64, NEON is part of the baseline ISA.
+
+#ifndef ABSL_STRINGS_INTERNAL_SIMD_DISPATCH_H_
+#define ABSL_STRINGS_INTERNAL_SIMD_DISPATCH_H_
+
+#include "absl/base/attributes.h"
+#include "absl/base/config.h"
+
+// ABSL_INTERNAL_STRINGS_HAVE_X86_DISPATCH
+//
+// Defined when SSSE3 and AVX2 kernels can be compiled into this translation
+// unit regardless of the baseline target, and selected at runtime.
+#ifdef ABSL_INTERNAL_STRINGS_HAVE_X86_DISPATCH
+#error ABSL_INTERNAL_STRINGS_HAVE_X86_DISPATCH cannot be directly set
+#elif ABSL_HAVE_CPP_ATTRIBUTE(gnu::target) && !defined(_MSC_VER) && \
+    (defined(__x86_64__) || defined(__i386__))
+#define ABSL_INTERNAL_STRINGS_HAVE_X86_DISPATCH 1
+#define ABSL_INTERNAL_STRINGS_TARGET_SSSE3 [[gnu::target("ssse3")]]
+#define ABSL_INTERNAL_STRINGS_TARGET_AVX2 [[gnu::target("avx2")]]
+#elif defined(_MSC_VER) && !defined(__clang__) && defined(_M_X64) && \
+    !defined(_M_ARM64EC)
+// MSVC makes all intrinsics available without target flags.
+#define ABSL_INTERNAL_STRINGS_HAVE_X86_DISPATCH 1
+#define ABSL_INTERNAL_STRINGS_TARGET_SSSE3
+#define ABSL_INTERNAL_STRINGS_TARGET_AVX2
+#endif
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+namespace strings_internal {
+
+// Instruction sets with dedicated string kernels, in increasing order of
+// preference on their architecture.
+enum class SimdLevel {
+  kScalar,
+  kSsse3,
+  kAvx2,
+  kNeon,
+};
+
+// Returns the best `SimdLevel` supported by the host. The result of CPU
+// detection is computed once and cached.
+SimdLevel GetSimdLevel();
+
+// Returns the `SimdLevel` that the string kernels should use. This is
+// `GetSimdLevel()` unless overridden by `SetSimdLevelForTesting()`.
+SimdLevel ActiveSimdLevel();
+
+// Overrides `ActiveSimdLevel()` so that tests can exercise every kernel the
+// host supports. Returns false (and leaves the active level unchanged) if
+// `level` is not supported by the host.
+bool SetSimdLevelForTesting(SimdLevel level);
+
+}  // namespace strings_internal
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_STRINGS_INTERNAL_SIMD_DISPATCH_H_
@@ -0,0 +1,47 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Test helpers for exercising every string kernel selected by
+// simd_dispatch.h.
+
+#ifndef ABSL_STRINGS_INTERNAL_SIMD_DISPATCH_TEST_UTIL_H_
+#define ABSL_STRINGS_INTERNAL_SIMD_DISPATCH_TEST_UTIL_H_
+
+#include "gtest/gtest.h"
+#include "absl/base/config.h"
+#include "absl/strings/internal/simd_dispatch.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+namespace strings_internal {
+
+// Runs `test` once for every `SimdLevel` supported by the host, including the
+// scalar fallback, with that level active. Restores the default level
+// afterwards.
+template <typename Test>
+void ForEachSimdLevel(Test test) {
+  for (SimdLevel level : {SimdLevel::kScalar, SimdLevel::kSsse3,
+                          SimdLevel::kAvx2, SimdLevel::kNeon}) {
+    if (!SetSimdLevelForTesting(level)) continue;
+    SCOPED_TRACE(static_cast<int>(level));
+    test();
+  }
+  SetSimdLevelForTesting(GetSimdLevel());
+}
+
+}  // namespace strings_internal
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_STRINGS_INTERNAL_SIMD_DISPATCH_TEST_UTIL_H_
@@ -0,0 +1,432 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef ABSL_STRINGS_INTERNAL_STR_FORMAT_PRECOMPILED_H_
+#define ABSL_STRINGS_INTERNAL_STR_FORMAT_PRECOMPILED_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "absl/base/config.h"
+#include "absl/base/const_init.h"
+#include "absl/base/optimization.h"
+#include "absl/strings/internal/resize_uninitialized.h"
+#include "absl/strings/internal/str_format/arg.h"
+#include "absl/strings/internal/str_format/bind.h"
+#include "absl/strings/internal/str_format/constexpr_parser.h"
+#include "absl/strings/internal/str_format/extension.h"
+#include "absl/strings/numbers.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+#include "absl/utility/utility.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+namespace str_format_internal {
+
+// Precompiled formats
+//
+// A precompiled format is a format string held in a `constexpr` character
+// array, which is split at compile time into literal pieces and conversions.
+// Formatting then runs a fixed sequence of appends and conversions, with no
+// parsing or argument binding at run time. Conversions of integers with `%d`,
+// `%i` or `%v` and of `std::string` and `absl::string_view` with `%s` or `%v`,
+// without flags, width or precision, skip the type-erased converters; when a
+// format uses only those, the result is sized exactly and written in one pass,
+// as `absl::StrCat()` does.
+
+// A conversion of a precompiled format. This holds the same information as
+// `UnboundConversion` in a form usable in constant expressions.
+struct PrecompiledConversion {
+  int arg_position = 0;
+  UnboundConversion::InputValue width;
+  UnboundConversion::InputValue precision;
+  Flags flags = Flags::kBasic;
+  LengthMod length_mod = LengthMod::none;
+  FormatConversionChar conv = FormatConversionCharInternal::kNone;
+};
+
+// A piece of a precompiled format: either `size` bytes of literal text at
+// offset `begin` of the format string, or the conversion with index
+// `conversion`.
+struct PrecompiledPiece {
+  size_t begin = 0;
+  size_t size = 0;
+  int conversion = -1;
+};
+
+constexpr size_t PrecompiledFormatLength(const char* format) {
+  size_t n = 0;
+  while (format[n] != '\0') ++n;
+  return n;
+}
+
+// Splits `format` into pieces. Writes the pieces and conversions to `pieces`
+// and `conversions` unless they are null, and their counts to `*num_pieces`
+// and `*num_conversions`. Returns false if the format is invalid.
+constexpr bool ParsePrecompiledFormat(string_view format,
+                                      PrecompiledPiece* pieces,
+                                      PrecompiledConversion* conversions,
+                                      size_t* num_pieces,
+                                      size_t* num_conversions) {
+  const char* const begin = format.data();
+  const char* const end = begin + format.size();
+  const char* p = begin;
+  int next_arg = 0;
+  size_t np = 0;
+  size_t nc = 0;
+  while (p != end) {
+    const char* literal = p;
+    while (p != end && *p != '%') ++p;
+    // For "%%", the literal piece includes the first '%'.
+    const bool escaped_percent = p != end && p + 1 != end && p[1] == '%';
+    if (escaped_percent) ++p;
+    if (p != literal) {
+      if (pieces != nullptr) {
+        pieces[np].begin = static_cast<size_t>(literal - begin);
+        pieces[np].size = static_cast<size_t>(p - literal);
+      }
+      ++np;
+    }
+    if (escaped_percent) {
+      ++p;
+      continue;
+    }
+    if (p == end) break;
+    if (p + 1 == end) return false;
+    UnboundConversion conv(absl::kConstInit);
+    p = ConsumeUnboundConversion(p + 1, end, &conv, &next_arg);
+    if (p == nullptr) return false;
+    if (pieces != nullptr) {
+      pieces[np].conversion = static_cast<int>(nc);
+      PrecompiledConversion& out = conversions[nc];
+      out.arg_position = conv.arg_position;
+      out.width = conv.width;
+      out.precision = conv.precision;
+      out.flags = conv.flags;
+      out.length_mod = conv.length_mod;
+      out.conv = conv.conv;
+    }
+    ++np;
+    ++nc;
+  }
+  *num_pieces = np;
+  *num_conversions = nc;
+  return true;
+}
+
+template <size_t kNumPieces, size_t kNumConversions>
+struct PrecompiledFormatTable {
+  bool valid = false;
+  PrecompiledPiece pieces[kNumPieces == 0 ? 1 : kNumPieces] = {};
+  PrecompiledConversion conversions[kNumConversions == 0 ? 1
+                                                         : kNumConversions] =
+      {};
+};
+
+// Checks that `table` converts exactly the arguments `1..kNumArgs`, and that
+// the argument with conversion set `arg_convs[i]` supports every conversion
+// applied to argument `i + 1`. The last entry of `arg_convs` is a sentinel.
+template <size_t kNumArgs, typename Table>
+constexpr bool PrecompiledArgsMatch(
+    const Table& table, size_t num_conversions,
+    const FormatConversionCharSet (&arg_convs)[kNumArgs + 1]) {
+  bool used[kNumArgs + 1] = {};
+  for (size_t i = 0; i < num_conversions; ++i) {
+    const PrecompiledConversion& conv = table.conversions[i];
+    if (conv.arg_position <= 0 ||
+        static_cast<size_t>(conv.arg_position) > kNumArgs) {
+      return false;
+    }
+    if (!Contains(arg_convs[conv.arg_position - 1], conv.conv)) return false;
+    used[conv.arg_position - 1] = true;
+    for (UnboundConversion::InputValue extra : {conv.width, conv.precision}) {
+      if (extra.is_from_arg()) {
+        const int pos = extra.get_from_arg();
+        if (pos <= 0 || static_cast<size_t>(pos) > kNumArgs) return false;
+        if (!Contains(arg_convs[pos - 1], '*')) return false;
+        used[pos - 1] = true;
+      }
+    }
+  }
+  for (size_t i = 0; i < kNumArgs; ++i) {
+    if (!used[i]) return false;
+  }
+  return true;
+}
+
+// Returns whether a basic `conv` of a `T` is formatted with
+// `numbers_internal::FastIntToBuffer()`.
+template <typename T>
+constexpr bool IsPrecompiledIntConversion(FormatConversionChar conv) {
+  using U = typename std::remove_cv<T>::type;
+  return (conv == FormatConversionCharInternal::d ||
+          conv == FormatConversionCharInternal::i ||
+          conv == FormatConversionCharInternal::v) &&
+         (std::is_same<U, short>::value ||               // NOLINT
+          std::is_same<U, unsigned short>::value ||      // NOLINT
+          std::is_same<U, int>::value ||                 // NOLINT
+          std::is_same<U, unsigned int>::value ||        // NOLINT
+          std::is_same<U, long>::value ||                // NOLINT
+          std::is_same<U, unsigned long>::value ||       // NOLINT
+          std::is_same<U, long long>::value ||           // NOLINT
+          std::is_same<U, unsigned long long>::value);   // NOLINT
+}
+
+// Returns whether a basic `conv` of a `T` appends the string as is.
+template <typename T>
+constexpr bool IsPrecompiledStringConversion(FormatConversionChar conv) {
+  using U = typename std::remove_cv<T>::type;
+  return (conv == FormatConversionCharInternal::s ||
+          conv == FormatConversionCharInternal::v) &&
+         (std::is_same<U, std::string>::value ||
+          std::is_same<U, absl::string_view>::value);
+}
+
+// Formats precompiled `Format` with arguments of types `Args...`.
+template <const char* Format, typename... Args>
+class PrecompiledFormatter {
+  static constexpr size_t kLength = PrecompiledFormatLength(Format);
+
+  struct Counts {
+    bool valid = false;
+    size_t pieces = 0;
+    size_t conversions = 0;
+  };
+  static constexpr Counts Count() {
+    Counts counts;
+    counts.valid = ParsePrecompiledFormat(string_view(Format, kLength),
+                                          nullptr, nullptr, &counts.pieces,
+                                          &counts.conversions);
+    return counts;
+  }
+  static constexpr Counts kCounts = Count();
+
+  using Table = PrecompiledFormatTable<kCounts.pieces, kCounts.conversions>;
+  static constexpr Table Build() {
+    Table table;
+    size_t num_pieces = 0;
+    size_t num_conversions = 0;
+    table.valid = ParsePrecompiledFormat(string_view(Format, kLength),
+                                         table.pieces, table.conversions,
+                                         &num_pieces, &num_conversions);
+    return table;
+  }
+  static constexpr Table kTable = Build();
+
+  static constexpr FormatConversionCharSet kArgConvs[sizeof...(Args) + 1] = {
+      ArgumentToConv<Args>()..., FormatConversionCharSetInternal::kStar};
+
+  static_assert(kCounts.valid, "Format string is not valid.");
+  static_assert(PrecompiledArgsMatch<sizeof...(Args)>(
+                    kTable, kCounts.conversions, kArgConvs),
+                "Passed arguments must match the conversion specifiers.");
+
+  using ArgTuple = std::tuple<const Args&...>;
+  template <size_t kConversion>
+  using ArgType = typename std::remove_reference<typename std::tuple_element<
+      static_cast<size_t>(kTable.conversions[kConversion].arg_position - 1),
+      ArgTuple>::type>::type;
+
+  // Returns whether conversion `kConversion` can be written without a sink.
+  template <size_t kConversion>
+  static constexpr bool IsFastConversion() {
+    constexpr PrecompiledConversion conv = kTable.conversions[kConversion];
+    return conv.flags == Flags::kBasic &&
+           (IsPrecompiledIntConversion<ArgType<kConversion>>(conv.conv) ||
+            IsPrecompiledStringConversion<ArgType<kConversion>>(conv.conv));
+  }
+
+  template <size_t... I>
+  static constexpr bool AllFast(absl::index_sequence<I...>) {
+    bool fast[] = {true, IsFastConversion<I>()...};
+    for (bool b : fast) {
+      if (!b) return false;
+    }
+    return true;
+  }
+
+  static constexpr size_t LiteralSize() {
+    size_t size = 0;
+    for (size_t i = 0; i < kCounts.pieces; ++i) {
+      if (kTable.pieces[i].conversion < 0) size += kTable.pieces[i].size;
+    }
+    return size;
+  }
+
+  template <size_t kConversion>
+  static const auto& Arg(const ArgTuple& args) {
+    return std::get<static_cast<size_t>(
+        kTable.conversions[kConversion].arg_position - 1)>(args);
+  }
+
+  // Fast path: returns the text of piece `kPiece`, formatting integers into
+  // `buffers`.
+  template <size_t kPiece>
+  static string_view PieceText(const ArgTuple& args,
+                               char (*buffers)[numbers_internal::
+                                                   kFastToBufferSize]) {
+    constexpr PrecompiledPiece piece = kTable.pieces[kPiece];
+    if constexpr (piece.conversion < 0) {
+      return string_view(Format + piece.begin, piece.size);
+    } else {
+      constexpr size_t kConversion = static_cast<size_t>(piece.conversion);
+      const auto& arg = Arg<kConversion>(args);
+      if constexpr (IsPrecompiledIntConversion<ArgType<kConversion>>(
+                        kTable.conversions[kConversion].conv)) {
+        char* const buffer = buffers[kConversion];
+        const char* const end = numbers_internal::FastIntToBuffer(arg, buffer);
+        return string_view(buffer, static_cast<size_t>(end - buffer));
+      } else {
+        return string_view(arg);
+      }
+    }
+  }
+
+  template <size_t... I>
+  static void AppendFast(std::string* out, const ArgTuple& args,
+                         absl::index_sequence<I...>) {
+    char buffers[kCounts.conversions == 0 ? 1 : kCounts.conversions]
+                [numbers_internal::kFastToBufferSize];
+    static_cast<void>(buffers);  // Unused for formats without conversions.
+    const string_view pieces[] = {string_view(), PieceText<I>(args, buffers)...};
+    size_t total = 0;
+    for (string_view piece : pieces) total += piece.size();
+    const size_t old_size = out->size();
+    strings_internal::STLStringResizeUninitializedAmortized(out,
+                                                            old_size + total);
+    char* dest = &(*out)[old_size];
+    for (string_view piece : pieces) {
+      if (!piece.empty()) std::memcpy(dest, piece.data(), piece.size());
+      dest += piece.size();
+    }
+  }
+
+  // General path: writes conversion `kConversion` to `sink`.
+  template <size_t kConversion>
+  static bool Convert(const ArgTuple& args,
+                      absl::Span<const FormatArgImpl> pack,
+                      FormatSinkImpl* sink) {
+    constexpr PrecompiledConversion conv = kTable.conversions[kConversion];
+    if constexpr (IsFastConversion<kConversion>()) {
+      char buffer[1][numbers_internal::kFastToBufferSize];
+      sink->Append(PieceTextForConversion<kConversion>(args, buffer));
+      return true;
+    } else if constexpr (conv.width.is_from_arg() ||
+                         conv.precision.is_from_arg()) {
+      UnboundConversion unbound;
+      unbound.arg_position = conv.arg_position;
+      unbound.width = conv.width;
+      unbound.precision = conv.precision;
+      unbound.flags = conv.flags;
+      unbound.length_mod = conv.length_mod;
+      unbound.conv = conv.conv;
+      BoundConversion bound;
+      if (!BindWithPack(&unbound, pack, &bound)) return false;
+      return FormatArgImplFriend::Convert(*bound.arg(), bound, sink);
+    } else {
+      FormatConversionSpecImpl spec;
+      FormatConversionSpecImplFriend::SetConversionChar(conv.conv, &spec);
+      FormatConversionSpecImplFriend::SetFlags(conv.flags, &spec);
+      FormatConversionSpecImplFriend::SetLengthMod(
+          conv.flags == Flags::kBasic ? LengthMod::none : conv.length_mod,
+          &spec);
+      FormatConversionSpecImplFriend::SetWidth(conv.width.value(), &spec);
+      FormatConversionSpecImplFriend::SetPrecision(conv.precision.value(),
+                                                   &spec);
+      return FormatArgImplFriend::Convert(
+          pack[static_cast<size_t>(conv.arg_position - 1)], spec, sink);
+    }
+  }
+
+  template <size_t kConversion>
+  static string_view PieceTextForConversion(
+      const ArgTuple& args,
+      char (*buffer)[numbers_internal::kFastToBufferSize]) {
+    const auto& arg = Arg<kConversion>(args);
+    if constexpr (IsPrecompiledIntConversion<ArgType<kConversion>>(
+                      kTable.conversions[kConversion].conv)) {
+      const char* const end = numbers_internal::FastIntToBuffer(arg, *buffer);
+      return string_view(*buffer, static_cast<size_t>(end - *buffer));
+    } else {
+      return string_view(arg);
+    }
+  }
+
+  template <size_t kPiece>
+  static bool Emit(const ArgTuple& args, absl::Span<const FormatArgImpl> pack,
+                   FormatSinkImpl* sink) {
+    constexpr PrecompiledPiece piece = kTable.pieces[kPiece];
+    if constexpr (piece.conversion < 0) {
+      sink->Append(string_view(Format + piece.begin, piece.size));
+      return true;
+    } else {
+      return Convert<static_cast<size_t>(piece.conversion)>(args, pack, sink);
+    }
+  }
+
+  template <size_t... I>
+  static bool EmitAll(const ArgTuple& args,
+                      absl::Span<const FormatArgImpl> pack,
+                      FormatSinkImpl* sink, absl::index_sequence<I...>) {
+    bool ok = true;
+    // Stops at the first failed conversion.
+    static_cast<void>(std::initializer_list<bool>{
+        true, (ok = ok && Emit<I>(args, pack, sink))...});
+    return ok;
+  }
+
+ public:
+  // Whether every conversion takes the fast path.
+  static constexpr bool kAllFast =
+      AllFast(absl::make_index_sequence<kCounts.conversions>());
+
+  // An estimate of the output size, used to reserve the output on the
+  // general path: the literal text plus 16 characters per conversion. The
+  // formatted output may be shorter or longer.
+  static constexpr size_t kSizeEstimate =
+      LiteralSize() + 16 * kCounts.conversions;
+
+  // Appends the formatted output to `*out`. Returns false and leaves `*out`
+  // with unspecified contents if a conversion fails.
+  static bool Append(std::string* out, const Args&... args) {
+    const ArgTuple arg_tuple(args...);
+    if constexpr (kAllFast) {
+      AppendFast(out, arg_tuple, absl::make_index_sequence<kCounts.pieces>());
+      return true;
+    } else {
+      if (out->capacity() - out->size() < kSizeEstimate) {
+        // Grow geometrically, so that appending in a loop stays linear.
+        out->reserve((std::max)(2 * out->capacity(),
+                                out->size() + kSizeEstimate));
+      }
+      const FormatArgImpl pack[] = {FormatArgImpl(args)..., FormatArgImpl(0)};
+      FormatSinkImpl sink(out);
+      return EmitAll(arg_tuple,
+                     absl::Span<const FormatArgImpl>(pack, sizeof...(Args)),
+                     &sink, absl::make_index_sequence<kCounts.pieces>());
+    }
+  }
+};
+
+}  // namespace str_format_internal
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_STRINGS_INTERNAL_STR_FORMAT_PRECOMPILED_H_
@@ -18,6 +18,7 @@
 
 #include "absl/base/internal/endian.h"
 #include "absl/base/internal/raw_logging.h"
+#include "absl/strings/internal/escaping_simd.h"
 
 namespace absl {
 ABSL_NAMESPACE_BEGIN
@@ -111,6 +112,13 @@ size_t Base64EscapeInternal(const unsigned char* src, size_t szsrc, char* dest,
   // If do_padding is true, padding at the end of the data is performed. This
   // output padding uses the '=' character.
 
+  // Bulk-encode with the vector kernel, if any; it leaves a short tail.
+  const size_t simd_consumed =
+      Base64EscapeSimd(cur_src, szsrc, cur_dest, base64);
+  cur_src += simd_consumed;
+  cur_dest += simd_consumed / 3 * 4;
+  szsrc -= simd_consumed;
+
   // Three bytes of data encodes to four characters of cyphertext.
   // So we can pump through three-byte chunks atomically.
   if (szsrc >= 3) {                    // "limit_src - 3" is UB if szsrc < 3.
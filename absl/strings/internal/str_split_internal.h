@@ -29,8 +29,10 @@
 #ifndef ABSL_STRINGS_INTERNAL_STR_SPLIT_INTERNAL_H_
 #define ABSL_STRINGS_INTERNAL_STR_SPLIT_INTERNAL_H_
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <initializer_list>
 #include <iterator>
 #include <tuple>
@@ -38,9 +40,13 @@
 #include <utility>
 #include <vector>
 
+#include "absl/base/attributes.h"
 #include "absl/base/macros.h"
 #include "absl/base/port.h"
+#include "absl/base/nullability.h"
 #include "absl/meta/type_traits.h"
+#include "absl/numeric/bits.h"
+#include "absl/strings/charset.h"
 #include "absl/strings/string_view.h"
 
 #ifdef _GLIBCXX_DEBUG
@@ -75,6 +81,159 @@ class ConvertibleToStringView {
   absl::string_view value_;
 };
 
+// Classifies bytes against a fixed set of single-byte delimiters, 64 bytes at
+// a time, using SSSE3/AVX2 (selected at runtime) or NEON where available.
+// A single delimiter is found with byte comparisons. Larger sets are found with
+// two 16-entry nibble tables: each distinct high nibble in the set gets one of
+// eight bucket bits, `high_` maps a high nibble to its bucket and `low_` maps a
+// low nibble to the buckets whose rows contain it, so `b` is in the set iff
+// `low_[b & 0xF] & high_[b >> 4]` is nonzero. Sets spanning more than eight
+// high nibbles fall back to a `CharSet` lookup per byte.
+class ByteSetMatcher {
+ public:
+  // Matches nothing; `enabled()` is false.
+  ByteSetMatcher() = default;
+  explicit ByteSetMatcher(char c);
+  explicit ByteSetMatcher(absl::string_view chars);
+
+  bool enabled() const { return kind_ != Kind::kNone; }
+
+  // Returns whether the set holds exactly one byte, `single()`.
+  bool is_single() const { return kind_ == Kind::kSingle; }
+  char single() const { return single_; }
+
+  // Returns a mask with bit `i` set iff `p[i]` is in the set, for `i < n`.
+  // Requires `n <= 64`.
+  uint64_t Match(const char* absl_nonnull p, size_t n) const;
+
+ private:
+  enum class Kind : uint8_t { kNone, kSingle, kNibbles, kGeneric };
+
+  uint64_t Match64(const char* absl_nonnull p) const;
+
+  Kind kind_ = Kind::kNone;
+  char single_ = 0;
+  alignas(16) uint8_t low_[16] = {};
+  alignas(16) uint8_t high_[16] = {};
+  absl::CharSet set_;  // Only set for `Kind::kGeneric`.
+};
+
+// Finds the delimiters recognized by a `ByteSetMatcher`, which must outlive
+// the scanner. The match mask for the block of up to 64 bytes starting at the
+// last scanned position is cached, so successive searches with increasing
+// `pos` over the same text visit each byte once, and finding the next delimiter
+// within a block is a bit scan.
+class DelimiterBlockScanner {
+ public:
+  explicit DelimiterBlockScanner(
+      const ByteSetMatcher& matcher ABSL_ATTRIBUTE_LIFETIME_BOUND)
+      : matcher_(&matcher) {}
+
+  bool enabled() const { return matcher_->enabled(); }
+
+  // Returns the position of the first delimiter in `text` at or after `pos`,
+  // or `absl::string_view::npos`. All calls must pass the same `text`.
+  size_t Find(absl::string_view text, size_t pos) {
+    if (use_memchr_) {
+      const size_t found = text.find(matcher_->single(), pos);
+      // Return to the block kernels once fields get short again.
+      if (found - pos < 32) use_memchr_ = false;
+      return found;
+    }
+    while (pos < text.size()) {
+      if (pos < block_begin_ || pos >= block_end_) {
+        const size_t n = (std::min)(text.size() - pos, size_t{64});
+        mask_ = matcher_->Match(text.data() + pos, n);
+        block_begin_ = pos;
+        block_end_ = pos + n;
+      }
+      const uint64_t m = mask_ >> (pos - block_begin_);
+      if (m != 0) return pos + static_cast<size_t>(absl::countr_zero(m));
+      pos = block_end_;
+      if (mask_ == 0 && matcher_->is_single()) {
+        // A whole block without delimiters suggests long fields, which
+        // `memchr()` skips over faster than the block kernels.
+        use_memchr_ = true;
+        block_end_ = 0;
+        return text.find(matcher_->single(), pos);
+      }
+    }
+    return absl::string_view::npos;
+  }
+
+ private:
+  const ByteSetMatcher* absl_nonnull matcher_;
+  size_t block_begin_ = 0;
+  size_t block_end_ = 0;
+  uint64_t mask_ = 0;
+  bool use_memchr_ = false;
+};
+
+// HasByteSetMatcher<Delimiter>::value is true iff `Delimiter` always matches a
+// single byte from a fixed set, which it advertises by providing
+// `ByteSetMatcherFor(const Delimiter&)` (found by ADL).
+template <typename Delimiter, typename = void>
+struct HasByteSetMatcher : std::false_type {};
+template <typename Delimiter>
+struct HasByteSetMatcher<
+    Delimiter,
+    absl::void_t<decltype(ByteSetMatcherFor(std::declval<const Delimiter&>()))>>
+    : std::true_type {};
+
+// Holds the `ByteSetMatcher` of a delimiter that has one, so that a Splitter
+// builds it once for all of its iterators. Empty for other delimiters.
+template <typename Delimiter, bool = HasByteSetMatcher<Delimiter>::value>
+class DelimiterMatcher {
+ public:
+  explicit DelimiterMatcher(const Delimiter&) {}
+};
+
+template <typename Delimiter>
+class DelimiterMatcher<Delimiter, true> {
+ public:
+  explicit DelimiterMatcher(const Delimiter& delimiter)
+      : matcher_(ByteSetMatcherFor(delimiter)) {}
+
+  const ByteSetMatcher& get() const { return matcher_; }
+
+ private:
+  ByteSetMatcher matcher_;
+};
+
+// Locates delimiters for a SplitIterator. By default this simply calls the
+// delimiter's `Find()`; delimiters with a `ByteSetMatcher` are instead found
+// with a `DelimiterBlockScanner`.
+template <typename Delimiter, bool = HasByteSetMatcher<Delimiter>::value>
+class DelimiterFinder {
+ public:
+  explicit DelimiterFinder(const DelimiterMatcher<Delimiter>&) {}
+
+  absl::string_view Find(Delimiter& delimiter, absl::string_view text,
+                         size_t pos) {
+    return delimiter.Find(text, pos);
+  }
+};
+
+template <typename Delimiter>
+class DelimiterFinder<Delimiter, true> {
+ public:
+  explicit DelimiterFinder(const DelimiterMatcher<Delimiter>& matcher)
+      : scanner_(matcher.get()) {}
+
+  absl::string_view Find(Delimiter& delimiter, absl::string_view text,
+                         size_t pos) {
+    if (!scanner_.enabled()) return delimiter.Find(text, pos);
+    const size_t found = scanner_.Find(text, pos);
+    if (found == absl::string_view::npos) {
+      return absl::string_view(text.data() + text.size(), 0);
+    }
+    return absl::string_view(text.data() + found, 1);
+  }
+
+ private:
+  DelimiterBlockScanner scanner_;
+};
+
 // An iterator that enumerates the parts of a string from a Splitter. The text
 // to be split, the Delimiter, and the Predicate are all taken from the given
 // Splitter object. Iterators may only be compared if they refer to the same
@@ -96,6 +255,7 @@ class SplitIterator {
         state_(state),
         splitter_(splitter),
         delimiter_(splitter->delimiter()),
+        finder_(splitter->delimiter_matcher()),
         predicate_(splitter->predicate()) {
     // Hack to maintain backward compatibility. This one block makes it so an
     // empty absl::string_view whose .data() happens to be nullptr behaves
@@ -131,7 +291,7 @@ class SplitIterator {
         return *this;
       }
       const absl::string_view text = splitter_->text();
-      const absl::string_view d = delimiter_.Find(text, pos_);
+      const absl::string_view d = finder_.Find(delimiter_, text, pos_);
       if (d.data() == text.data() + text.size()) state_ = kLastState;
       curr_ = text.substr(pos_,
                           static_cast<size_t>(d.data() - (text.data() + pos_)));
@@ -160,6 +320,7 @@ class SplitIterator {
   absl::string_view curr_;
   const Splitter* splitter_;
   typename Splitter::DelimiterType delimiter_;
+  DelimiterFinder<typename Splitter::DelimiterType> finder_;
   typename Splitter::PredicateType predicate_;
 };
 
@@ -290,10 +451,14 @@ class Splitter {
   Splitter(StringType input_text, Delimiter d, Predicate p)
       : text_(std::move(input_text)),
         delimiter_(std::move(d)),
+        delimiter_matcher_(delimiter_),
         predicate_(std::move(p)) {}
 
   absl::string_view text() const { return text_; }
   const Delimiter& delimiter() const { return delimiter_; }
+  const DelimiterMatcher<Delimiter>& delimiter_matcher() const {
+    return delimiter_matcher_;
+  }
   const Predicate& predicate() const { return predicate_; }
 
   // Range functions that iterate the split substrings as absl::string_view
@@ -510,6 +675,7 @@ class Splitter {
 
   StringType text_;
   Delimiter delimiter_;
+  DelimiterMatcher<Delimiter> delimiter_matcher_;
   Predicate predicate_;
 };
 
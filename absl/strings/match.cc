@@ -15,6 +15,7 @@
 #include "absl/strings/match.h"
 
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
 
 #include "absl/base/config.h"
@@ -22,6 +23,7 @@
 #include "absl/base/optimization.h"
 #include "absl/numeric/bits.h"
 #include "absl/strings/ascii.h"
+#include "absl/strings/internal/ascii_simd.h"
 #include "absl/strings/internal/memutil.h"
 #include "absl/strings/string_view.h"
 
@@ -38,9 +40,24 @@ bool EqualsIgnoreCase(absl::string_view piece1,
 
 bool StrContainsIgnoreCase(absl::string_view haystack,
                            absl::string_view needle) noexcept {
-  while (haystack.size() >= needle.size()) {
-    if (StartsWithIgnoreCase(haystack, needle)) return true;
-    haystack.remove_prefix(1);
+  if (needle.empty()) return true;
+  if (haystack.size() < needle.size()) return false;
+  // The SIMD search rules out all but the last few start positions, unless the
+  // haystack is too short for it.
+  size_t pos;
+  if (strings_internal::FindIgnoreCaseSimd(haystack.data(), haystack.size(),
+                                           needle.data(), needle.size(),
+                                           &pos)) {
+    return true;
+  }
+  const char first = absl::ascii_tolower(static_cast<unsigned char>(needle[0]));
+  for (; pos <= haystack.size() - needle.size(); ++pos) {
+    if (absl::ascii_tolower(static_cast<unsigned char>(haystack[pos])) ==
+            first &&
+        strings_internal::memcasecmp(haystack.data() + pos, needle.data(),
+                                     needle.size()) == 0) {
+      return true;
+    }
   }
   return false;
 }
@@ -0,0 +1,89 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstddef>
+#include <string>
+
+#include "absl/profiling/benchmark.h"
+#include "absl/strings/ascii.h"
+#include "absl/strings/match.h"
+#include "absl/strings/string_view.h"
+
+namespace {
+
+// Returns `size` bytes of text that resembles HTTP headers.
+std::string MakeText(size_t size) {
+  static constexpr absl::string_view kHeaders =
+      "Accept: text/html\r\nAccept-Encoding: gzip, deflate\r\n"
+      "Cache-Control: no-cache\r\nConnection: keep-alive\r\n"
+      "User-Agent: Mozilla/5.0 (X11; Linux x86_64)\r\n";
+  std::string text;
+  while (text.size() < size) text.append(kHeaders.data(), kHeaders.size());
+  text.resize(size);
+  return text;
+}
+
+// Compares equal strings that differ only in case. Sizes cover header names
+// and values as well as kilobyte-sized bodies.
+void BM_EqualsIgnoreCase(benchmark::State& state) {
+  const std::string a = MakeText(static_cast<size_t>(state.range(0)));
+  const std::string b = absl::AsciiStrToUpper(a);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(b);
+    benchmark::DoNotOptimize(absl::EqualsIgnoreCase(a, b));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_EqualsIgnoreCase)
+    ->Arg(10)
+    ->Arg(24)
+    ->Arg(64)
+    ->Arg(1 << 10)
+    ->Arg(16 << 10);
+
+// Searches for a needle that is absent, so that every position is examined.
+void BM_StrContainsIgnoreCaseMiss(benchmark::State& state) {
+  const std::string haystack = MakeText(static_cast<size_t>(state.range(0)));
+  const std::string needle = "CONTENT-LENGTH";
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(haystack);
+    benchmark::DoNotOptimize(absl::StrContainsIgnoreCase(haystack, needle));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StrContainsIgnoreCaseMiss)
+    ->Arg(24)
+    ->Arg(64)
+    ->Arg(1 << 10)
+    ->Arg(16 << 10);
+
+// Searches for a needle at the end of the haystack.
+void BM_StrContainsIgnoreCaseHit(benchmark::State& state) {
+  std::string haystack = MakeText(static_cast<size_t>(state.range(0)));
+  haystack += "Content-Length: 0";
+  const std::string needle = "content-length";
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(haystack);
+    benchmark::DoNotOptimize(absl::StrContainsIgnoreCase(haystack, needle));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StrContainsIgnoreCaseHit)
+    ->Arg(24)
+    ->Arg(64)
+    ->Arg(1 << 10)
+    ->Arg(16 << 10);
+
+}  // namespace
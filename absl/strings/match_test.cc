@@ -14,13 +14,18 @@
 
 #include "absl/strings/match.h"
 
+#include <cstddef>
 #include <string>
 
 #include "gtest/gtest.h"
+#include "absl/strings/ascii.h"
+#include "absl/strings/internal/simd_dispatch_test_util.h"
 #include "absl/strings/string_view.h"
 
 namespace {
 
+using absl::strings_internal::ForEachSimdLevel;
+
 TEST(MatchTest, StartsWith) {
   const std::string s1("123\0abc", 7);
   const absl::string_view a("foobar");
@@ -141,6 +146,67 @@ TEST(MatchTest, ContainsIgnoreCase) {
   EXPECT_FALSE(absl::StrContainsIgnoreCase("", "a"));
 }
 
+bool NaiveContainsIgnoreCase(absl::string_view haystack,
+                             absl::string_view needle) {
+  return absl::AsciiStrToLower(haystack).find(
+             absl::AsciiStrToLower(needle)) != std::string::npos;
+}
+
+TEST(MatchTest, EqualsIgnoreCaseLong) {
+  const std::string lower = "content-type: text/html; charset=utf-8 and more";
+  const std::string upper = absl::AsciiStrToUpper(lower);
+  ForEachSimdLevel([&] {
+    for (size_t size = 0; size <= lower.size(); ++size) {
+      EXPECT_TRUE(absl::EqualsIgnoreCase(lower.substr(0, size),
+                                         upper.substr(0, size)));
+      // A difference at any position is found, including differences in
+      // non-letters whose case bit differs.
+      for (size_t pos = 0; pos < size; ++pos) {
+        std::string other = upper.substr(0, size);
+        other[pos] = static_cast<char>(other[pos] ^ 0x01);
+        EXPECT_FALSE(absl::EqualsIgnoreCase(lower.substr(0, size), other));
+        other[pos] = static_cast<char>(upper[pos] ^ 0x20);
+        EXPECT_EQ(absl::EqualsIgnoreCase(lower.substr(0, size), other),
+                  absl::ascii_isalpha(static_cast<unsigned char>(upper[pos])))
+            << size << " " << pos;
+      }
+    }
+  });
+}
+
+TEST(MatchTest, ContainsIgnoreCaseLong) {
+  std::string haystack;
+  for (size_t i = 0; i < 200; ++i) {
+    haystack.push_back(static_cast<char>("aBcDxyz@[`{"[i * 7 % 11]));
+  }
+  ForEachSimdLevel([&] {
+    for (size_t needle_size : {1, 2, 3, 5, 16, 17, 33, 100}) {
+      for (size_t start = 0; start + needle_size <= haystack.size();
+           start += 7) {
+        const absl::string_view needle =
+            absl::string_view(haystack).substr(start, needle_size);
+        const std::string upper = absl::AsciiStrToUpper(needle);
+        for (size_t size = needle_size; size <= haystack.size(); size += 13) {
+          const absl::string_view text =
+              absl::string_view(haystack).substr(0, size);
+          ASSERT_EQ(absl::StrContainsIgnoreCase(text, upper),
+                    NaiveContainsIgnoreCase(text, upper))
+              << size << " " << start << " " << needle_size;
+          std::string missing = upper;
+          missing[needle_size / 2] = '#';
+          ASSERT_FALSE(absl::StrContainsIgnoreCase(text, missing))
+              << size << " " << start << " " << needle_size;
+        }
+      }
+    }
+    // The first and last bytes match at many positions, but the middle does
+    // not.
+    const std::string text(1000, 'a');
+    EXPECT_FALSE(absl::StrContainsIgnoreCase(text, "AbA"));
+    EXPECT_TRUE(absl::StrContainsIgnoreCase(text + "aBa", "AbA"));
+  });
+}
+
 TEST(MatchTest, ContainsCharIgnoreCase) {
   absl::string_view a("AaBCdefg!");
   absl::string_view b("AaBCd!");
@@ -1086,6 +1086,28 @@ inline bool safe_uint_internal(absl::string_view text,
   }
   return safe_parse_positive_int(text, base, value_p);
 }
+
+// Returns whether the eight bytes of `chunk` are all ASCII digits: each byte
+// must have a high nibble of 3, and must still have one after adding 6.
+inline bool IsEightDigits(uint64_t chunk) {
+  return ((chunk & 0xF0F0F0F0F0F0F0F0) |
+          (((chunk + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4)) ==
+         0x3333333333333333;
+}
+
+// Converts eight ASCII digits, loaded little-endian so that the first digit is
+// in the low byte, to their value. Adjacent digits are combined pairwise, then
+// the resulting four two-digit values are combined with two multiplications.
+inline uint32_t ParseEightDigits(uint64_t chunk) {
+  constexpr uint64_t kMask = 0x000000FF000000FF;
+  constexpr uint64_t kMul1 = 100 + (1000000ULL << 32);
+  constexpr uint64_t kMul2 = 1 + (10000ULL << 32);
+  chunk -= 0x3030303030303030;
+  chunk = (chunk * 10) + (chunk >> 8);
+  chunk = (((chunk & kMask) * kMul1) + (((chunk >> 16) & kMask) * kMul2)) >> 32;
+  return static_cast<uint32_t>(chunk);
+}
+
 }  // anonymous namespace
 
 namespace numbers_internal {
@@ -1162,6 +1184,41 @@ bool safe_strtou128_base(absl::string_view text, uint128* absl_nonnull value,
   return safe_uint_internal<absl::uint128>(text, value, base);
 }
 
+bool ParseDecimalFast(absl::string_view text, uint64_t* absl_nonnull magnitude,
+                      bool* absl_nonnull negative) {
+  const char* p = text.data();
+  size_t n = text.size();
+  *negative = false;
+  if (n != 0 && (*p == '-' || *p == '+')) {
+    *negative = *p == '-';
+    ++p;
+    --n;
+  }
+  // 19 digits cannot overflow a uint64_t.
+  if (n == 0 || n > 19) return false;
+
+  // Left-pad the leading partial group with '0's so every group is exactly
+  // eight digits.
+  uint64_t value = 0;
+  const size_t head = n % 8;
+  if (head != 0) {
+    char buf[8] = {'0', '0', '0', '0', '0', '0', '0', '0'};
+    std::memcpy(buf + 8 - head, p, head);
+    const uint64_t chunk = little_endian::Load64(buf);
+    if (!IsEightDigits(chunk)) return false;
+    value = ParseEightDigits(chunk);
+    p += head;
+    n -= head;
+  }
+  for (; n != 0; n -= 8, p += 8) {
+    const uint64_t chunk = little_endian::Load64(p);
+    if (!IsEightDigits(chunk)) return false;
+    value = value * 100000000 + ParseEightDigits(chunk);
+  }
+  *magnitude = value;
+  return true;
+}
+
 }  // namespace numbers_internal
 ABSL_NAMESPACE_END
 }  // namespace absl
@@ -39,6 +39,7 @@
 #include <limits>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 #include "absl/base/attributes.h"
 #include "absl/base/config.h"
@@ -48,7 +49,9 @@
 #include "absl/base/port.h"
 #include "absl/numeric/bits.h"
 #include "absl/numeric/int128.h"
+#include "absl/strings/internal/resize_uninitialized.h"
 #include "absl/strings/string_view.h"
+#include "absl/types/span.h"
 
 namespace absl {
 ABSL_NAMESPACE_BEGIN
@@ -117,6 +120,57 @@ template <typename int_type>
 [[nodiscard]] inline bool SimpleHexAtoi(absl::string_view str,
                                         absl::uint128* absl_nonnull out);
 
+// SimpleAtoiBatch()
+//
+// Converts each element of `strs` as if by `SimpleAtoi()`, storing the result
+// in the corresponding element of `out`, which must be at least as large as
+// `strs`. Returns the number of leading elements converted successfully, which
+// is `strs.size()` if every conversion succeeded. Elements of `out` at and
+// after the first failure are left in an unspecified state.
+//
+// Fields consisting of an optional sign and at most 19 decimal digits, with no
+// surrounding whitespace, take a fast path that converts eight digits at a
+// time; any other field is handed to `SimpleAtoi()`.
+//
+// Example:
+//
+//   std::vector<absl::string_view> fields = absl::StrSplit(line, '\t');
+//   std::vector<int64_t> values(fields.size());
+//   if (absl::SimpleAtoiBatch(fields, absl::MakeSpan(values)) !=
+//       fields.size()) {
+//     return absl::InvalidArgumentError("malformed record");
+//   }
+template <typename int_type>
+[[nodiscard]] size_t SimpleAtoiBatch(absl::Span<const absl::string_view> strs,
+                                     absl::Span<int_type> out);
+
+// SimpleAtoiDelimited()
+//
+// Splits `text` on `delimiter` and appends each field, converted as if by
+// `SimpleAtoi()`, to `out`. Returns `false` if a field fails to convert, in
+// which case the fields preceding it have been appended. Empty `text` contains
+// no fields.
+template <typename int_type>
+[[nodiscard]] bool SimpleAtoiDelimited(absl::string_view text, char delimiter,
+                                       std::vector<int_type>* absl_nonnull out);
+
+// AppendIntegersDelimited()
+//
+// Appends the decimal representation of each element of `values` to `dest`,
+// separated by `delimiter`. This is equivalent to, but considerably faster
+// than, `absl::StrAppend()`-ing each value in turn, as `dest` is grown only
+// once and the digits are written directly into it.
+//
+// Example:
+//
+//   std::vector<int> ids = {3, 14, 15};
+//   std::string s = "ids=";
+//   absl::AppendIntegersDelimited(absl::MakeConstSpan(ids), ',', &s);
+//   // s == "ids=3,14,15"
+template <typename int_type>
+void AppendIntegersDelimited(absl::Span<const int_type> values, char delimiter,
+                             std::string* absl_nonnull dest);
+
 ABSL_NAMESPACE_END
 }  // namespace absl
 
@@ -223,6 +277,13 @@ char* absl_nonnull FastIntToBuffer(int_type i, char* absl_nonnull buffer)
   }
 }
 
+// Parses `text` if it consists of an optional `+` or `-` followed by one to 19
+// decimal digits, storing the absolute value in `*magnitude` and the sign in
+// `*negative`. Returns `false`, without diagnosing anything, for any other
+// input; callers fall back to `safe_strtoi_base()` in that case.
+bool ParseDecimalFast(absl::string_view text, uint64_t* absl_nonnull magnitude,
+                      bool* absl_nonnull negative);
+
 // Implementation of SimpleAtoi, generalized to support arbitrary base (used
 // with base different from 10 elsewhere in Abseil implementation).
 template <typename int_type>
@@ -306,6 +367,34 @@ inline size_t FastHexToBufferZeroPad16(uint64_t val, char* absl_nonnull out) {
   return 16 - static_cast<size_t>(countl_zero(val | 0x1) / 4);
 }
 
+// Equivalent to `safe_strtoi_base(text, out, 10)`, but tries
+// `ParseDecimalFast()` first.
+template <typename int_type>
+[[nodiscard]] bool SimpleAtoiFast(absl::string_view text,
+                                  int_type* absl_nonnull out) {
+  static_assert(sizeof(*out) <= 64 / 8,
+                "SimpleAtoiFast works only with 64-bit-or-less integers.");
+  uint64_t magnitude;
+  bool negative;
+  if (ParseDecimalFast(text, &magnitude, &negative)) {
+    if (!negative) {
+      if (magnitude <= static_cast<uint64_t>(
+                           (std::numeric_limits<int_type>::max)())) {
+        *out = static_cast<int_type>(magnitude);
+        return true;
+      }
+    } else if (is_signed<int_type>()) {
+      // The magnitude of the minimum value is one more than the maximum.
+      if (magnitude - 1 <= static_cast<uint64_t>(
+                              (std::numeric_limits<int_type>::max)())) {
+        *out = static_cast<int_type>(0 - magnitude);
+        return true;
+      }
+    }
+  }
+  return safe_strtoi_base(text, out, 10);
+}
+
 }  // namespace numbers_internal
 
 template <typename int_type>
@@ -340,6 +429,53 @@ template <typename int_type>
   return numbers_internal::safe_strtou128_base(str, out, 16);
 }
 
+template <typename int_type>
+[[nodiscard]] size_t SimpleAtoiBatch(absl::Span<const absl::string_view> strs,
+                                     absl::Span<int_type> out) {
+  ABSL_HARDENING_ASSERT(out.size() >= strs.size());
+  for (size_t i = 0; i < strs.size(); ++i) {
+    if (!numbers_internal::SimpleAtoiFast(strs[i], &out[i])) return i;
+  }
+  return strs.size();
+}
+
+template <typename int_type>
+[[nodiscard]] bool SimpleAtoiDelimited(absl::string_view text, char delimiter,
+                                       std::vector<int_type>* absl_nonnull
+                                           out) {
+  if (text.empty()) return true;
+  while (true) {
+    const size_t end = text.find(delimiter);
+    int_type value;
+    if (!numbers_internal::SimpleAtoiFast(text.substr(0, end), &value)) {
+      return false;
+    }
+    out->push_back(value);
+    if (end == absl::string_view::npos) return true;
+    text.remove_prefix(end + 1);
+  }
+}
+
+template <typename int_type>
+void AppendIntegersDelimited(absl::Span<const int_type> values, char delimiter,
+                             std::string* absl_nonnull dest) {
+  if (values.empty()) return;
+  const size_t orig_size = dest->size();
+  // Each value takes at most 20 characters plus a delimiter, and
+  // `FastIntToBuffer()` may scribble up to `kFastToBufferSize` bytes past the
+  // start of the last one.
+  strings_internal::STLStringResizeUninitializedAmortized(
+      dest, orig_size + 21 * values.size() + numbers_internal::kFastToBufferSize);
+  char* const begin = &(*dest)[0];
+  char* out = begin + orig_size;
+  out = numbers_internal::FastIntToBuffer(values[0], out);
+  for (size_t i = 1; i < values.size(); ++i) {
+    *out++ = delimiter;
+    out = numbers_internal::FastIntToBuffer(values[i], out);
+  }
+  dest->erase(static_cast<size_t>(out - begin));
+}
+
 ABSL_NAMESPACE_END
 }  // namespace absl
 
@@ -24,7 +24,10 @@
 #include "absl/random/distributions.h"
 #include "absl/random/random.h"
 #include "absl/strings/numbers.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_join.h"
 #include "absl/strings/string_view.h"
+#include "absl/types/span.h"
 
 namespace {
 
@@ -285,4 +288,85 @@ void BM_FastHexToBufferZeroPad16(benchmark::State& state) {
 }
 BENCHMARK(BM_FastHexToBufferZeroPad16);
 
+// Returns `count` integers whose decimal representations have uniformly
+// distributed lengths of up to `max_digits` digits.
+std::vector<int64_t> RandomIntegers(size_t count, int max_digits) {
+  absl::BitGen rng;
+  std::vector<int64_t> values(count);
+  for (auto& v : values) {
+    int64_t limit = 1;
+    for (int d = absl::Uniform(absl::IntervalClosedClosed, rng, 1, max_digits);
+         d > 0; --d) {
+      limit *= 10;
+    }
+    v = absl::Uniform<int64_t>(rng, limit / 10, limit);
+    if (absl::Bernoulli(rng, 0.25)) v = -v;
+  }
+  return values;
+}
+
+void BM_SimpleAtoi_PerCall(benchmark::State& state) {
+  const std::vector<int64_t> values = RandomIntegers(1000, state.range(0));
+  std::vector<std::string> strs;
+  for (int64_t v : values) strs.push_back(absl::StrCat(v));
+  std::vector<absl::string_view> fields(strs.begin(), strs.end());
+  std::vector<int64_t> out(fields.size());
+  while (state.KeepRunningBatch(fields.size())) {
+    for (size_t i = 0; i < fields.size(); ++i) {
+      benchmark::DoNotOptimize(absl::SimpleAtoi(fields[i], &out[i]));
+    }
+    benchmark::DoNotOptimize(out);
+  }
+}
+BENCHMARK(BM_SimpleAtoi_PerCall)->Arg(4)->Arg(8)->Arg(12)->Arg(18);
+
+void BM_SimpleAtoiBatch(benchmark::State& state) {
+  const std::vector<int64_t> values = RandomIntegers(1000, state.range(0));
+  std::vector<std::string> strs;
+  for (int64_t v : values) strs.push_back(absl::StrCat(v));
+  std::vector<absl::string_view> fields(strs.begin(), strs.end());
+  std::vector<int64_t> out(fields.size());
+  while (state.KeepRunningBatch(fields.size())) {
+    benchmark::DoNotOptimize(
+        absl::SimpleAtoiBatch(fields, absl::MakeSpan(out)));
+    benchmark::DoNotOptimize(out);
+  }
+}
+BENCHMARK(BM_SimpleAtoiBatch)->Arg(4)->Arg(8)->Arg(12)->Arg(18);
+
+void BM_SimpleAtoiDelimited(benchmark::State& state) {
+  const std::vector<int64_t> values = RandomIntegers(1000, state.range(0));
+  const std::string text = absl::StrJoin(values, ",");
+  std::vector<int64_t> out;
+  out.reserve(values.size());
+  while (state.KeepRunningBatch(values.size())) {
+    out.clear();
+    benchmark::DoNotOptimize(absl::SimpleAtoiDelimited(text, ',', &out));
+    benchmark::DoNotOptimize(out);
+  }
+}
+BENCHMARK(BM_SimpleAtoiDelimited)->Arg(4)->Arg(8)->Arg(12)->Arg(18);
+
+void BM_StrAppend_PerCall(benchmark::State& state) {
+  const std::vector<int64_t> values = RandomIntegers(1000, state.range(0));
+  std::string out;
+  while (state.KeepRunningBatch(values.size())) {
+    out.clear();
+    for (int64_t v : values) absl::StrAppend(&out, v, ",");
+    benchmark::DoNotOptimize(out);
+  }
+}
+BENCHMARK(BM_StrAppend_PerCall)->Arg(4)->Arg(8)->Arg(12)->Arg(18);
+
+void BM_AppendIntegersDelimited(benchmark::State& state) {
+  const std::vector<int64_t> values = RandomIntegers(1000, state.range(0));
+  std::string out;
+  while (state.KeepRunningBatch(values.size())) {
+    out.clear();
+    absl::AppendIntegersDelimited(absl::MakeConstSpan(values), ',', &out);
+    benchmark::DoNotOptimize(out);
+  }
+}
+BENCHMARK(BM_AppendIntegersDelimited)->Arg(4)->Arg(8)->Arg(12)->Arg(18);
+
 }  // namespace
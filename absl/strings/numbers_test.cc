@@ -47,6 +47,7 @@
 #include "absl/strings/internal/pow10_helper.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/string_view.h"
+#include "absl/types/span.h"
 
 namespace {
 
@@ -2251,4 +2252,147 @@ TEST(FastIntToBuffer, WritesNull) {
   ExpectWritesNull<uint32_t>();
 }
 
+// Checks that the batch APIs agree with SimpleAtoi on `inputs`.
+template <typename Int>
+void ExpectBatchMatchesSimpleAtoi(const std::vector<std::string>& inputs) {
+  for (const std::string& input : inputs) {
+    SCOPED_TRACE(input);
+    Int expected = 0;
+    const bool expected_ok = SimpleAtoi(input, &expected);
+
+    const absl::string_view field = input;
+    Int batch = 0;
+    const size_t parsed = absl::SimpleAtoiBatch(
+        absl::MakeConstSpan(&field, 1), absl::MakeSpan(&batch, 1));
+    EXPECT_EQ(parsed, expected_ok ? 1u : 0u);
+    if (expected_ok) {
+      EXPECT_EQ(batch, expected);
+    }
+
+    std::vector<Int> delimited;
+    EXPECT_EQ(absl::SimpleAtoiDelimited(input, '\t', &delimited),
+              expected_ok || input.empty());
+    if (expected_ok) {
+      EXPECT_THAT(delimited, testing::ElementsAre(expected));
+    }
+  }
+}
+
+template <typename Int>
+std::vector<std::string> BatchTestInputs() {
+  std::vector<std::string> inputs = {
+      "0",  "-0",  "+0",  "1",   "-1",  "+1",  "00000000000000000001",
+      "",   "-",   "+",   "--1", "+-1", " 1",  "1 ",
+      "1a", "a1",  "0x1", "1.0", "9/",  ":0",  "12345678",
+      "123456789", "1234567890123456", "12345678901234567",
+      "1234567890123456789", "12345678901234567890",
+      "99999999999999999999", "-9999999999999999999",
+  };
+  using Limits = std::numeric_limits<Int>;
+  const absl::int128 min = (Limits::min)();
+  const absl::int128 max = (Limits::max)();
+  for (absl::int128 v : {min - 1, min, max, max + 1}) {
+    inputs.push_back(absl::StrCat(v));
+  }
+  absl::BitGen rng;
+  for (int i = 0; i < 2000; ++i) {
+    const auto v = absl::LogUniform<uint64_t>(
+        rng, 0, std::numeric_limits<uint64_t>::max());
+    inputs.push_back(absl::StrCat(absl::Bernoulli(rng, 0.3) ? "-" : "", v));
+    inputs.push_back(absl::StrCat(absl::Uniform<int>(rng, -300, 300)));
+  }
+  return inputs;
+}
+
+TEST(SimpleAtoiBatch, MatchesSimpleAtoi) {
+  ExpectBatchMatchesSimpleAtoi<int8_t>(BatchTestInputs<int8_t>());
+  ExpectBatchMatchesSimpleAtoi<uint8_t>(BatchTestInputs<uint8_t>());
+  ExpectBatchMatchesSimpleAtoi<int16_t>(BatchTestInputs<int16_t>());
+  ExpectBatchMatchesSimpleAtoi<uint16_t>(BatchTestInputs<uint16_t>());
+  ExpectBatchMatchesSimpleAtoi<int32_t>(BatchTestInputs<int32_t>());
+  ExpectBatchMatchesSimpleAtoi<uint32_t>(BatchTestInputs<uint32_t>());
+  ExpectBatchMatchesSimpleAtoi<int64_t>(BatchTestInputs<int64_t>());
+  ExpectBatchMatchesSimpleAtoi<uint64_t>(BatchTestInputs<uint64_t>());
+}
+
+TEST(SimpleAtoiBatch, StopsAtFirstFailure) {
+  const std::vector<absl::string_view> fields = {"1", " 22 ", "-3", "x", "5"};
+  std::vector<int> values(fields.size());
+  EXPECT_EQ(absl::SimpleAtoiBatch(fields, absl::MakeSpan(values)), 3u);
+  EXPECT_THAT(absl::MakeConstSpan(values).first(3),
+              testing::ElementsAre(1, 22, -3));
+  EXPECT_EQ(absl::SimpleAtoiBatch(absl::MakeConstSpan(fields).first(3),
+                                  absl::MakeSpan(values)),
+            3u);
+  EXPECT_EQ(absl::SimpleAtoiBatch(absl::Span<const absl::string_view>(),
+                                  absl::MakeSpan(values)),
+            0u);
+}
+
+TEST(SimpleAtoiDelimited, Basic) {
+  std::vector<int64_t> values;
+  EXPECT_TRUE(absl::SimpleAtoiDelimited("", ',', &values));
+  EXPECT_TRUE(values.empty());
+  EXPECT_TRUE(absl::SimpleAtoiDelimited(
+      "1,-2, 3 ,9223372036854775807,-9223372036854775808", ',', &values));
+  EXPECT_THAT(values,
+              testing::ElementsAre(1, -2, 3,
+                                   std::numeric_limits<int64_t>::max(),
+                                   std::numeric_limits<int64_t>::min()));
+
+  values.clear();
+  EXPECT_FALSE(absl::SimpleAtoiDelimited("4,5,,6", ',', &values));
+  EXPECT_THAT(values, testing::ElementsAre(4, 5));
+  values.clear();
+  EXPECT_FALSE(absl::SimpleAtoiDelimited("7,", ',', &values));
+  EXPECT_THAT(values, testing::ElementsAre(7));
+  std::vector<uint8_t> bytes;
+  EXPECT_FALSE(absl::SimpleAtoiDelimited("255\t256", '\t', &bytes));
+  EXPECT_THAT(bytes, testing::ElementsAre(255));
+}
+
+template <typename Int>
+void ExpectAppendIntegersMatchesStrCat() {
+  absl::BitGen rng;
+  std::vector<Int> values = {(std::numeric_limits<Int>::min)(),
+                             (std::numeric_limits<Int>::max)(), 0};
+  for (int i = 0; i < 1000; ++i) {
+    // Spread the values over all digit counts.
+    values.push_back(static_cast<Int>(
+        absl::Uniform(absl::IntervalClosedClosed, rng,
+                      (std::numeric_limits<Int>::min)(),
+                      (std::numeric_limits<Int>::max)()) >>
+        absl::Uniform<int>(rng, 0, 8 * sizeof(Int))));
+  }
+  std::string expected = "prefix:";
+  for (size_t i = 0; i < values.size(); ++i) {
+    if (i != 0) expected += ';';
+    absl::StrAppend(&expected, values[i]);
+  }
+  std::string actual = "prefix:";
+  absl::AppendIntegersDelimited(absl::MakeConstSpan(values), ';', &actual);
+  EXPECT_EQ(actual, expected);
+
+  std::vector<Int> parsed;
+  EXPECT_TRUE(absl::SimpleAtoiDelimited(absl::string_view(actual).substr(7),
+                                        ';', &parsed));
+  EXPECT_EQ(parsed, values);
+}
+
+TEST(AppendIntegersDelimited, MatchesStrCat) {
+  ExpectAppendIntegersMatchesStrCat<int16_t>();
+  ExpectAppendIntegersMatchesStrCat<uint16_t>();
+  ExpectAppendIntegersMatchesStrCat<int32_t>();
+  ExpectAppendIntegersMatchesStrCat<uint32_t>();
+  ExpectAppendIntegersMatchesStrCat<int64_t>();
+  ExpectAppendIntegersMatchesStrCat<uint64_t>();
+
+  std::string s = "unchanged";
+  absl::AppendIntegersDelimited(absl::Span<const int>(), ',', &s);
+  EXPECT_EQ(s, "unchanged");
+  const int one[] = {42};
+  absl::AppendIntegersDelimited(absl::MakeConstSpan(one), ',', &s);
+  EXPECT_EQ(s, "unchanged42");
+}
+
 }  // namespace
@@ -123,6 +123,20 @@ void BM_HexCat_By_StrFormat(benchmark::State& state) {
 }
 BENCHMARK(BM_HexCat_By_StrFormat);
 
+constexpr char kHexCatFormat[] = "%s %x";
+
+void BM_HexCat_By_PrecompiledStrFormat(benchmark::State& state) {
+  int i = 0;
+  for (auto _ : state) {
+    std::string result =
+        absl::StrFormat(absl::PrecompiledFormat<kHexCatFormat>(), kStringOne,
+                        int64_t{i} + 0x10000000);
+    benchmark::DoNotOptimize(result);
+    i = IncrementAlternatingSign(i);
+  }
+}
+BENCHMARK(BM_HexCat_By_PrecompiledStrFormat);
+
 void BM_HexCat_By_Substitute(benchmark::State& state) {
   int i = 0;
   for (auto _ : state) {
@@ -134,6 +148,43 @@ void BM_HexCat_By_Substitute(benchmark::State& state) {
 }
 BENCHMARK(BM_HexCat_By_Substitute);
 
+void BM_IntCat_By_StrCat(benchmark::State& state) {
+  const std::string name = kStringOne;
+  int i = 0;
+  for (auto _ : state) {
+    std::string result = absl::StrCat(name, ": ", i, "us (", i * 65536LL, ")");
+    benchmark::DoNotOptimize(result);
+    i = IncrementAlternatingSign(i);
+  }
+}
+BENCHMARK(BM_IntCat_By_StrCat);
+
+void BM_IntCat_By_StrFormat(benchmark::State& state) {
+  const std::string name = kStringOne;
+  int i = 0;
+  for (auto _ : state) {
+    std::string result =
+        absl::StrFormat("%s: %dus (%d)", name, i, i * 65536LL);
+    benchmark::DoNotOptimize(result);
+    i = IncrementAlternatingSign(i);
+  }
+}
+BENCHMARK(BM_IntCat_By_StrFormat);
+
+constexpr char kIntCatFormat[] = "%s: %dus (%d)";
+
+void BM_IntCat_By_PrecompiledStrFormat(benchmark::State& state) {
+  const std::string name = kStringOne;
+  int i = 0;
+  for (auto _ : state) {
+    std::string result = absl::StrFormat(
+        absl::PrecompiledFormat<kIntCatFormat>(), name, i, i * 65536LL);
+    benchmark::DoNotOptimize(result);
+    i = IncrementAlternatingSign(i);
+  }
+}
+BENCHMARK(BM_IntCat_By_PrecompiledStrFormat);
+
 void BM_FloatToString_By_StrCat(benchmark::State& state) {
   int i = 0;
   float foo = 0.0f;
@@ -169,6 +220,21 @@ void BM_FloatToString_By_StrFormat(benchmark::State& state) {
 }
 BENCHMARK(BM_FloatToString_By_StrFormat);
 
+constexpr char kFloatToStringFormat[] = "%f != %lld";
+
+void BM_FloatToString_By_PrecompiledStrFormat(benchmark::State& state) {
+  int i = 0;
+  float foo = 0.0f;
+  for (auto _ : state) {
+    std::string result =
+        absl::StrFormat(absl::PrecompiledFormat<kFloatToStringFormat>(),
+                        foo += 1.001f, int64_t{i});
+    benchmark::DoNotOptimize(result);
+    i = IncrementAlternatingSign(i);
+  }
+}
+BENCHMARK(BM_FloatToString_By_PrecompiledStrFormat);
+
 template <typename Table, size_t... Index>
 void BM_StrAppendImpl(benchmark::State& state, Table table, size_t total_bytes,
                       std::index_sequence<Index...>) {
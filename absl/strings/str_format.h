@@ -72,6 +72,7 @@
 #ifndef ABSL_STRINGS_STR_FORMAT_H_
 #define ABSL_STRINGS_STR_FORMAT_H_
 
+#include <cstddef>
 #include <cstdint>
 #include <cstdio>
 #include <string>
@@ -85,6 +86,7 @@
 #include "absl/strings/internal/str_format/checker.h"  // IWYU pragma: export
 #include "absl/strings/internal/str_format/extension.h"  // IWYU pragma: export
 #include "absl/strings/internal/str_format/parser.h"  // IWYU pragma: export
+#include "absl/strings/internal/str_format/precompiled.h"  // IWYU pragma: export
 #include "absl/strings/string_view.h"
 #include "absl/types/span.h"
 
@@ -385,6 +387,58 @@ std::string& StrAppendFormat(std::string* absl_nonnull dst,
       {str_format_internal::FormatArgImpl(args)...});
 }
 
+// PrecompiledFormat
+//
+// A `PrecompiledFormat` names a format string held in a `constexpr` character
+// array with static storage duration. `absl::StrFormat()` and
+// `absl::StrAppendFormat()` split such a format into literal text and
+// conversions at compile time, so that each call runs a fixed sequence of
+// appends and per-argument conversions instead of parsing the format and
+// binding arguments at run time. Integer conversions with `%d` and `%v`, and
+// string conversions of `std::string` and `absl::string_view` with `%s` and
+// `%v`, are further inlined when they have no flags, width or precision.
+//
+// The format and arguments are checked at compile time as for `FormatSpec`,
+// except that the format must be a named array rather than a literal.
+//
+// Example:
+//
+//   static constexpr char kLatencyFormat[] = "%s: %dus";
+//   std::string s = absl::StrFormat(
+//       absl::PrecompiledFormat<kLatencyFormat>(), name, latency_us);
+template <const char* Format>
+struct PrecompiledFormat {};
+
+// StrFormat()
+//
+// Overload of `StrFormat()` for a `PrecompiledFormat`. Returns an empty string
+// in case of error.
+template <const char* Format, typename... Args>
+[[nodiscard]] std::string StrFormat(PrecompiledFormat<Format>,
+                                    const Args&... args) {
+  std::string out;
+  if (!str_format_internal::PrecompiledFormatter<Format, Args...>::Append(
+          &out, args...)) {
+    out.clear();
+  }
+  return out;
+}
+
+// StrAppendFormat()
+//
+// Overload of `StrAppendFormat()` for a `PrecompiledFormat`. Appends nothing
+// in case of error (but possibly alters its capacity).
+template <const char* Format, typename... Args>
+std::string& StrAppendFormat(std::string* absl_nonnull dst,
+                             PrecompiledFormat<Format>, const Args&... args) {
+  const size_t old_size = dst->size();
+  if (!str_format_internal::PrecompiledFormatter<Format, Args...>::Append(
+          dst, args...)) {
+    dst->resize(old_size);
+  }
+  return *dst;
+}
+
 // StreamFormat()
 //
 // Writes to an output stream given a format string and zero or more arguments,
@@ -0,0 +1,152 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/strings/str_format_sinks.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <utility>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "absl/base/config.h"
+#include "absl/base/nullability.h"
+#include "absl/strings/cord.h"
+#include "absl/strings/cord_buffer.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+void CordFormatSink::NextBuffer(size_t size) {
+  // Grow buffers with the output, so that short outputs stay small while long
+  // ones use the largest blocks.
+  if (!has_buffer_) {
+    // Size a new buffer relative to the destination, so that repeated short
+    // appends through new sinks do not leave a trail of tiny flats.
+    buffer_ = dest_->GetCustomAppendBuffer(
+        CordBuffer::kCustomLimit, std::max(size, dest_->size()),
+        /*min_capacity=*/1);
+    has_buffer_ = true;
+    return;
+  }
+  appended_ += buffer_.length();
+  dest_->Append(std::move(buffer_));
+  buffer_ = CordBuffer::CreateWithCustomLimit(CordBuffer::kCustomLimit,
+                                              std::max(size, appended_));
+}
+
+void CordFormatSink::Append(absl::string_view data) {
+  while (!data.empty()) {
+    if (!has_buffer_ || buffer_.length() == buffer_.capacity()) {
+      NextBuffer(data.size());
+    }
+    absl::Span<char> available = buffer_.available_up_to(data.size());
+    std::memcpy(available.data(), data.data(), available.size());
+    buffer_.IncreaseLengthBy(available.size());
+    data.remove_prefix(available.size());
+  }
+}
+
+void CordFormatSink::Flush() {
+  if (!has_buffer_) return;
+  appended_ += buffer_.length();
+  dest_->Append(std::move(buffer_));
+  buffer_ = CordBuffer();
+  // The next buffer picks up the capacity left at the end of the destination.
+  has_buffer_ = false;
+}
+
+void FdFormatSink::Write(absl::string_view data) {
+  while (!data.empty() && error_ == 0) {
+#ifdef _WIN32
+    const int result =
+        _write(fd_, data.data(),
+               static_cast<unsigned>(std::min<size_t>(data.size(), 1u << 30)));
+#else
+    const ssize_t result = write(fd_, data.data(), data.size());
+#endif
+    if (result < 0) {
+      if (errno != EINTR) error_ = errno != 0 ? errno : EIO;
+      continue;
+    }
+    count_ += static_cast<size_t>(result);
+    data.remove_prefix(static_cast<size_t>(result));
+  }
+}
+
+void FdFormatSink::Append(absl::string_view data) {
+  if (error_ != 0) return;
+  if (data.size() <= capacity_ - size_) {
+    if (!data.empty()) std::memcpy(buffer_ + size_, data.data(), data.size());
+    size_ += data.size();
+    return;
+  }
+  // Top up the buffer before writing it, unless `data` does not fit an empty
+  // buffer either, in which case it is written directly.
+  if (data.size() < capacity_) {
+    const size_t n = capacity_ - size_;
+    std::memcpy(buffer_ + size_, data.data(), n);
+    data.remove_prefix(n);
+    Write(absl::string_view(buffer_, capacity_));
+    std::memcpy(buffer_, data.data(), data.size());
+    size_ = data.size();
+    return;
+  }
+  Flush();
+  Write(data);
+}
+
+bool FdFormatSink::Flush() {
+  if (size_ > 0) {
+    Write(absl::string_view(buffer_, size_));
+    size_ = 0;
+  }
+  return error_ == 0;
+}
+
+namespace strings_internal {
+
+void AppendPieces(absl::Cord* absl_nonnull dest,
+                  std::initializer_list<absl::string_view> pieces) {
+  size_t total = 0;
+  for (absl::string_view piece : pieces) total += piece.size();
+  // Short results are assembled on the stack and appended at once, which lets
+  // `Cord::Append()` fill the spare capacity of the last flat in place.
+  char buffer[256];
+  if (total <= sizeof(buffer)) {
+    char* out = buffer;
+    for (absl::string_view piece : pieces) {
+      if (!piece.empty()) std::memcpy(out, piece.data(), piece.size());
+      out += piece.size();
+    }
+    dest->Append(absl::string_view(buffer, total));
+    return;
+  }
+  CordFormatSink sink(dest);
+  for (absl::string_view piece : pieces) sink.Append(piece);
+}
+
+}  // namespace strings_internal
+
+ABSL_NAMESPACE_END
+}  // namespace absl
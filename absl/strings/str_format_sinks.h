@@ -0,0 +1,197 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// -----------------------------------------------------------------------------
+// File: str_format_sinks.h
+// -----------------------------------------------------------------------------
+//
+// This header file defines sinks for `absl::Format()` that write formatted
+// output to its final destination without building an intermediate
+// `std::string`:
+//
+//   * `absl::CordFormatSink` writes into `absl::CordBuffer`s which are appended
+//     to an `absl::Cord` as they fill up.
+//   * `absl::FdFormatSink` collects output in a caller-owned buffer and writes
+//     it to a file descriptor whenever the buffer is full.
+//
+// It also defines `absl::StrAppendFormat()` and `absl::StrAppend()` overloads
+// that append to an `absl::Cord`.
+//
+// Example:
+//
+//   absl::Cord response;
+//   {
+//     absl::CordFormatSink sink(&response);
+//     for (const Row& row : rows) {
+//       absl::Format(&sink, "%s\t%d\t%.3f\n", row.key, row.count, row.ratio);
+//     }
+//   }
+//
+//   char buffer[64 << 10];
+//   absl::FdFormatSink out(fd, absl::MakeSpan(buffer));
+//   for (const Row& row : rows) {
+//     absl::Format(&out, "%s\t%d\n", row.key, row.count);
+//   }
+//   if (!out.Flush()) return absl::ErrnoToStatus(out.error(), "write failed");
+
+#ifndef ABSL_STRINGS_STR_FORMAT_SINKS_H_
+#define ABSL_STRINGS_STR_FORMAT_SINKS_H_
+
+#include <cstddef>
+#include <initializer_list>
+
+#include "absl/base/config.h"
+#include "absl/base/nullability.h"
+#include "absl/strings/cord.h"
+#include "absl/strings/cord_buffer.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_format.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+// CordFormatSink
+//
+// A sink for `absl::Format()` that appends to an `absl::Cord`. Output is
+// written directly into `CordBuffer`s of up to `CordBuffer::kCustomLimit`
+// bytes, the first of which reuses any spare capacity at the end of the
+// destination. Buffers are appended to the destination as they fill up, and
+// the last, partially filled one when the sink is flushed or destroyed; until
+// then, the destination must not be accessed.
+//
+// Compared to `absl::Format()` on the Cord itself, which passes every chunk of
+// output through `Cord::Append()`, this avoids updating the Cord per chunk and
+// produces fewer, larger flats.
+class CordFormatSink {
+ public:
+  explicit CordFormatSink(absl::Cord* absl_nonnull dest) : dest_(dest) {}
+
+  CordFormatSink(const CordFormatSink&) = delete;
+  CordFormatSink& operator=(const CordFormatSink&) = delete;
+
+  ~CordFormatSink() { Flush(); }
+
+  // Appends `data` to the destination.
+  void Append(absl::string_view data);
+
+  // Appends all buffered data to the destination.
+  void Flush();
+
+  friend void AbslFormatFlush(CordFormatSink* absl_nonnull sink,
+                              absl::string_view part) {
+    sink->Append(part);
+  }
+
+ private:
+  // Appends the current buffer to the destination and starts a new one with
+  // room for at least part of `size` more bytes.
+  void NextBuffer(size_t size);
+
+  absl::Cord* absl_nonnull dest_;
+  absl::CordBuffer buffer_;
+  // Whether `buffer_` holds a buffer obtained from `NextBuffer()`.
+  bool has_buffer_ = false;
+  // The number of bytes appended to the destination through this sink, used to
+  // grow the buffer size.
+  size_t appended_ = 0;
+};
+
+// FdFormatSink
+//
+// A sink for `absl::Format()` that writes to a file descriptor. Output is
+// collected in the caller-owned `buffer` and written when the buffer is full,
+// so that small formatted pieces result in few, large writes; pieces larger
+// than the buffer are written directly. Partial writes and `EINTR` are retried.
+//
+// After a write fails, all further output is discarded and `error()` returns
+// the `errno` of the failure. The sink does not own or close the descriptor.
+class FdFormatSink {
+ public:
+  FdFormatSink(int fd, absl::Span<char> buffer)
+      : fd_(fd), buffer_(buffer.data()), capacity_(buffer.size()) {}
+
+  FdFormatSink(const FdFormatSink&) = delete;
+  FdFormatSink& operator=(const FdFormatSink&) = delete;
+
+  ~FdFormatSink() { Flush(); }
+
+  // Appends `data` to the output.
+  void Append(absl::string_view data);
+
+  // Writes all buffered output to the file descriptor. Returns false if any
+  // write has failed.
+  bool Flush();
+
+  // Returns the number of bytes written to the file descriptor.
+  size_t count() const { return count_; }
+
+  // Returns the `errno` of the first failed write, or 0.
+  int error() const { return error_; }
+
+  friend void AbslFormatFlush(FdFormatSink* absl_nonnull sink,
+                              absl::string_view part) {
+    sink->Append(part);
+  }
+
+ private:
+  void Write(absl::string_view data);
+
+  int fd_;
+  char* buffer_;
+  size_t capacity_;
+  size_t size_ = 0;
+  size_t count_ = 0;
+  int error_ = 0;
+};
+
+// StrAppendFormat()
+//
+// Overload of `StrAppendFormat()` appending to an `absl::Cord` without an
+// intermediate `std::string`. Appends nothing in case of error.
+//
+// Each call appends its output in pieces of at most 1KiB; to build a large
+// Cord from many formatted pieces, format them through a single
+// `CordFormatSink` instead.
+template <typename... Args>
+absl::Cord& StrAppendFormat(absl::Cord* absl_nonnull dst,
+                            const FormatSpec<Args...>& format,
+                            const Args&... args) {
+  const size_t old_size = dst->size();
+  if (!absl::Format(dst, format, args...)) {
+    dst->RemoveSuffix(dst->size() - old_size);
+  }
+  return *dst;
+}
+
+namespace strings_internal {
+void AppendPieces(absl::Cord* absl_nonnull dest,
+                  std::initializer_list<absl::string_view> pieces);
+}  // namespace strings_internal
+
+// StrAppend()
+//
+// Overload of `StrAppend()` appending the concatenation of its arguments to an
+// `absl::Cord` without an intermediate `std::string`.
+template <typename... AV>
+void StrAppend(absl::Cord* absl_nonnull dest, const AV&... args) {
+  strings_internal::AppendPieces(
+      dest, {static_cast<const AlphaNum&>(args).Piece()...});
+}
+
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_STRINGS_STR_FORMAT_SINKS_H_
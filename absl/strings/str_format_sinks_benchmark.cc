@@ -0,0 +1,113 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "absl/profiling/benchmark.h"
+#include "absl/strings/cord.h"
+#include "absl/strings/str_format.h"
+#include "absl/strings/str_format_sinks.h"
+#include "absl/types/span.h"
+
+namespace {
+
+// Builds a response of `state.range(0)` lines, each formatted separately.
+
+void BM_CordResponse_StrFormatAndAppend(benchmark::State& state) {
+  const int lines = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    absl::Cord response;
+    for (int i = 0; i < lines; ++i) {
+      response.Append(absl::StrFormat("%08d\t%s\t%.3f\n", i, "key", i / 7.0));
+    }
+    benchmark::DoNotOptimize(response);
+  }
+}
+BENCHMARK(BM_CordResponse_StrFormatAndAppend)->Arg(10)->Arg(100000);
+
+void BM_CordResponse_FormatToCord(benchmark::State& state) {
+  const int lines = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    absl::Cord response;
+    for (int i = 0; i < lines; ++i) {
+      absl::Format(&response, "%08d\t%s\t%.3f\n", i, "key", i / 7.0);
+    }
+    benchmark::DoNotOptimize(response);
+  }
+}
+BENCHMARK(BM_CordResponse_FormatToCord)->Arg(10)->Arg(100000);
+
+void BM_CordResponse_CordFormatSink(benchmark::State& state) {
+  const int lines = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    absl::Cord response;
+    {
+      absl::CordFormatSink sink(&response);
+      for (int i = 0; i < lines; ++i) {
+        absl::Format(&sink, "%08d\t%s\t%.3f\n", i, "key", i / 7.0);
+      }
+    }
+    benchmark::DoNotOptimize(response);
+  }
+}
+BENCHMARK(BM_CordResponse_CordFormatSink)->Arg(10)->Arg(100000);
+
+void BM_CordResponse_StrAppendFormat(benchmark::State& state) {
+  const int lines = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    absl::Cord response;
+    for (int i = 0; i < lines; ++i) {
+      absl::StrAppendFormat(&response, "%08d\t%s\t%.3f\n", i, "key", i / 7.0);
+    }
+    benchmark::DoNotOptimize(response);
+  }
+}
+BENCHMARK(BM_CordResponse_StrAppendFormat)->Arg(10)->Arg(100000);
+
+#ifndef _WIN32
+
+void BM_FileResponse_FPrintF(benchmark::State& state) {
+  const int lines = static_cast<int>(state.range(0));
+  std::FILE* devnull = std::fopen("/dev/null", "w");
+  for (auto _ : state) {
+    for (int i = 0; i < lines; ++i) {
+      absl::FPrintF(devnull, "%08d\t%s\t%.3f\n", i, "key", i / 7.0);
+    }
+    std::fflush(devnull);
+  }
+  std::fclose(devnull);
+}
+BENCHMARK(BM_FileResponse_FPrintF)->Arg(100000);
+
+void BM_FileResponse_FdFormatSink(benchmark::State& state) {
+  const int lines = static_cast<int>(state.range(0));
+  std::FILE* devnull = std::fopen("/dev/null", "w");
+  std::vector<char> buffer(64 << 10);
+  for (auto _ : state) {
+    absl::FdFormatSink sink(fileno(devnull), absl::MakeSpan(buffer));
+    for (int i = 0; i < lines; ++i) {
+      absl::Format(&sink, "%08d\t%s\t%.3f\n", i, "key", i / 7.0);
+    }
+    sink.Flush();
+  }
+  std::fclose(devnull);
+}
+BENCHMARK(BM_FileResponse_FdFormatSink)->Arg(100000);
+
+#endif  // _WIN32
+
+}  // namespace
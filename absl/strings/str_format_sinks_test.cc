@@ -0,0 +1,176 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/strings/str_format_sinks.h"
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdio>
+#include <string>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "absl/strings/cord.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_format.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+
+namespace {
+
+// Formats `n` lines of a textual response.
+template <typename Sink>
+void FormatLines(Sink* sink, int n) {
+  for (int i = 0; i < n; ++i) {
+    absl::Format(sink, "%08d\t%s\t%.3f\n", i, "some_key", i / 7.0);
+  }
+}
+
+std::string ExpectedLines(int n) {
+  std::string s;
+  FormatLines(&s, n);
+  return s;
+}
+
+TEST(CordFormatSink, FormatsIntoCord) {
+  for (int n : {0, 1, 10, 1000, 100000}) {
+    SCOPED_TRACE(n);
+    absl::Cord cord("prefix ");
+    {
+      absl::CordFormatSink sink(&cord);
+      FormatLines(&sink, n);
+    }
+    EXPECT_EQ(cord, absl::StrCat("prefix ", ExpectedLines(n)));
+  }
+}
+
+TEST(CordFormatSink, LargePiecesAndFlush) {
+  const std::string big(300000, 'x');
+  absl::Cord cord;
+  absl::CordFormatSink sink(&cord);
+  sink.Append("a");
+  sink.Append(big);
+  sink.Flush();
+  EXPECT_EQ(cord, absl::StrCat("a", big));
+  // Appending after a flush continues at the end of the Cord.
+  sink.Append("b");
+  sink.Flush();
+  EXPECT_EQ(cord, absl::StrCat("a", big, "b"));
+}
+
+TEST(CordFormatSink, UsesLargeFlats) {
+  absl::Cord cord;
+  {
+    absl::CordFormatSink sink(&cord);
+    FormatLines(&sink, 200000);
+  }
+  size_t chunks = 0;
+  for (absl::string_view chunk : cord.Chunks()) {
+    static_cast<void>(chunk);
+    ++chunks;
+  }
+  // Buffers quickly grow to about 64KiB.
+  EXPECT_LT(chunks, cord.size() / 32768);
+}
+
+TEST(CordFormatSink, StrAppendFormat) {
+  absl::Cord cord("x");
+  absl::StrAppendFormat(&cord, "%d-%s", 42, "y");
+  absl::StrAppendFormat(&cord, "%5.1f", 2.25);
+  EXPECT_EQ(cord, "x42-y  2.2");
+}
+
+struct FailsToConvert {
+  friend absl::FormatConvertResult<absl::FormatConversionCharSet::kString>
+  AbslFormatConvert(const FailsToConvert&, const absl::FormatConversionSpec&,
+                    absl::FormatSink*) {
+    return {false};
+  }
+};
+
+TEST(CordFormatSink, StrAppendFormatFailureAppendsNothing) {
+  const std::string big(100000, 'z');
+  absl::Cord cord("keep");
+  absl::StrAppendFormat(&cord, "%s%s", big, FailsToConvert());
+  EXPECT_EQ(cord, "keep");
+}
+
+TEST(CordFormatSink, StrAppend) {
+  absl::Cord cord("a");
+  absl::StrAppend(&cord);
+  absl::StrAppend(&cord, "b", 1, absl::Hex(255), std::string("c"), 2.5, "d");
+  EXPECT_EQ(cord, "ab1ffc2.5d");
+}
+
+#ifndef _WIN32
+
+std::string ReadAll(std::FILE* file) {
+  std::rewind(file);
+  std::string s;
+  char buf[4096];
+  size_t n;
+  while ((n = std::fread(buf, 1, sizeof(buf), file)) > 0) s.append(buf, n);
+  return s;
+}
+
+TEST(FdFormatSink, WritesThroughBuffer) {
+  for (size_t buffer_size : {size_t{1}, size_t{100}, size_t{64 << 10}}) {
+    SCOPED_TRACE(buffer_size);
+    std::FILE* file = std::tmpfile();
+    ASSERT_NE(file, nullptr);
+    std::string buffer(buffer_size, '\0');
+    const std::string big(200000, 'q');
+    {
+      absl::FdFormatSink sink(fileno(file), absl::MakeSpan(buffer));
+      FormatLines(&sink, 5000);
+      sink.Append(big);
+      absl::Format(&sink, "%s|", "end");
+      EXPECT_TRUE(sink.Flush());
+      EXPECT_EQ(sink.error(), 0);
+    }
+    const std::string expected = absl::StrCat(ExpectedLines(5000), big, "end|");
+    EXPECT_EQ(ReadAll(file), expected);
+    std::fclose(file);
+  }
+}
+
+TEST(FdFormatSink, CountsAndBuffers) {
+  std::FILE* file = std::tmpfile();
+  ASSERT_NE(file, nullptr);
+  char buffer[16];
+  absl::FdFormatSink sink(fileno(file), absl::MakeSpan(buffer));
+  sink.Append("0123456789");
+  EXPECT_EQ(sink.count(), 0u);
+  sink.Append("0123456789");
+  EXPECT_EQ(sink.count(), 16u);
+  EXPECT_TRUE(sink.Flush());
+  EXPECT_EQ(sink.count(), 20u);
+  std::fclose(file);
+}
+
+TEST(FdFormatSink, ReportsErrors) {
+  char buffer[16];
+  absl::FdFormatSink sink(-1, absl::MakeSpan(buffer));
+  sink.Append("small");
+  EXPECT_EQ(sink.error(), 0);
+  EXPECT_FALSE(sink.Flush());
+  EXPECT_EQ(sink.error(), EBADF);
+  sink.Append("discarded");
+  EXPECT_FALSE(sink.Flush());
+  EXPECT_EQ(sink.count(), 0u);
+}
+
+#endif  // _WIN32
+
+}  // namespace
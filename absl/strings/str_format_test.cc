@@ -18,6 +18,7 @@
 #include <cstdarg>
 #include <cstdint>
 #include <cstdio>
+#include <limits>
 #include <ostream>
 #include <sstream>
 #include <string>
@@ -1090,6 +1091,80 @@ TEST_F(FormatWrapperTest, ParsedFormatWithV) {
   EXPECT_EQ(WrappedFormat(format, hello), "hello there");
 }
 
+using PrecompiledFormatTest = ::testing::Test;
+
+constexpr char kPrecompiledEmpty[] = "";
+constexpr char kPrecompiledLiteral[] = "no conversions, 100%% literal";
+constexpr char kPrecompiledInts[] = "%d,%i,%v,%d;%d:%v";
+constexpr char kPrecompiledStrings[] = "[%s|%v|%s]";
+constexpr char kPrecompiledMixed[] = "%s=%5.2f %x %-4d|%c %s %v%%";
+constexpr char kPrecompiledStar[] = "<%*d> <%.*f> <%-*s>";
+constexpr char kPrecompiledPositional[] = "%2$s %1$d %2$s %1$x";
+
+TEST_F(PrecompiledFormatTest, MatchesStrFormat) {
+  EXPECT_EQ(StrFormat(PrecompiledFormat<kPrecompiledEmpty>()), "");
+  EXPECT_EQ(StrFormat(PrecompiledFormat<kPrecompiledLiteral>()),
+            StrFormat(kPrecompiledLiteral));
+
+  const short s = -7;  // NOLINT
+  const unsigned long long ull = ~0ull;  // NOLINT
+  const int64_t min64 = std::numeric_limits<int64_t>::min();
+  EXPECT_EQ(StrFormat(PrecompiledFormat<kPrecompiledInts>(), 0, -1, 42u, s,
+                      ull, min64),
+            StrFormat(kPrecompiledInts, 0, -1, 42u, s, ull, min64));
+
+  const std::string str = "string";
+  const absl::string_view sv = "view";
+  EXPECT_EQ(StrFormat(PrecompiledFormat<kPrecompiledStrings>(), str, sv, ""),
+            "[string|view|]");
+  EXPECT_EQ(StrFormat(PrecompiledFormat<kPrecompiledStrings>(), "literal",
+                      std::string(), sv),
+            StrFormat(kPrecompiledStrings, "literal", std::string(), sv));
+
+  EXPECT_EQ(StrFormat(PrecompiledFormat<kPrecompiledMixed>(), "pi", 3.14159,
+                      255, 7, 'c', sv, true),
+            StrFormat(kPrecompiledMixed, "pi", 3.14159, 255, 7, 'c', sv, true));
+
+  EXPECT_EQ(StrFormat(PrecompiledFormat<kPrecompiledStar>(), 5, 42, 2, 1.2345,
+                      -6, "ab"),
+            StrFormat(kPrecompiledStar, 5, 42, 2, 1.2345, -6, "ab"));
+
+  EXPECT_EQ(StrFormat(PrecompiledFormat<kPrecompiledPositional>(), 255, str),
+            StrFormat(kPrecompiledPositional, 255, str));
+}
+
+TEST_F(PrecompiledFormatTest, FunctionLocalFormat) {
+  static constexpr char kFormat[] = "%s: %dus";
+  EXPECT_EQ(StrFormat(PrecompiledFormat<kFormat>(), std::string("rpc"), 120),
+            "rpc: 120us");
+}
+
+TEST_F(PrecompiledFormatTest, StrAppendFormat) {
+  std::string out = "prefix ";
+  StrAppendFormat(&out, PrecompiledFormat<kPrecompiledInts>(), 1, 2, 3, 4, 5,
+                  6);
+  StrAppendFormat(&out, PrecompiledFormat<kPrecompiledMixed>(), "e", 2.71828,
+                  16, 1, 'x', "y", false);
+  EXPECT_EQ(out, "prefix 1,2,3,4;5:6e= 2.72 10 1   |x y false%");
+}
+
+struct FailsToConvert {
+  friend FormatConvertResult<FormatConversionCharSet::kString>
+  AbslFormatConvert(const FailsToConvert&, const FormatConversionSpec&,
+                    FormatSink*) {
+    return {false};
+  }
+};
+
+TEST_F(PrecompiledFormatTest, FailureProducesNothing) {
+  static constexpr char kFormat[] = "a%db%s";
+  EXPECT_EQ(StrFormat(kFormat, 1, FailsToConvert()), "");
+  EXPECT_EQ(StrFormat(PrecompiledFormat<kFormat>(), 1, FailsToConvert()), "");
+  std::string out = "keep";
+  StrAppendFormat(&out, PrecompiledFormat<kFormat>(), 1, FailsToConvert());
+  EXPECT_EQ(out, "keep");
+}
+
 }  // namespace
 ABSL_NAMESPACE_END
 }  // namespace absl
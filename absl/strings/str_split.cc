@@ -16,13 +16,25 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <cstring>
 
 #include "absl/base/config.h"
+#include "absl/base/internal/endian.h"
 #include "absl/base/internal/raw_logging.h"
+#include "absl/base/optimization.h"
+#include "absl/strings/charset.h"
+#include "absl/strings/internal/simd_dispatch.h"
 #include "absl/strings/string_view.h"
 
+#if defined(ABSL_INTERNAL_STRINGS_HAVE_X86_DISPATCH)
+#include <immintrin.h>
+#elif defined(ABSL_INTERNAL_HAVE_ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define ABSL_INTERNAL_STRINGS_STR_SPLIT_NEON 1
+#endif
+
 namespace absl {
 ABSL_NAMESPACE_BEGIN
 
@@ -76,8 +88,221 @@ struct AnyOfPolicy {
   static size_t Length(absl::string_view /* delimiter */) { return 1; }
 };
 
+// Delimiter bitmap kernels for ByteSetMatcher. Each returns a mask with bit
+// `i` set iff byte `p[i]`, `i < 64`, is a delimiter.
+#if defined(ABSL_INTERNAL_STRINGS_HAVE_X86_DISPATCH)
+
+ABSL_INTERNAL_STRINGS_TARGET_SSSE3 uint64_t MatchSingleSsse3(const char* p,
+                                                             char c) {
+  const __m128i needle = _mm_set1_epi8(c);
+  uint64_t mask = 0;
+  for (int i = 0; i < 64; i += 16) {
+    const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+    mask |= uint64_t{static_cast<uint16_t>(
+                _mm_movemask_epi8(_mm_cmpeq_epi8(in, needle)))}
+            << i;
+  }
+  return mask;
+}
+
+ABSL_INTERNAL_STRINGS_TARGET_SSSE3 uint64_t
+MatchNibblesSsse3(const char* p, const uint8_t* low, const uint8_t* high) {
+  const __m128i low_table =
+      _mm_load_si128(reinterpret_cast<const __m128i*>(low));
+  const __m128i high_table =
+      _mm_load_si128(reinterpret_cast<const __m128i*>(high));
+  const __m128i nibble = _mm_set1_epi8(0x0F);
+  uint64_t mask = 0;
+  for (int i = 0; i < 64; i += 16) {
+    const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+    const __m128i buckets = _mm_and_si128(
+        _mm_shuffle_epi8(low_table, _mm_and_si128(in, nibble)),
+        _mm_shuffle_epi8(high_table,
+                         _mm_and_si128(_mm_srli_epi16(in, 4), nibble)));
+    const uint16_t misses = static_cast<uint16_t>(
+        _mm_movemask_epi8(_mm_cmpeq_epi8(buckets, _mm_setzero_si128())));
+    mask |= uint64_t{static_cast<uint16_t>(~misses)} << i;
+  }
+  return mask;
+}
+
+ABSL_INTERNAL_STRINGS_TARGET_AVX2 uint64_t MatchSingleAvx2(const char* p,
+                                                           char c) {
+  const __m256i needle = _mm256_set1_epi8(c);
+  const __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+  const __m256i hi =
+      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + 32));
+  const uint32_t lo_mask = static_cast<uint32_t>(
+      _mm256_movemask_epi8(_mm256_cmpeq_epi8(lo, needle)));
+  const uint32_t hi_mask = static_cast<uint32_t>(
+      _mm256_movemask_epi8(_mm256_cmpeq_epi8(hi, needle)));
+  return uint64_t{lo_mask} | (uint64_t{hi_mask} << 32);
+}
+
+ABSL_INTERNAL_STRINGS_TARGET_AVX2 uint64_t
+MatchNibblesAvx2(const char* p, const uint8_t* low, const uint8_t* high) {
+  const __m256i low_table = _mm256_broadcastsi128_si256(
+      _mm_load_si128(reinterpret_cast<const __m128i*>(low)));
+  const __m256i high_table = _mm256_broadcastsi128_si256(
+      _mm_load_si128(reinterpret_cast<const __m128i*>(high)));
+  const __m256i nibble = _mm256_set1_epi8(0x0F);
+  uint64_t mask = 0;
+  for (int i = 0; i < 64; i += 32) {
+    const __m256i in =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+    const __m256i buckets = _mm256_and_si256(
+        _mm256_shuffle_epi8(low_table, _mm256_and_si256(in, nibble)),
+        _mm256_shuffle_epi8(high_table,
+                            _mm256_and_si256(_mm256_srli_epi16(in, 4), nibble)));
+    const uint32_t misses = static_cast<uint32_t>(_mm256_movemask_epi8(
+        _mm256_cmpeq_epi8(buckets, _mm256_setzero_si256())));
+    mask |= uint64_t{~misses} << i;
+  }
+  return mask;
+}
+
+#elif defined(ABSL_INTERNAL_STRINGS_STR_SPLIT_NEON)
+
+// Packs the high bits of the bytes of four comparison results into a mask.
+inline uint64_t MoveMask64Neon(uint8x16_t m0, uint8x16_t m1, uint8x16_t m2,
+                               uint8x16_t m3) {
+  const uint8x16_t bits = {1, 2, 4, 8, 16, 32, 64, 128,
+                           1, 2, 4, 8, 16, 32, 64, 128};
+  uint8x16_t sum0 = vpaddq_u8(vandq_u8(m0, bits), vandq_u8(m1, bits));
+  uint8x16_t sum1 = vpaddq_u8(vandq_u8(m2, bits), vandq_u8(m3, bits));
+  sum0 = vpaddq_u8(sum0, sum1);
+  sum0 = vpaddq_u8(sum0, sum0);
+  return vgetq_lane_u64(vreinterpretq_u64_u8(sum0), 0);
+}
+
+uint64_t MatchSingleNeon(const char* p, char c) {
+  const uint8_t* u = reinterpret_cast<const uint8_t*>(p);
+  const uint8x16_t needle = vdupq_n_u8(static_cast<uint8_t>(c));
+  return MoveMask64Neon(vceqq_u8(vld1q_u8(u), needle),
+                        vceqq_u8(vld1q_u8(u + 16), needle),
+                        vceqq_u8(vld1q_u8(u + 32), needle),
+                        vceqq_u8(vld1q_u8(u + 48), needle));
+}
+
+inline uint8x16_t NibbleHitsNeon(uint8x16_t in, uint8x16_t low_table,
+                                 uint8x16_t high_table) {
+  const uint8x16_t buckets =
+      vandq_u8(vqtbl1q_u8(low_table, vandq_u8(in, vdupq_n_u8(0x0F))),
+               vqtbl1q_u8(high_table, vshrq_n_u8(in, 4)));
+  return vtstq_u8(buckets, buckets);
+}
+
+uint64_t MatchNibblesNeon(const char* p, const uint8_t* low,
+                          const uint8_t* high) {
+  const uint8_t* u = reinterpret_cast<const uint8_t*>(p);
+  const uint8x16_t low_table = vld1q_u8(low);
+  const uint8x16_t high_table = vld1q_u8(high);
+  return MoveMask64Neon(NibbleHitsNeon(vld1q_u8(u), low_table, high_table),
+                        NibbleHitsNeon(vld1q_u8(u + 16), low_table, high_table),
+                        NibbleHitsNeon(vld1q_u8(u + 32), low_table, high_table),
+                        NibbleHitsNeon(vld1q_u8(u + 48), low_table, high_table));
+}
+
+#endif
+
 }  // namespace
 
+//
+// ByteSetMatcher
+//
+
+namespace strings_internal {
+
+ByteSetMatcher::ByteSetMatcher(char c) : kind_(Kind::kSingle), single_(c) {}
+
+ByteSetMatcher::ByteSetMatcher(absl::string_view chars) {
+  if (chars.empty()) return;
+  if (chars.find_first_not_of(chars[0]) == absl::string_view::npos) {
+    kind_ = Kind::kSingle;
+    single_ = chars[0];
+    return;
+  }
+  // Assign a bucket bit to each distinct high nibble, straight from the
+  // delimiters, so that the cost is proportional to their number.
+  int buckets = 0;
+  for (char c : chars) {
+    const unsigned char b = static_cast<unsigned char>(c);
+    uint8_t& row_bit = high_[b >> 4];
+    if (row_bit == 0) {
+      if (buckets == 8) {
+        kind_ = Kind::kGeneric;
+        set_ = absl::CharSet(chars);
+        return;
+      }
+      row_bit = static_cast<uint8_t>(1 << buckets++);
+    }
+    low_[b & 0xF] |= row_bit;
+  }
+  kind_ = Kind::kNibbles;
+}
+
+uint64_t ByteSetMatcher::Match64(const char* absl_nonnull p) const {
+  const SimdLevel level = ActiveSimdLevel();
+  switch (kind_) {
+    case Kind::kSingle:
+#if defined(ABSL_INTERNAL_STRINGS_HAVE_X86_DISPATCH)
+      if (level == SimdLevel::kAvx2) return MatchSingleAvx2(p, single_);
+      if (level == SimdLevel::kSsse3) return MatchSingleSsse3(p, single_);
+#elif defined(ABSL_INTERNAL_STRINGS_STR_SPLIT_NEON)
+      if (level == SimdLevel::kNeon) return MatchSingleNeon(p, single_);
+#endif
+      break;
+    case Kind::kNibbles:
+#if defined(ABSL_INTERNAL_STRINGS_HAVE_X86_DISPATCH)
+      if (level == SimdLevel::kAvx2) return MatchNibblesAvx2(p, low_, high_);
+      if (level == SimdLevel::kSsse3) return MatchNibblesSsse3(p, low_, high_);
+#elif defined(ABSL_INTERNAL_STRINGS_STR_SPLIT_NEON)
+      if (level == SimdLevel::kNeon) return MatchNibblesNeon(p, low_, high_);
+#endif
+      break;
+    case Kind::kNone:
+      return 0;
+    case Kind::kGeneric:
+      break;
+  }
+  static_cast<void>(level);
+  uint64_t mask = 0;
+  if (kind_ == Kind::kSingle) {
+    // Find the matching bytes of each word: after the XOR they are exactly the
+    // zero bytes, whose high bits are then gathered into the low byte.
+    constexpr uint64_t kLow7 = 0x7F7F7F7F7F7F7F7F;
+    const uint64_t needle =
+        0x0101010101010101 * static_cast<unsigned char>(single_);
+    for (int i = 0; i < 64; i += 8) {
+      const uint64_t x = little_endian::Load64(p + i) ^ needle;
+      const uint64_t zeros = ~(((x & kLow7) + kLow7) | x | kLow7);
+      mask |= (((zeros >> 7) * 0x0102040810204080) >> 56) << i;
+    }
+    return mask;
+  }
+  if (kind_ == Kind::kNibbles) {
+    for (int i = 0; i < 64; ++i) {
+      const unsigned char b = static_cast<unsigned char>(p[i]);
+      mask |= uint64_t{(low_[b & 0xF] & high_[b >> 4]) != 0} << i;
+    }
+    return mask;
+  }
+  for (int i = 0; i < 64; ++i) {
+    mask |= uint64_t{set_.contains(p[i])} << i;
+  }
+  return mask;
+}
+
+uint64_t ByteSetMatcher::Match(const char* absl_nonnull p, size_t n) const {
+  if (ABSL_PREDICT_TRUE(n == 64)) return Match64(p);
+  // Pad the final partial block; matches in the padding are masked off.
+  char block[64] = {};
+  std::memcpy(block, p, n);
+  return Match64(block) & ((uint64_t{1} << n) - 1);
+}
+
+}  // namespace strings_internal
+
 //
 // ByString
 //
@@ -127,6 +127,13 @@ class ByString {
   absl::string_view Find(absl::string_view text, size_t pos) const;
 
  private:
+  friend strings_internal::ByteSetMatcher ByteSetMatcherFor(
+      const ByString& d) {
+    // Only single-character delimiters can be found a block at a time.
+    if (d.delimiter_.size() != 1) return strings_internal::ByteSetMatcher();
+    return strings_internal::ByteSetMatcher(d.delimiter_[0]);
+  }
+
   std::string delimiter_;
 };
 
@@ -146,6 +153,12 @@ class ByString {
 class ByAsciiWhitespace {
  public:
   absl::string_view Find(absl::string_view text, size_t pos) const;
+
+ private:
+  friend strings_internal::ByteSetMatcher ByteSetMatcherFor(
+      const ByAsciiWhitespace&) {
+    return strings_internal::ByteSetMatcher(" \t\v\f\r\n");
+  }
 };
 
 // ByChar
@@ -177,6 +190,10 @@ class ByChar {
   absl::string_view Find(absl::string_view text, size_t pos) const;
 
  private:
+  friend strings_internal::ByteSetMatcher ByteSetMatcherFor(const ByChar& d) {
+    return strings_internal::ByteSetMatcher(d.c_);
+  }
+
   char c_;
 };
 
@@ -203,6 +220,13 @@ class ByAnyChar {
   absl::string_view Find(absl::string_view text, size_t pos) const;
 
  private:
+  friend strings_internal::ByteSetMatcher ByteSetMatcherFor(
+      const ByAnyChar& d) {
+    // An empty set keeps the special behavior of `Find()` described above.
+    if (d.delimiters_.empty()) return strings_internal::ByteSetMatcher();
+    return strings_internal::ByteSetMatcher(d.delimiters_);
+  }
+
   const std::string delimiters_;
 };
 
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <cstddef>
+#include <cstdint>
 #include <iterator>
 #include <string>
 #include <unordered_map>
@@ -177,4 +178,74 @@ void BM_SplitStringWithOneCharNoVector(benchmark::State& state) {
 BENCHMARK_TEMPLATE(BM_SplitStringWithOneCharNoVector, OneCharLiteral);
 BENCHMARK_TEMPLATE(BM_SplitStringWithOneCharNoVector, OneCharStringLiteral);
 
+// Returns a TSV-like buffer of about `total_length` bytes whose fields are
+// `field_length` bytes long on average, separated by `delimiters` in turn.
+std::string MakeFieldsTestString(size_t total_length, size_t field_length,
+                                 absl::string_view delimiters) {
+  std::string test(total_length, 'x');
+  size_t next = field_length / 2;
+  for (size_t i = 0; next < test.size(); ++i) {
+    test[next] = delimiters[i % delimiters.size()];
+    // Vary the field length between half and one and a half times the mean.
+    next += field_length / 2 + 1 + (i * 7919) % (field_length + 1);
+  }
+  return test;
+}
+
+// Splits a 64 KiB buffer into fields of `state.range(0)` bytes on average.
+void BM_SplitFieldsByChar(benchmark::State& state) {
+  const std::string test =
+      MakeFieldsTestString(1 << 16, static_cast<size_t>(state.range(0)), "\t");
+  for (auto _ : state) {
+    size_t fields = 0;
+    for (absl::string_view field : absl::StrSplit(test, '\t')) {
+      benchmark::DoNotOptimize(field);
+      ++fields;
+    }
+    benchmark::DoNotOptimize(fields);
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(test.size()));
+}
+BENCHMARK(BM_SplitFieldsByChar)->Arg(4)->Arg(16)->Arg(64)->Arg(256)->Arg(4096);
+
+void BM_SplitFieldsByAnyChar(benchmark::State& state) {
+  const std::string test = MakeFieldsTestString(
+      1 << 16, static_cast<size_t>(state.range(0)), kDelimiters);
+  for (auto _ : state) {
+    size_t fields = 0;
+    for (absl::string_view field :
+         absl::StrSplit(test, absl::ByAnyChar(kDelimiters))) {
+      benchmark::DoNotOptimize(field);
+      ++fields;
+    }
+    benchmark::DoNotOptimize(fields);
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(test.size()));
+}
+BENCHMARK(BM_SplitFieldsByAnyChar)
+    ->Arg(4)
+    ->Arg(16)
+    ->Arg(64)
+    ->Arg(256)
+    ->Arg(4096);
+
+void BM_SplitFieldsByAsciiWhitespace(benchmark::State& state) {
+  const std::string test = MakeFieldsTestString(
+      1 << 16, static_cast<size_t>(state.range(0)), " \t\n");
+  for (auto _ : state) {
+    size_t fields = 0;
+    for (absl::string_view field :
+         absl::StrSplit(test, absl::ByAsciiWhitespace())) {
+      benchmark::DoNotOptimize(field);
+      ++fields;
+    }
+    benchmark::DoNotOptimize(fields);
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(test.size()));
+}
+BENCHMARK(BM_SplitFieldsByAsciiWhitespace)->Arg(8)->Arg(64)->Arg(1024);
+
 }  // namespace
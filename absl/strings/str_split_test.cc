@@ -22,6 +22,7 @@
 #include <list>
 #include <map>
 #include <memory>
+#include <random>
 #include <set>
 #include <string>
 #include <unordered_map>
@@ -36,6 +37,7 @@
 #include "absl/container/btree_set.h"
 #include "absl/container/flat_hash_map.h"
 #include "absl/container/node_hash_map.h"
+#include "absl/strings/internal/simd_dispatch_test_util.h"
 #include "absl/strings/string_view.h"
 
 namespace {
@@ -1066,4 +1068,95 @@ TEST(SplitInternalTest, TypeTraits) {
                std::initializer_list<int>>::value));
 }
 
+// Splits `text` at every byte contained in `delimiters`, the obvious way.
+std::vector<absl::string_view> ReferenceSplit(absl::string_view text,
+                                              absl::string_view delimiters) {
+  std::vector<absl::string_view> result;
+  size_t start = 0;
+  for (size_t i = 0; i < text.size(); ++i) {
+    if (delimiters.find(text[i]) != absl::string_view::npos) {
+      result.push_back(text.substr(start, i - start));
+      start = i + 1;
+    }
+  }
+  result.push_back(text.substr(start));
+  return result;
+}
+
+TEST(Split, BlockScannerMatchesReference) {
+  const std::vector<std::string> delimiter_sets = {
+      ",",
+      "\t",
+      std::string(1, '\0'),
+      "\xff",
+      ",;",
+      " \t\v\f\r\n",
+      ",\xe9\x80",
+      // Spans more than eight distinct high nibbles.
+      std::string("\x01\x12\x23\x34\x45\x56\x67\x78\x89\x9a", 10),
+  };
+  std::mt19937 rng(1234);
+  std::vector<std::string> inputs = {"", ",", ",,", std::string(200, ',')};
+  for (size_t size : {1, 15, 16, 31, 32, 63, 64, 65, 127, 128, 129, 1000}) {
+    for (int density : {2, 10, 100}) {
+      std::string s(size, 'x');
+      for (char& c : s) {
+        c = static_cast<char>(rng() % density == 0 ? rng() : 'a' + rng() % 26);
+      }
+      inputs.push_back(s);
+    }
+  }
+  absl::strings_internal::ForEachSimdLevel([&] {
+    for (const std::string& delimiters : delimiter_sets) {
+      for (std::string input : inputs) {
+        // Make sure each delimiter occurs, leaving long fields at the end.
+        for (size_t i = 0; i < input.size() / 2; i += 7) {
+          input[i] = delimiters[i % delimiters.size()];
+        }
+        const auto expected = ReferenceSplit(input, delimiters);
+        std::vector<absl::string_view> any_char =
+            absl::StrSplit(input, absl::ByAnyChar(delimiters));
+        EXPECT_EQ(any_char, expected);
+        if (delimiters.size() == 1) {
+          std::vector<absl::string_view> by_char =
+              absl::StrSplit(input, delimiters[0]);
+          EXPECT_EQ(by_char, expected);
+          std::vector<absl::string_view> by_string =
+              absl::StrSplit(input, absl::ByString(delimiters));
+          EXPECT_EQ(by_string, expected);
+        }
+        if (delimiters == " \t\v\f\r\n") {
+          std::vector<absl::string_view> by_whitespace =
+              absl::StrSplit(input, absl::ByAsciiWhitespace());
+          EXPECT_EQ(by_whitespace, expected);
+        }
+      }
+    }
+  });
+}
+
+TEST(Split, BlockScannerWithPredicate) {
+  std::string input;
+  for (int i = 0; i < 100; ++i) {
+    input += std::string(static_cast<size_t>(i % 5), 'a');
+    input += i % 3 == 0 ? ",," : ",";
+  }
+  std::vector<std::string> expected;
+  for (absl::string_view piece : ReferenceSplit(input, ",")) {
+    if (!piece.empty()) expected.emplace_back(piece);
+  }
+  std::vector<std::string> actual =
+      absl::StrSplit(input, ',', absl::SkipEmpty());
+  EXPECT_EQ(actual, expected);
+  // Copies of an iterator continue independently from the same position.
+  auto splitter = absl::StrSplit(input, ',', absl::SkipEmpty());
+  auto it = splitter.begin();
+  ++it;
+  auto copy = it;
+  ++it;
+  ++copy;
+  EXPECT_EQ(*it, *copy);
+  EXPECT_EQ(it, copy);
+}
+
 }  // namespace
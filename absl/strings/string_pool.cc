@@ -0,0 +1,144 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/strings/string_pool.h"
+
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <memory>
+
+#include "absl/base/config.h"
+#include "absl/base/optimization.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_set.h"
+#include "absl/hash/hash.h"
+#include "absl/numeric/bits.h"
+#include "absl/strings/string_view.h"
+#include "absl/synchronization/mutex.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+namespace strings_internal {
+
+ABSL_CONST_INIT const EmptyInternedString kEmptyInternedString = {{0}, {'\0'}};
+
+}  // namespace strings_internal
+
+namespace {
+
+using strings_internal::InternedStringRep;
+
+// The size of the blocks that strings are copied into. Strings that would use
+// more than a quarter of a block get a block of their own, which bounds the
+// space wasted at the end of each block.
+constexpr size_t kBlockSize = 16 << 10;
+
+// Returns the number of bytes used by the pooled copy of a string of `size`
+// characters: a header, the characters and a NUL, padded so that the next
+// header is aligned.
+size_t EntrySize(size_t size) {
+  constexpr size_t kAlign = alignof(InternedStringRep);
+  return (sizeof(InternedStringRep) + size + 1 + kAlign - 1) & ~(kAlign - 1);
+}
+
+}  // namespace
+
+const char* StringPool::Store(absl::string_view s) {
+  const size_t entry_size = EntrySize(s.size());
+  char* entry;
+  if (entry_size > kBlockSize / 4) {
+    blocks_.emplace_back(new char[entry_size]);
+    bytes_allocated_ += entry_size;
+    entry = blocks_.back().get();
+  } else {
+    if (ABSL_PREDICT_FALSE(entry_size > available_)) {
+      blocks_.emplace_back(new char[kBlockSize]);
+      bytes_allocated_ += kBlockSize;
+      next_ = blocks_.back().get();
+      available_ = kBlockSize;
+    }
+    entry = next_;
+    next_ += entry_size;
+    available_ -= entry_size;
+  }
+  const InternedStringRep rep = {s.size()};
+  std::memcpy(entry, &rep, sizeof(rep));
+  char* data = entry + sizeof(rep);
+  std::memcpy(data, s.data(), s.size());
+  data[s.size()] = '\0';
+  return data;
+}
+
+InternedString StringPool::Intern(absl::string_view s) {
+  if (s.empty()) return InternedString();
+  // `lazy_emplace` only copies `s` into the pool if it is not already there,
+  // and hashes it just once either way.
+  return InternedString(*set_.lazy_emplace(
+      s, [&](const auto& construct) { construct(Store(s)); }));
+}
+
+size_t StringPool::MemoryUsage() const {
+  return bytes_allocated_ + blocks_.capacity() * sizeof(blocks_[0]) +
+         set_.capacity() * (sizeof(const char*) + 1);
+}
+
+struct ABSL_CACHELINE_ALIGNED ConcurrentStringPool::Shard {
+  mutable absl::Mutex mu;
+  StringPool pool ABSL_GUARDED_BY(mu);
+};
+
+ConcurrentStringPool::ConcurrentStringPool(size_t num_shards)
+    : shard_mask_(absl::bit_ceil(num_shards < 1 ? size_t{1} : num_shards) - 1),
+      shards_(new Shard[shard_mask_ + 1]) {}
+
+ConcurrentStringPool::~ConcurrentStringPool() = default;
+
+ConcurrentStringPool::Shard& ConcurrentStringPool::ShardFor(
+    absl::string_view s) const {
+  // The upper half of the hash selects the shard, so that strings in the same
+  // shard still differ in the bits that select their slot within its table.
+  const size_t hash = absl::HashOf(s);
+  return shards_[(hash >> (std::numeric_limits<size_t>::digits / 2)) &
+                 shard_mask_];
+}
+
+InternedString ConcurrentStringPool::Intern(absl::string_view s) {
+  if (s.empty()) return InternedString();
+  Shard& shard = ShardFor(s);
+  absl::MutexLock lock(&shard.mu);
+  return shard.pool.Intern(s);
+}
+
+size_t ConcurrentStringPool::size() const {
+  size_t total = 0;
+  for (size_t i = 0; i <= shard_mask_; ++i) {
+    absl::MutexLock lock(&shards_[i].mu);
+    total += shards_[i].pool.size();
+  }
+  return total;
+}
+
+size_t ConcurrentStringPool::MemoryUsage() const {
+  size_t total = (shard_mask_ + 1) * sizeof(Shard);
+  for (size_t i = 0; i <= shard_mask_; ++i) {
+    absl::MutexLock lock(&shards_[i].mu);
+    total += shards_[i].pool.MemoryUsage();
+  }
+  return total;
+}
+
+ABSL_NAMESPACE_END
+}  // namespace absl
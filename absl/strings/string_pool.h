@@ -0,0 +1,245 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// -----------------------------------------------------------------------------
+// File: string_pool.h
+// -----------------------------------------------------------------------------
+//
+// This header file defines string interning facilities. Interning stores a
+// single copy of each distinct string and hands out `absl::InternedString`
+// handles to it. Handles are the size of a pointer, and compare and hash by
+// that pointer, so they suit metric names, label keys, flag values and other
+// strings that are duplicated many times and compared on hot paths.
+//
+// There are two pools:
+//
+//   * `absl::StringPool` is not thread-safe, and is the fastest option for
+//     strings interned by a single thread.
+//   * `absl::ConcurrentStringPool` may be used from any number of threads. It
+//     splits its strings across independently locked shards.
+//
+// Example:
+//
+//   absl::ConcurrentStringPool pool;
+//   absl::InternedString a = pool.Intern("rpc/server/latency");
+//   absl::InternedString b = pool.Intern(std::string("rpc/server/latency"));
+//   assert(a == b);  // Compares a single pointer.
+//   assert(a.view() == "rpc/server/latency");
+
+#ifndef ABSL_STRINGS_STRING_POOL_H_
+#define ABSL_STRINGS_STRING_POOL_H_
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <ostream>
+#include <utility>
+#include <vector>
+
+#include "absl/base/config.h"
+#include "absl/container/flat_hash_set.h"
+#include "absl/hash/hash.h"
+#include "absl/strings/string_view.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+class StringPool;
+
+namespace strings_internal {
+
+// The header of each string stored by a pool. The characters, followed by a
+// NUL terminator, are stored immediately after it.
+struct InternedStringRep {
+  size_t size;
+};
+
+// The representation of the empty string, shared by all pools.
+struct EmptyInternedString {
+  InternedStringRep rep;
+  char data[1];
+};
+ABSL_DLL extern const EmptyInternedString kEmptyInternedString;
+
+// Returns the pooled string whose characters start at `data`.
+inline absl::string_view InternedStringView(const char* data) {
+  InternedStringRep rep;
+  std::memcpy(&rep, data - sizeof(rep), sizeof(rep));
+  return absl::string_view(data, rep.size);
+}
+
+// Hash and equality for the set of pooled strings, which stores just a pointer
+// to the characters of each string. Lookups use the `string_view` being
+// interned.
+struct InternedStringHash {
+  using is_transparent = void;
+
+  size_t operator()(absl::string_view s) const {
+    return absl::Hash<absl::string_view>()(s);
+  }
+  size_t operator()(const char* data) const {
+    return (*this)(InternedStringView(data));
+  }
+};
+
+struct InternedStringEq {
+  using is_transparent = void;
+
+  static absl::string_view View(absl::string_view s) { return s; }
+  static absl::string_view View(const char* data) {
+    return InternedStringView(data);
+  }
+
+  template <typename A, typename B>
+  bool operator()(const A& a, const B& b) const {
+    return View(a) == View(b);
+  }
+};
+
+}  // namespace strings_internal
+
+// InternedString
+//
+// A handle to a string stored by a `StringPool` or `ConcurrentStringPool`. It
+// remains valid for the lifetime of that pool. Two handles from the same pool
+// are equal if and only if their strings are equal; comparing handles from
+// different pools is only meaningful for the empty string, which has the same
+// handle in all pools.
+//
+// A default-constructed `InternedString` holds the empty string.
+class InternedString {
+ public:
+  InternedString() noexcept
+      : data_(strings_internal::kEmptyInternedString.data) {}
+
+  const char* data() const { return data_; }
+  // Returns the string as a NUL-terminated C string.
+  const char* c_str() const { return data_; }
+  size_t size() const { return view().size(); }
+  bool empty() const { return size() == 0; }
+
+  absl::string_view view() const {
+    return strings_internal::InternedStringView(data_);
+  }
+  operator absl::string_view() const { return view(); }  // NOLINT
+
+  friend bool operator==(InternedString a, InternedString b) {
+    return a.data_ == b.data_;
+  }
+  friend bool operator!=(InternedString a, InternedString b) {
+    return a.data_ != b.data_;
+  }
+
+  // Hashes the handle rather than the characters, so the hash of an
+  // `InternedString` differs from that of the equivalent `string_view`.
+  template <typename H>
+  friend H AbslHashValue(H h, InternedString s) {
+    return H::combine(std::move(h), s.data_);
+  }
+
+  template <typename Sink>
+  friend void AbslStringify(Sink& sink, InternedString s) {
+    sink.Append(s.view());
+  }
+
+  friend std::ostream& operator<<(std::ostream& os, InternedString s) {
+    return os << s.view();
+  }
+
+ private:
+  friend class StringPool;
+
+  explicit InternedString(const char* data) : data_(data) {}
+
+  const char* data_;
+};
+
+// StringPool
+//
+// Interns strings into storage owned by the pool. Strings are copied into
+// large blocks, each prefixed by its length, and are never moved or freed
+// before the pool is destroyed. The table indexing them holds a single pointer
+// per string. The pool is not thread-safe.
+class StringPool {
+ public:
+  StringPool() = default;
+  StringPool(const StringPool&) = delete;
+  StringPool& operator=(const StringPool&) = delete;
+  ~StringPool() = default;
+
+  // Returns the handle of the pooled copy of `s`, copying `s` into the pool if
+  // it is not already there.
+  InternedString Intern(absl::string_view s);
+
+  // Returns the number of distinct non-empty strings in the pool.
+  size_t size() const { return set_.size(); }
+
+  // Returns the number of bytes allocated by the pool, for both the strings
+  // and the table that indexes them.
+  size_t MemoryUsage() const;
+
+ private:
+  // Copies `s` into the arena and returns its characters.
+  const char* Store(absl::string_view s);
+
+  absl::flat_hash_set<const char*, strings_internal::InternedStringHash,
+                      strings_internal::InternedStringEq>
+      set_;
+  std::vector<std::unique_ptr<char[]>> blocks_;
+  size_t bytes_allocated_ = 0;
+  // The unused part of the current block.
+  char* next_ = nullptr;
+  size_t available_ = 0;
+};
+
+// ConcurrentStringPool
+//
+// A thread-safe string pool. Strings are assigned to one of `num_shards`
+// shards by their hash, so concurrent interning of different strings rarely
+// contends on the same lock.
+class ConcurrentStringPool {
+ public:
+  // The number of shards used by the default constructor.
+  static constexpr size_t kDefaultShards = 16;
+
+  ConcurrentStringPool() : ConcurrentStringPool(kDefaultShards) {}
+  // `num_shards` is rounded up to a power of two.
+  explicit ConcurrentStringPool(size_t num_shards);
+  ConcurrentStringPool(const ConcurrentStringPool&) = delete;
+  ConcurrentStringPool& operator=(const ConcurrentStringPool&) = delete;
+  ~ConcurrentStringPool();
+
+  // Returns the handle of the pooled copy of `s`, copying `s` into the pool if
+  // it is not already there.
+  InternedString Intern(absl::string_view s);
+
+  // Returns the number of distinct non-empty strings in the pool.
+  size_t size() const;
+
+  // Returns the number of bytes allocated by the pool.
+  size_t MemoryUsage() const;
+
+ private:
+  struct Shard;
+
+  Shard& ShardFor(absl::string_view s) const;
+
+  size_t shard_mask_;
+  std::unique_ptr<Shard[]> shards_;
+};
+
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_STRINGS_STRING_POOL_H_
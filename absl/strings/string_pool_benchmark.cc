@@ -0,0 +1,129 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "absl/profiling/benchmark.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_pool.h"
+#include "absl/strings/string_view.h"
+
+namespace {
+
+// Returns `n` distinct strings shaped like metric names.
+std::vector<std::string> MakeNames(size_t n) {
+  std::vector<std::string> names;
+  names.reserve(n);
+  for (size_t i = 0; i < n; ++i) {
+    names.push_back(absl::StrCat("/rpc/server/", i % 97, "/latency_", i));
+  }
+  return names;
+}
+
+// Interns strings that are already in the pool, the common case for
+// deduplicating repeated names.
+void BM_InternExisting(benchmark::State& state) {
+  const std::vector<std::string> names =
+      MakeNames(static_cast<size_t>(state.range(0)));
+  absl::StringPool pool;
+  for (const std::string& name : names) pool.Intern(name);
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(pool.Intern(names[i]));
+    if (++i == names.size()) i = 0;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_InternExisting)->Arg(1 << 10)->Arg(1 << 20);
+
+// Interns distinct strings into a fresh pool, and reports the memory used per
+// string, against a `std::string` copy of each.
+void BM_InternNew(benchmark::State& state) {
+  const std::vector<std::string> names =
+      MakeNames(static_cast<size_t>(state.range(0)));
+  size_t memory = 0;
+  for (auto _ : state) {
+    absl::StringPool pool;
+    for (const std::string& name : names) {
+      benchmark::DoNotOptimize(pool.Intern(name));
+    }
+    memory = pool.MemoryUsage();
+  }
+  // Strings longer than the inline capacity of `std::string` are allocated on
+  // the heap.
+  const size_t inline_capacity = std::string().capacity();
+  size_t string_memory = 0;
+  for (const std::string& name : names) {
+    string_memory += sizeof(std::string);
+    if (name.size() > inline_capacity) string_memory += name.size() + 1;
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.counters["pool_bytes_per_string"] =
+      static_cast<double>(memory) / names.size();
+  state.counters["std_string_bytes_per_string"] =
+      static_cast<double>(string_memory) / names.size();
+}
+BENCHMARK(BM_InternNew)->Arg(1 << 10)->Arg(1 << 20);
+
+void BM_ConcurrentInternExisting(benchmark::State& state) {
+  static absl::ConcurrentStringPool* pool = nullptr;
+  static std::vector<std::string>* names = nullptr;
+  if (state.thread_index() == 0) {
+    pool = new absl::ConcurrentStringPool;
+    names = new std::vector<std::string>(MakeNames(1 << 16));
+    for (const std::string& name : *names) pool->Intern(name);
+  }
+  // Threads start at different strings.
+  size_t i = static_cast<size_t>(state.thread_index()) * 7919;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(pool->Intern((*names)[i % names->size()]));
+    ++i;
+  }
+  state.SetItemsProcessed(state.iterations());
+  if (state.thread_index() == 0) {
+    delete pool;
+    delete names;
+  }
+}
+BENCHMARK(BM_ConcurrentInternExisting)->ThreadRange(1, 8)->UseRealTime();
+
+// Compares equal names that are stored separately, as strings and as handles.
+void BM_CompareStrings(benchmark::State& state) {
+  const std::string a = "/rpc/server/requests/latency_histogram";
+  const std::string b = a;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(b);
+    benchmark::DoNotOptimize(a == b);
+  }
+}
+BENCHMARK(BM_CompareStrings);
+
+void BM_CompareInternedStrings(benchmark::State& state) {
+  absl::StringPool pool;
+  const absl::InternedString a =
+      pool.Intern("/rpc/server/requests/latency_histogram");
+  const absl::InternedString b =
+      pool.Intern(std::string("/rpc/server/requests/latency_histogram"));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(b);
+    benchmark::DoNotOptimize(a == b);
+  }
+}
+BENCHMARK(BM_CompareInternedStrings);
+
+}  // namespace
@@ -0,0 +1,148 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/strings/string_pool.h"
+
+#include <cstddef>
+#include <sstream>
+#include <string>
+#include <thread>  // NOLINT(build/c++11)
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "absl/container/flat_hash_set.h"
+#include "absl/hash/hash.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_format.h"
+#include "absl/strings/string_view.h"
+#include "absl/synchronization/notification.h"
+
+namespace {
+
+TEST(InternedString, Default) {
+  absl::InternedString s;
+  EXPECT_TRUE(s.empty());
+  EXPECT_EQ(s.size(), 0);
+  EXPECT_STREQ(s.c_str(), "");
+  EXPECT_EQ(s.view(), "");
+  EXPECT_EQ(s, absl::InternedString());
+}
+
+TEST(StringPool, Intern) {
+  absl::StringPool pool;
+  const std::string name = "rpc/server/latency";
+  const absl::InternedString a = pool.Intern(name);
+  const absl::InternedString b = pool.Intern("rpc/server/latency");
+  const absl::InternedString c = pool.Intern("rpc/server/count");
+  EXPECT_EQ(a, b);
+  EXPECT_NE(a, c);
+  EXPECT_EQ(a.view(), name);
+  EXPECT_NE(a.data(), name.data());
+  EXPECT_EQ(a.size(), name.size());
+  EXPECT_STREQ(a.c_str(), name.c_str());
+  EXPECT_EQ(c.view(), "rpc/server/count");
+  EXPECT_EQ(pool.size(), 2);
+
+  // The empty string is never stored, and has the same handle in every pool.
+  EXPECT_EQ(pool.Intern(""), absl::InternedString());
+  EXPECT_EQ(pool.size(), 2);
+}
+
+TEST(StringPool, EmbeddedNulsAndLongStrings) {
+  absl::StringPool pool;
+  const std::string with_nul("a\0b", 3);
+  EXPECT_EQ(pool.Intern(with_nul).view(), with_nul);
+  EXPECT_NE(pool.Intern(with_nul), pool.Intern("a"));
+
+  // Strings larger than the arena blocks are stored on their own.
+  const std::string large(100000, 'x');
+  const absl::InternedString handle = pool.Intern(large);
+  EXPECT_EQ(handle.view(), large);
+  EXPECT_EQ(pool.Intern(std::string(100000, 'x')), handle);
+  EXPECT_GE(pool.MemoryUsage(), large.size());
+}
+
+TEST(StringPool, HandlesRemainValid) {
+  absl::StringPool pool;
+  std::vector<absl::InternedString> handles;
+  for (int i = 0; i < 100000; ++i) {
+    handles.push_back(pool.Intern(absl::StrCat("metric/", i)));
+  }
+  EXPECT_EQ(pool.size(), handles.size());
+  for (int i = 0; i < 100000; ++i) {
+    ASSERT_EQ(handles[i].view(), absl::StrCat("metric/", i));
+    ASSERT_EQ(pool.Intern(absl::StrCat("metric/", i)), handles[i]);
+  }
+  // Each string costs its characters plus a small fixed overhead.
+  EXPECT_LT(pool.MemoryUsage(), handles.size() * 64);
+}
+
+TEST(InternedString, HashAndFormat) {
+  absl::StringPool pool;
+  absl::flat_hash_set<absl::InternedString> set;
+  set.insert(pool.Intern("a"));
+  set.insert(pool.Intern("b"));
+  set.insert(pool.Intern("a"));
+  EXPECT_EQ(set.size(), 2);
+  EXPECT_TRUE(set.contains(pool.Intern("b")));
+
+  const absl::InternedString s = pool.Intern("label");
+  EXPECT_EQ(absl::StrCat(s, "=1"), "label=1");
+  EXPECT_EQ(absl::StrFormat("%v", s), "label");
+  std::ostringstream os;
+  os << s;
+  EXPECT_EQ(os.str(), "label");
+}
+
+TEST(ConcurrentStringPool, Intern) {
+  absl::ConcurrentStringPool pool(3);
+  const absl::InternedString a = pool.Intern("a");
+  EXPECT_EQ(pool.Intern(std::string("a")), a);
+  EXPECT_NE(pool.Intern("b"), a);
+  EXPECT_EQ(pool.Intern(""), absl::InternedString());
+  EXPECT_EQ(pool.size(), 2);
+  EXPECT_GT(pool.MemoryUsage(), 0);
+}
+
+TEST(ConcurrentStringPool, ManyThreads) {
+  constexpr int kThreads = 8;
+  constexpr int kStrings = 5000;
+  absl::ConcurrentStringPool pool;
+  std::vector<std::vector<absl::InternedString>> handles(kThreads);
+  absl::Notification start;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&, t] {
+      start.WaitForNotification();
+      // Every thread interns the same strings, in a different order.
+      for (int i = 0; i < kStrings; ++i) {
+        const int n = (i * 7 + t * 1013) % kStrings;
+        handles[t].push_back(pool.Intern(absl::StrCat("key", n)));
+      }
+    });
+  }
+  start.Notify();
+  for (std::thread& thread : threads) thread.join();
+
+  EXPECT_EQ(pool.size(), kStrings);
+  for (int t = 0; t < kThreads; ++t) {
+    for (int i = 0; i < kStrings; ++i) {
+      const int n = (i * 7 + t * 1013) % kStrings;
+      ASSERT_EQ(handles[t][i], pool.Intern(absl::StrCat("key", n)));
+      ASSERT_EQ(handles[t][i].view(), absl::StrCat("key", n));
+    }
+  }
+}
+
+}  // namespace
@@ -0,0 +1,606 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/strings/unicode.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+#include "absl/base/config.h"
+#include "absl/base/nullability.h"
+#include "absl/base/optimization.h"
+#include "absl/numeric/bits.h"
+#include "absl/strings/internal/resize_uninitialized.h"
+#include "absl/strings/internal/simd_dispatch.h"
+#include "absl/strings/internal/utf8.h"
+#include "absl/strings/string_view.h"
+
+#if defined(ABSL_INTERNAL_STRINGS_HAVE_X86_DISPATCH)
+#include <immintrin.h>
+#elif defined(ABSL_INTERNAL_HAVE_ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define ABSL_INTERNAL_STRINGS_UNICODE_NEON 1
+#endif
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+namespace {
+
+using strings_internal::SimdLevel;
+
+inline bool IsContinuation(unsigned char c) { return (c & 0xC0) == 0x80; }
+
+// Returns the length of the sequence introduced by lead byte `c`, or 0 if `c`
+// cannot start a sequence. Does not check the continuation bytes.
+inline size_t SequenceLength(unsigned char c) {
+  if (c < 0x80) return 1;
+  if (c < 0xC2) return 0;
+  if (c < 0xE0) return 2;
+  if (c < 0xF0) return 3;
+  if (c < 0xF5) return 4;
+  return 0;
+}
+
+// Returns whether the 8 bytes at `p` are all ASCII.
+inline bool IsAsciiWord(const unsigned char* p) {
+  uint64_t word;
+  std::memcpy(&word, p, sizeof(word));
+  return (word & uint64_t{0x8080808080808080}) == 0;
+}
+
+// Decodes one code point from `p[0, n)`, `n > 0`. On success stores the code
+// point in `*cp` and returns the sequence length; returns 0 on an ill-formed
+// or truncated sequence. The continuation ranges follow Table 3-7 of the
+// Unicode Standard.
+inline size_t DecodeOne(const unsigned char* p, size_t n, char32_t* cp) {
+  const unsigned char c = p[0];
+  if (c < 0x80) {
+    *cp = c;
+    return 1;
+  }
+  const size_t len = SequenceLength(c);
+  if (len == 0 || len > n) return 0;
+  unsigned char lo = 0x80, hi = 0xBF;
+  if (c == 0xE0) lo = 0xA0;
+  if (c == 0xED) hi = 0x9F;
+  if (c == 0xF0) lo = 0x90;
+  if (c == 0xF4) hi = 0x8F;
+  if (p[1] < lo || p[1] > hi) return 0;
+  char32_t v = c & (0x7F >> len);
+  v = (v << 6) | (p[1] & 0x3F);
+  for (size_t i = 2; i < len; ++i) {
+    if (!IsContinuation(p[i])) return 0;
+    v = (v << 6) | (p[i] & 0x3F);
+  }
+  *cp = v;
+  return len;
+}
+
+// Validates `p[pos, n)` and returns the end of the longest valid prefix.
+size_t ValidateScalar(const unsigned char* p, size_t pos, size_t n) {
+  while (pos < n) {
+    if (n - pos >= 8 && IsAsciiWord(p + pos)) {
+      pos += 8;
+      continue;
+    }
+    char32_t unused;
+    const size_t len = DecodeOne(p + pos, n - pos, &unused);
+    if (len == 0) return pos;
+    pos += len;
+  }
+  return pos;
+}
+
+// Returns the last code point boundary at or before `pos`, given that
+// `p[0, pos)` has no ill-formed sequences other than possibly a truncated or
+// invalid lead byte among the last three bytes (the vector kernels only
+// diagnose those when they see the following block).
+size_t BoundaryBefore(const unsigned char* p, size_t pos) {
+  const size_t limit = pos < 4 ? pos : 4;
+  for (size_t back = 1; back <= limit; ++back) {
+    if (!IsContinuation(p[pos - back])) {
+      const size_t len = SequenceLength(p[pos - back]);
+      return len != 0 && back >= len ? pos : pos - back;
+    }
+  }
+  return pos;
+}
+
+#if defined(ABSL_INTERNAL_STRINGS_HAVE_X86_DISPATCH) || \
+    defined(ABSL_INTERNAL_STRINGS_UNICODE_NEON)
+
+// ----------------------------------------------------------------------
+// Vectorized validation, after Keiser and Lemire, "Validating UTF-8 In Less
+// Than One Instruction Per Byte" (2021).
+//
+// Every ill-formed two-byte pattern is detected by looking up the high and low
+// nibbles of the previous byte and the high nibble of the current byte in
+// three 16-entry tables and AND-ing the results; each bit of the result names
+// one class of error. Three- and four-byte sequences additionally require
+// that the bytes two and three positions after a lead byte are continuation
+// bytes, which is checked with saturating subtractions.
+//
+// The kernels validate whole 64-byte chunks and return the last code point
+// boundary before the first chunk that contains an error (or before the
+// unprocessed tail); the scalar code validates from there, which yields the
+// exact error position and handles truncated trailing sequences.
+// ----------------------------------------------------------------------
+
+constexpr uint8_t kTooShort = 1 << 0;
+constexpr uint8_t kTooLong = 1 << 1;
+constexpr uint8_t kOverlong3 = 1 << 2;
+constexpr uint8_t kTooLarge = 1 << 3;
+constexpr uint8_t kSurrogate = 1 << 4;
+constexpr uint8_t kOverlong2 = 1 << 5;
+constexpr uint8_t kTooLarge1000 = 1 << 6;
+constexpr uint8_t kOverlong4 = 1 << 6;
+constexpr uint8_t kTwoConts = 1 << 7;
+constexpr uint8_t kCarry = kTooShort | kTooLong | kTwoConts;
+
+// Indexed by the high nibble of the previous byte.
+alignas(16) constexpr uint8_t kByte1High[16] = {
+    kTooLong, kTooLong, kTooLong, kTooLong,  // 0xxx: ASCII
+    kTooLong, kTooLong, kTooLong, kTooLong,  //
+    kTwoConts, kTwoConts, kTwoConts, kTwoConts,  // 10xx: continuation
+    kTooShort | kOverlong2,                      // 1100: 2-byte lead
+    kTooShort,                                   // 1101: 2-byte lead
+    kTooShort | kOverlong3 | kSurrogate,         // 1110: 3-byte lead
+    kTooShort | kTooLarge | kTooLarge1000 | kOverlong4,  // 1111: 4-byte lead
+};
+
+// Indexed by the low nibble of the previous byte.
+alignas(16) constexpr uint8_t kByte1Low[16] = {
+    kCarry | kOverlong3 | kOverlong2 | kOverlong4,  // xxxx0000
+    kCarry | kOverlong2,                            // xxxx0001
+    kCarry,
+    kCarry,
+    kCarry | kTooLarge,                   // xxxx0100
+    kCarry | kTooLarge | kTooLarge1000,   // xxxx0101
+    kCarry | kTooLarge | kTooLarge1000,
+    kCarry | kTooLarge | kTooLarge1000,
+    kCarry | kTooLarge | kTooLarge1000,
+    kCarry | kTooLarge | kTooLarge1000,
+    kCarry | kTooLarge | kTooLarge1000,
+    kCarry | kTooLarge | kTooLarge1000,
+    kCarry | kTooLarge | kTooLarge1000,
+    kCarry | kTooLarge | kTooLarge1000 | kSurrogate,  // xxxx1101
+    kCarry | kTooLarge | kTooLarge1000,
+    kCarry | kTooLarge | kTooLarge1000,
+};
+
+// Indexed by the high nibble of the current byte.
+alignas(16) constexpr uint8_t kByte2High[16] = {
+    kTooShort, kTooShort, kTooShort, kTooShort,  // 0xxx: ASCII
+    kTooShort, kTooShort, kTooShort, kTooShort,  //
+    kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge1000 |
+        kOverlong4,                                          // 1000
+    kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge,  // 1001
+    kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,  // 1010
+    kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,  // 1011
+    kTooShort, kTooShort, kTooShort, kTooShort,  // 11xx: lead byte
+};
+
+// A trailing lead byte is incomplete if it is within 1, 2 or 3 bytes of the
+// end of a block and starts a sequence that is longer than that. Bytes that
+// exceed these maximums flag an incomplete sequence.
+alignas(16) constexpr uint8_t kIncompleteMax[16] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0 - 1,
+    0xE0 - 1, 0xC0 - 1,
+};
+
+#endif
+
+#if defined(ABSL_INTERNAL_STRINGS_HAVE_X86_DISPATCH)
+
+ABSL_INTERNAL_STRINGS_TARGET_SSSE3 inline __m128i CheckBlockSsse3(
+    __m128i input, __m128i prev_input) {
+  const __m128i byte_1_high = _mm_load_si128(
+      reinterpret_cast<const __m128i*>(kByte1High));
+  const __m128i byte_1_low =
+      _mm_load_si128(reinterpret_cast<const __m128i*>(kByte1Low));
+  const __m128i byte_2_high =
+      _mm_load_si128(reinterpret_cast<const __m128i*>(kByte2High));
+  const __m128i low_nibble = _mm_set1_epi8(0x0F);
+
+  const __m128i prev1 = _mm_alignr_epi8(input, prev_input, 16 - 1);
+  const __m128i special = _mm_and_si128(
+      _mm_and_si128(
+          _mm_shuffle_epi8(byte_1_high,
+                           _mm_and_si128(_mm_srli_epi16(prev1, 4), low_nibble)),
+          _mm_shuffle_epi8(byte_1_low, _mm_and_si128(prev1, low_nibble))),
+      _mm_shuffle_epi8(byte_2_high,
+                       _mm_and_si128(_mm_srli_epi16(input, 4), low_nibble)));
+
+  const __m128i prev2 = _mm_alignr_epi8(input, prev_input, 16 - 2);
+  const __m128i prev3 = _mm_alignr_epi8(input, prev_input, 16 - 3);
+  const __m128i is_third = _mm_subs_epu8(prev2, _mm_set1_epi8(0xE0 - 0x80));
+  const __m128i is_fourth = _mm_subs_epu8(prev3, _mm_set1_epi8(0xF0 - 0x80));
+  const __m128i must_be_continuation = _mm_and_si128(
+      _mm_or_si128(is_third, is_fourth), _mm_set1_epi8(static_cast<char>(0x80)));
+  return _mm_xor_si128(must_be_continuation, special);
+}
+
+ABSL_INTERNAL_STRINGS_TARGET_SSSE3 size_t ValidateSsse3(const unsigned char* p,
+                                                        size_t n) {
+  const __m128i incomplete_max =
+      _mm_load_si128(reinterpret_cast<const __m128i*>(kIncompleteMax));
+  __m128i prev_input = _mm_setzero_si128();
+  __m128i prev_incomplete = _mm_setzero_si128();
+  size_t pos = 0;
+  for (; n - pos >= 64; pos += 64) {
+    __m128i error = _mm_setzero_si128();
+    for (size_t i = 0; i < 64; i += 16) {
+      const __m128i input =
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + pos + i));
+      if (_mm_movemask_epi8(input) == 0) {
+        // ASCII cannot continue a sequence left open by the previous block.
+        error = _mm_or_si128(error, prev_incomplete);
+        prev_incomplete = _mm_setzero_si128();
+      } else {
+        error = _mm_or_si128(error, CheckBlockSsse3(input, prev_input));
+        prev_incomplete = _mm_subs_epu8(input, incomplete_max);
+      }
+      prev_input = input;
+    }
+    if (_mm_movemask_epi8(_mm_cmpeq_epi8(error, _mm_setzero_si128())) !=
+        0xFFFF) {
+      break;
+    }
+  }
+  return pos == 0 ? 0 : BoundaryBefore(p, pos);
+}
+
+ABSL_INTERNAL_STRINGS_TARGET_AVX2 inline __m256i CheckBlockAvx2(
+    __m256i input, __m256i prev_input) {
+  const __m256i byte_1_high = _mm256_broadcastsi128_si256(
+      _mm_load_si128(reinterpret_cast<const __m128i*>(kByte1High)));
+  const __m256i byte_1_low = _mm256_broadcastsi128_si256(
+      _mm_load_si128(reinterpret_cast<const __m128i*>(kByte1Low)));
+  const __m256i byte_2_high = _mm256_broadcastsi128_si256(
+      _mm_load_si128(reinterpret_cast<const __m128i*>(kByte2High)));
+  const __m256i low_nibble = _mm256_set1_epi8(0x0F);
+
+  // `alignr` works within 128-bit lanes, so first build the vector whose
+  // lanes precede those of `input`.
+  const __m256i shifted = _mm256_permute2x128_si256(prev_input, input, 0x21);
+  const __m256i prev1 = _mm256_alignr_epi8(input, shifted, 16 - 1);
+  const __m256i special = _mm256_and_si256(
+      _mm256_and_si256(
+          _mm256_shuffle_epi8(
+              byte_1_high,
+              _mm256_and_si256(_mm256_srli_epi16(prev1, 4), low_nibble)),
+          _mm256_shuffle_epi8(byte_1_low, _mm256_and_si256(prev1, low_nibble))),
+      _mm256_shuffle_epi8(
+          byte_2_high,
+          _mm256_and_si256(_mm256_srli_epi16(input, 4), low_nibble)));
+
+  const __m256i prev2 = _mm256_alignr_epi8(input, shifted, 16 - 2);
+  const __m256i prev3 = _mm256_alignr_epi8(input, shifted, 16 - 3);
+  const __m256i is_third =
+      _mm256_subs_epu8(prev2, _mm256_set1_epi8(0xE0 - 0x80));
+  const __m256i is_fourth =
+      _mm256_subs_epu8(prev3, _mm256_set1_epi8(0xF0 - 0x80));
+  const __m256i must_be_continuation =
+      _mm256_and_si256(_mm256_or_si256(is_third, is_fourth),
+                       _mm256_set1_epi8(static_cast<char>(0x80)));
+  return _mm256_xor_si256(must_be_continuation, special);
+}
+
+ABSL_INTERNAL_STRINGS_TARGET_AVX2 size_t ValidateAvx2(const unsigned char* p,
+                                                      size_t n) {
+  const __m256i incomplete_max = _mm256_inserti128_si256(
+      _mm256_set1_epi8(static_cast<char>(0xFF)),
+      _mm_load_si128(reinterpret_cast<const __m128i*>(kIncompleteMax)), 1);
+  __m256i prev_input = _mm256_setzero_si256();
+  __m256i prev_incomplete = _mm256_setzero_si256();
+  size_t pos = 0;
+  for (; n - pos >= 64; pos += 64) {
+    __m256i error = _mm256_setzero_si256();
+    for (size_t i = 0; i < 64; i += 32) {
+      const __m256i input =
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + pos + i));
+      if (_mm256_movemask_epi8(input) == 0) {
+        error = _mm256_or_si256(error, prev_incomplete);
+        prev_incomplete = _mm256_setzero_si256();
+      } else {
+        error = _mm256_or_si256(error, CheckBlockAvx2(input, prev_input));
+        prev_incomplete = _mm256_subs_epu8(input, incomplete_max);
+      }
+      prev_input = input;
+    }
+    if (!_mm256_testz_si256(error, error)) break;
+  }
+  return pos == 0 ? 0 : BoundaryBefore(p, pos);
+}
+
+ABSL_INTERNAL_STRINGS_TARGET_AVX2 size_t CountContinuationAvx2(
+    const unsigned char* p, size_t n, size_t* consumed) {
+  // Continuation bytes are exactly the bytes below -64 as signed values.
+  const __m256i threshold = _mm256_set1_epi8(-64);
+  size_t count = 0;
+  size_t pos = 0;
+  for (; n - pos >= 32; pos += 32) {
+    const __m256i input =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + pos));
+    count += static_cast<size_t>(absl::popcount(static_cast<uint32_t>(
+        _mm256_movemask_epi8(_mm256_cmpgt_epi8(threshold, input)))));
+  }
+  *consumed = pos;
+  return count;
+}
+
+#elif defined(ABSL_INTERNAL_STRINGS_UNICODE_NEON)
+
+inline uint8x16_t CheckBlockNeon(uint8x16_t input, uint8x16_t prev_input) {
+  const uint8x16_t byte_1_high = vld1q_u8(kByte1High);
+  const uint8x16_t byte_1_low = vld1q_u8(kByte1Low);
+  const uint8x16_t byte_2_high = vld1q_u8(kByte2High);
+  const uint8x16_t low_nibble = vdupq_n_u8(0x0F);
+
+  const uint8x16_t prev1 = vextq_u8(prev_input, input, 16 - 1);
+  const uint8x16_t special = vandq_u8(
+      vandq_u8(vqtbl1q_u8(byte_1_high, vshrq_n_u8(prev1, 4)),
+               vqtbl1q_u8(byte_1_low, vandq_u8(prev1, low_nibble))),
+      vqtbl1q_u8(byte_2_high, vshrq_n_u8(input, 4)));
+
+  const uint8x16_t prev2 = vextq_u8(prev_input, input, 16 - 2);
+  const uint8x16_t prev3 = vextq_u8(prev_input, input, 16 - 3);
+  const uint8x16_t is_third = vqsubq_u8(prev2, vdupq_n_u8(0xE0 - 0x80));
+  const uint8x16_t is_fourth = vqsubq_u8(prev3, vdupq_n_u8(0xF0 - 0x80));
+  const uint8x16_t must_be_continuation =
+      vandq_u8(vorrq_u8(is_third, is_fourth), vdupq_n_u8(0x80));
+  return veorq_u8(must_be_continuation, special);
+}
+
+size_t ValidateNeon(const unsigned char* p, size_t n) {
+  const uint8x16_t incomplete_max = vld1q_u8(kIncompleteMax);
+  uint8x16_t prev_input = vdupq_n_u8(0);
+  uint8x16_t prev_incomplete = vdupq_n_u8(0);
+  size_t pos = 0;
+  for (; n - pos >= 64; pos += 64) {
+    uint8x16_t error = vdupq_n_u8(0);
+    for (size_t i = 0; i < 64; i += 16) {
+      const uint8x16_t input = vld1q_u8(p + pos + i);
+      if (vmaxvq_u8(input) < 0x80) {
+        error = vorrq_u8(error, prev_incomplete);
+        prev_incomplete = vdupq_n_u8(0);
+      } else {
+        error = vorrq_u8(error, CheckBlockNeon(input, prev_input));
+        prev_incomplete = vqsubq_u8(input, incomplete_max);
+      }
+      prev_input = input;
+    }
+    if (vmaxvq_u8(error) != 0) break;
+  }
+  return pos == 0 ? 0 : BoundaryBefore(p, pos);
+}
+
+size_t CountContinuationNeon(const unsigned char* p, size_t n,
+                             size_t* consumed) {
+  size_t count = 0;
+  size_t pos = 0;
+  for (; n - pos >= 16; pos += 16) {
+    const uint8x16_t input = vld1q_u8(p + pos);
+    const uint8x16_t is_continuation =
+        vceqq_u8(vandq_u8(input, vdupq_n_u8(0xC0)), vdupq_n_u8(0x80));
+    count += vaddvq_u8(vshrq_n_u8(is_continuation, 7));
+  }
+  *consumed = pos;
+  return count;
+}
+
+#endif
+
+// Returns the end of the longest valid UTF-8 prefix of `p[0, n)`.
+size_t ValidPrefix(const unsigned char* p, size_t n) {
+  size_t start = 0;
+  switch (strings_internal::ActiveSimdLevel()) {
+#if defined(ABSL_INTERNAL_STRINGS_HAVE_X86_DISPATCH)
+    case SimdLevel::kAvx2:
+      start = ValidateAvx2(p, n);
+      break;
+    case SimdLevel::kSsse3:
+      start = ValidateSsse3(p, n);
+      break;
+#elif defined(ABSL_INTERNAL_STRINGS_UNICODE_NEON)
+    case SimdLevel::kNeon:
+      start = ValidateNeon(p, n);
+      break;
+#endif
+    default:
+      break;
+  }
+  return ValidateScalar(p, start, n);
+}
+
+// Returns the number of continuation bytes in `p[0, n)`.
+size_t CountContinuationBytes(const unsigned char* p, size_t n) {
+  size_t count = 0;
+  size_t pos = 0;
+  switch (strings_internal::ActiveSimdLevel()) {
+#if defined(ABSL_INTERNAL_STRINGS_HAVE_X86_DISPATCH)
+    case SimdLevel::kAvx2:
+      count = CountContinuationAvx2(p, n, &pos);
+      break;
+#elif defined(ABSL_INTERNAL_STRINGS_UNICODE_NEON)
+    case SimdLevel::kNeon:
+      count = CountContinuationNeon(p, n, &pos);
+      break;
+#endif
+    default:
+      break;
+  }
+  // Word-at-a-time: a byte is a continuation byte iff its top bits are 10.
+  for (; n - pos >= 8; pos += 8) {
+    uint64_t word;
+    std::memcpy(&word, p + pos, sizeof(word));
+    const uint64_t continuation =
+        word & ~(word << 1) & uint64_t{0x8080808080808080};
+    count += static_cast<size_t>(absl::popcount(continuation));
+  }
+  for (; pos < n; ++pos) count += IsContinuation(p[pos]);
+  return count;
+}
+
+// Decodes all of `p[0, n)` as UTF-8, calling `sink(code_point)` for each code
+// point. Returns false on the first ill-formed sequence.
+template <typename Sink>
+bool DecodeUtf8(const unsigned char* p, size_t n, Sink sink) {
+  size_t pos = 0;
+  while (pos < n) {
+    if (n - pos >= 8 && IsAsciiWord(p + pos)) {
+      for (size_t i = 0; i < 8; ++i) sink(static_cast<char32_t>(p[pos + i]));
+      pos += 8;
+      continue;
+    }
+    char32_t cp;
+    const size_t len = DecodeOne(p + pos, n - pos, &cp);
+    if (ABSL_PREDICT_FALSE(len == 0)) return false;
+    sink(cp);
+    pos += len;
+  }
+  return true;
+}
+
+inline bool IsSurrogate(char32_t c) { return c >= 0xD800 && c <= 0xDFFF; }
+
+}  // namespace
+
+bool IsValidUtf8(absl::string_view str) {
+  return Utf8ValidPrefixLength(str) == str.size();
+}
+
+size_t Utf8ValidPrefixLength(absl::string_view str) {
+  return ValidPrefix(reinterpret_cast<const unsigned char*>(str.data()),
+                     str.size());
+}
+
+size_t CountUtf8CodePoints(absl::string_view str) {
+  return str.size() -
+         CountContinuationBytes(
+             reinterpret_cast<const unsigned char*>(str.data()), str.size());
+}
+
+absl::string_view TruncateUtf8(absl::string_view str, size_t max_bytes) {
+  if (str.size() <= max_bytes) return str;
+  size_t len = max_bytes;
+  // `str[len]` is the first byte dropped; if it continues a sequence, drop the
+  // rest of that sequence too.
+  for (int i = 0; i < 3 && len > 0 &&
+                  IsContinuation(static_cast<unsigned char>(str[len]));
+       ++i) {
+    --len;
+  }
+  if (IsContinuation(static_cast<unsigned char>(str[len]))) len = max_bytes;
+  return str.substr(0, len);
+}
+
+bool Utf16ToUtf8AndAppend(std::u16string_view src,
+                          std::string* absl_nonnull dest) {
+  const size_t orig_size = dest->size();
+  // Every UTF-16 code unit produces at most three bytes.
+  strings_internal::STLStringResizeUninitializedAmortized(
+      dest, orig_size + 3 * src.size());
+  char* const begin = &(*dest)[0] + orig_size;
+  char* out = begin;
+  const size_t n = src.size();
+  size_t i = 0;
+  while (i < n) {
+    // ASCII fast path, four code units at a time.
+    if (n - i >= 4 && ((src[i] | src[i + 1] | src[i + 2] | src[i + 3]) &
+                       0xFF80) == 0) {
+      for (size_t j = 0; j < 4; ++j) out[j] = static_cast<char>(src[i + j]);
+      out += 4;
+      i += 4;
+      continue;
+    }
+    char32_t c = src[i++];
+    if (IsSurrogate(c)) {
+      if (c >= 0xDC00 || i == n || src[i] < 0xDC00 || src[i] > 0xDFFF) {
+        dest->erase(orig_size);
+        return false;
+      }
+      c = 0x10000 + ((c - 0xD800) << 10) + (src[i++] - 0xDC00);
+    }
+    out += strings_internal::EncodeUTF8Char(out, c);
+  }
+  dest->erase(orig_size + static_cast<size_t>(out - begin));
+  return true;
+}
+
+bool Utf32ToUtf8AndAppend(std::u32string_view src,
+                          std::string* absl_nonnull dest) {
+  const size_t orig_size = dest->size();
+  strings_internal::STLStringResizeUninitializedAmortized(
+      dest, orig_size + strings_internal::kMaxEncodedUTF8Size * src.size());
+  char* const begin = &(*dest)[0] + orig_size;
+  char* out = begin;
+  for (char32_t c : src) {
+    if (c < 0x80) {
+      *out++ = static_cast<char>(c);
+      continue;
+    }
+    if (IsSurrogate(c) || c > 0x10FFFF) {
+      dest->erase(orig_size);
+      return false;
+    }
+    out += strings_internal::EncodeUTF8Char(out, c);
+  }
+  dest->erase(orig_size + static_cast<size_t>(out - begin));
+  return true;
+}
+
+bool Utf8ToUtf16AndAppend(absl::string_view src,
+                          std::u16string* absl_nonnull dest) {
+  const size_t orig_size = dest->size();
+  // Every byte produces at most one UTF-16 code unit.
+  strings_internal::STLStringResizeUninitializedAmortized(
+      dest, orig_size + src.size());
+  char16_t* const begin = &(*dest)[0] + orig_size;
+  char16_t* out = begin;
+  const bool ok =
+      DecodeUtf8(reinterpret_cast<const unsigned char*>(src.data()),
+                 src.size(), [&out](char32_t c) {
+                   if (c < 0x10000) {
+                     *out++ = static_cast<char16_t>(c);
+                   } else {
+                     c -= 0x10000;
+                     *out++ = static_cast<char16_t>(0xD800 + (c >> 10));
+                     *out++ = static_cast<char16_t>(0xDC00 + (c & 0x3FF));
+                   }
+                 });
+  dest->erase(ok ? orig_size + static_cast<size_t>(out - begin) : orig_size);
+  return ok;
+}
+
+bool Utf8ToUtf32AndAppend(absl::string_view src,
+                          std::u32string* absl_nonnull dest) {
+  const size_t orig_size = dest->size();
+  strings_internal::STLStringResizeUninitializedAmortized(
+      dest, orig_size + src.size());
+  char32_t* const begin = &(*dest)[0] + orig_size;
+  char32_t* out = begin;
+  const bool ok =
+      DecodeUtf8(reinterpret_cast<const unsigned char*>(src.data()),
+                 src.size(), [&out](char32_t c) { *out++ = c; });
+  dest->erase(ok ? orig_size + static_cast<size_t>(out - begin) : orig_size);
+  return ok;
+}
+
+ABSL_NAMESPACE_END
+}  // namespace absl
@@ -0,0 +1,113 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// -----------------------------------------------------------------------------
+// File: unicode.h
+// -----------------------------------------------------------------------------
+//
+// This header file contains functions for validating, measuring, truncating
+// and transcoding UTF-8 encoded strings.
+//
+// Validation follows RFC 3629: overlong encodings, UTF-16 surrogate code points
+// (U+D800 through U+DFFF), code points above U+10FFFF and truncated sequences
+// are all rejected. Validation and code point counting use vector
+// instructions (SSSE3/AVX2 on x86, selected at runtime, or NEON on AArch64)
+// when available, and a word-at-a-time scalar fallback otherwise, so that
+// validating mostly-ASCII input costs a small fraction of a cycle per byte.
+//
+// Example:
+//
+//   if (!absl::IsValidUtf8(request.body())) {
+//     return absl::InvalidArgumentError("body is not UTF-8");
+//   }
+//   absl::string_view preview = absl::TruncateUtf8(request.body(), 80);
+
+#ifndef ABSL_STRINGS_UNICODE_H_
+#define ABSL_STRINGS_UNICODE_H_
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+#include "absl/base/config.h"
+#include "absl/base/nullability.h"
+#include "absl/strings/string_view.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+// IsValidUtf8()
+//
+// Returns whether `str` is well-formed UTF-8.
+bool IsValidUtf8(absl::string_view str);
+
+// Utf8ValidPrefixLength()
+//
+// Returns the length of the longest prefix of `str` that is well-formed UTF-8.
+// The result equals `str.size()` if and only if `str` is valid, and otherwise
+// is the offset of the first ill-formed (or truncated) sequence.
+size_t Utf8ValidPrefixLength(absl::string_view str);
+
+// CountUtf8CodePoints()
+//
+// Returns the number of code points in `str`, which must be valid UTF-8.
+// For ill-formed input, returns the number of bytes that are not UTF-8
+// continuation bytes.
+size_t CountUtf8CodePoints(absl::string_view str);
+
+// TruncateUtf8()
+//
+// Returns the longest prefix of `str` that is at most `max_bytes` long and
+// does not end in the middle of a multi-byte sequence. At most three bytes
+// below `max_bytes` are dropped, even when `str` is not valid UTF-8.
+//
+// Example:
+//
+//   // "\xc3\xa9" is U+00E9 (LATIN SMALL LETTER E WITH ACUTE).
+//   absl::TruncateUtf8("caf\xc3\xa9", 4);  // Returns "caf"
+absl::string_view TruncateUtf8(absl::string_view str, size_t max_bytes);
+
+// Utf16ToUtf8AndAppend()
+//
+// Appends the UTF-8 encoding of the UTF-16 string `src` to `dest`. Returns
+// `false` and leaves `dest` unchanged if `src` contains an unpaired surrogate.
+bool Utf16ToUtf8AndAppend(std::u16string_view src,
+                          std::string* absl_nonnull dest);
+
+// Utf32ToUtf8AndAppend()
+//
+// Appends the UTF-8 encoding of the UTF-32 string `src` to `dest`. Returns
+// `false` and leaves `dest` unchanged if `src` contains a surrogate code point
+// or a value above U+10FFFF.
+bool Utf32ToUtf8AndAppend(std::u32string_view src,
+                          std::string* absl_nonnull dest);
+
+// Utf8ToUtf16AndAppend()
+//
+// Appends the UTF-16 encoding of the UTF-8 string `src` to `dest`. Returns
+// `false` and leaves `dest` unchanged if `src` is not valid UTF-8.
+bool Utf8ToUtf16AndAppend(absl::string_view src,
+                          std::u16string* absl_nonnull dest);
+
+// Utf8ToUtf32AndAppend()
+//
+// Appends the code points of the UTF-8 string `src` to `dest`. Returns `false`
+// and leaves `dest` unchanged if `src` is not valid UTF-8.
+bool Utf8ToUtf32AndAppend(absl::string_view src,
+                          std::u32string* absl_nonnull dest);
+
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_STRINGS_UNICODE_H_
@@ -0,0 +1,118 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+
+#include "absl/profiling/benchmark.h"
+#include "absl/strings/internal/utf8.h"
+#include "absl/strings/unicode.h"
+
+namespace {
+
+enum Corpus { kAscii, kMostlyAscii, kCjk, kMixed };
+
+// Returns roughly `size` bytes of valid UTF-8 whose code points are drawn
+// from a distribution resembling `corpus`.
+std::string MakeCorpus(Corpus corpus, size_t size) {
+  std::minstd_rand rng(static_cast<uint32_t>(corpus));
+  std::string s;
+  char buf[absl::strings_internal::kMaxEncodedUTF8Size];
+  while (s.size() < size) {
+    char32_t c;
+    const uint32_t r = rng() % 100;
+    switch (corpus) {
+      case kAscii:
+        c = 0x20 + rng() % 0x5F;
+        break;
+      case kMostlyAscii:
+        c = r < 97 ? 0x20 + rng() % 0x5F : 0xC0 + rng() % 0x100;
+        break;
+      case kCjk:
+        c = r < 10 ? 0x20 + rng() % 0x5F : 0x4E00 + rng() % 0x5000;
+        break;
+      case kMixed:
+      default:
+        c = r < 40   ? 0x20 + rng() % 0x5F
+            : r < 70 ? 0x400 + rng() % 0x100
+            : r < 90 ? 0x4E00 + rng() % 0x5000
+                     : 0x1F600 + rng() % 0x50;
+        break;
+    }
+    s.append(buf, absl::strings_internal::EncodeUTF8Char(buf, c));
+  }
+  return s;
+}
+
+void BM_IsValidUtf8(benchmark::State& state) {
+  const std::string s =
+      MakeCorpus(static_cast<Corpus>(state.range(0)), state.range(1));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(s);
+    benchmark::DoNotOptimize(absl::IsValidUtf8(s));
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(s.size()));
+}
+BENCHMARK(BM_IsValidUtf8)
+    ->ArgsProduct({{kAscii, kMostlyAscii, kCjk, kMixed}, {64, 4096, 1 << 20}});
+
+void BM_CountUtf8CodePoints(benchmark::State& state) {
+  const std::string s =
+      MakeCorpus(static_cast<Corpus>(state.range(0)), state.range(1));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(s);
+    benchmark::DoNotOptimize(absl::CountUtf8CodePoints(s));
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(s.size()));
+}
+BENCHMARK(BM_CountUtf8CodePoints)
+    ->ArgsProduct({{kAscii, kMostlyAscii, kCjk, kMixed}, {64, 4096, 1 << 20}});
+
+void BM_Utf8ToUtf16(benchmark::State& state) {
+  const std::string s =
+      MakeCorpus(static_cast<Corpus>(state.range(0)), state.range(1));
+  std::u16string out;
+  for (auto _ : state) {
+    out.clear();
+    benchmark::DoNotOptimize(absl::Utf8ToUtf16AndAppend(s, &out));
+    benchmark::DoNotOptimize(out);
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(s.size()));
+}
+BENCHMARK(BM_Utf8ToUtf16)
+    ->ArgsProduct({{kAscii, kMostlyAscii, kCjk, kMixed}, {4096, 1 << 20}});
+
+void BM_Utf16ToUtf8(benchmark::State& state) {
+  const std::string s =
+      MakeCorpus(static_cast<Corpus>(state.range(0)), state.range(1));
+  std::u16string utf16;
+  absl::Utf8ToUtf16AndAppend(s, &utf16);
+  std::string out;
+  for (auto _ : state) {
+    out.clear();
+    benchmark::DoNotOptimize(absl::Utf16ToUtf8AndAppend(utf16, &out));
+    benchmark::DoNotOptimize(out);
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(s.size()));
+}
+BENCHMARK(BM_Utf16ToUtf8)
+    ->ArgsProduct({{kAscii, kMostlyAscii, kCjk, kMixed}, {4096, 1 << 20}});
+
+}  // namespace
@@ -0,0 +1,305 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/strings/unicode.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "absl/strings/escaping.h"
+#include "absl/strings/internal/simd_dispatch_test_util.h"
+#include "absl/strings/internal/utf8.h"
+#include "absl/strings/string_view.h"
+
+namespace {
+
+using absl::strings_internal::ForEachSimdLevel;
+
+// A straightforward reference implementation: decodes sequences one at a time
+// and checks the decoded value rather than byte ranges.
+size_t ReferenceValidPrefix(absl::string_view s) {
+  size_t pos = 0;
+  while (pos < s.size()) {
+    const unsigned char c = static_cast<unsigned char>(s[pos]);
+    size_t len;
+    char32_t min;
+    if (c < 0x80) {
+      ++pos;
+      continue;
+    } else if ((c & 0xE0) == 0xC0) {
+      len = 2;
+      min = 0x80;
+    } else if ((c & 0xF0) == 0xE0) {
+      len = 3;
+      min = 0x800;
+    } else if ((c & 0xF8) == 0xF0) {
+      len = 4;
+      min = 0x10000;
+    } else {
+      return pos;
+    }
+    if (s.size() - pos < len) return pos;
+    char32_t v = c & (0x7F >> len);
+    for (size_t i = 1; i < len; ++i) {
+      const unsigned char cc = static_cast<unsigned char>(s[pos + i]);
+      if ((cc & 0xC0) != 0x80) return pos;
+      v = (v << 6) | (cc & 0x3F);
+    }
+    if (v < min || v > 0x10FFFF || (v >= 0xD800 && v <= 0xDFFF)) return pos;
+    pos += len;
+  }
+  return pos;
+}
+
+std::string Encode(char32_t c) {
+  char buf[absl::strings_internal::kMaxEncodedUTF8Size];
+  return std::string(buf, absl::strings_internal::EncodeUTF8Char(buf, c));
+}
+
+// Returns `size` bytes of valid UTF-8 mixing ASCII with 2-, 3- and 4-byte
+// sequences.
+std::string RandomUtf8(std::minstd_rand& rng, size_t size) {
+  std::string s;
+  while (s.size() < size) {
+    char32_t c;
+    switch (rng() % 4) {
+      case 0:
+        c = rng() % 0x80;
+        break;
+      case 1:
+        c = 0x80 + rng() % (0x800 - 0x80);
+        break;
+      case 2:
+        c = 0x800 + rng() % (0x10000 - 0x800);
+        if (c >= 0xD800 && c <= 0xDFFF) c -= 0x800;
+        break;
+      default:
+        c = 0x10000 + rng() % (0x110000 - 0x10000);
+        break;
+    }
+    s += Encode(c);
+  }
+  return s;
+}
+
+TEST(Utf8Validation, KnownCases) {
+  struct {
+    absl::string_view input;
+    size_t valid_prefix;
+  } cases[] = {
+      {"", 0},
+      {"hello", 5},
+      {"caf\xc3\xa9", 5},
+      {"\xe6\x97\xa5\xe6\x9c\xac", 6},
+      {"\xf0\x9f\x98\x80", 4},
+      {"\xef\xbf\xbf", 3},            // U+FFFF
+      {"\xf4\x8f\xbf\xbf", 4},        // U+10FFFF
+      {"a\x80", 1},                   // stray continuation
+      {"a\xc3", 1},                   // truncated
+      {"\xc0\xaf", 0},                // overlong '/'
+      {"\xc1\xbf", 0},                // overlong
+      {"\xe0\x80\xaf", 0},            // overlong
+      {"\xe0\x9f\xbf", 0},            // overlong
+      {"\xf0\x8f\xbf\xbf", 0},        // overlong
+      {"\xed\xa0\x80", 0},            // surrogate U+D800
+      {"\xed\xbf\xbf", 0},            // surrogate U+DFFF
+      {"\xed\x9f\xbf", 3},            // U+D7FF
+      {"\xf4\x90\x80\x80", 0},        // U+110000
+      {"\xf5\x80\x80\x80", 0},        // invalid lead
+      {"\xff", 0},
+      {"ab\xe2\x82", 2},              // truncated 3-byte
+      {"\xf0\x9f\x98\x80\x80", 4},    // extra continuation
+  };
+  ForEachSimdLevel([&] {
+    for (const auto& tc : cases) {
+      EXPECT_EQ(absl::Utf8ValidPrefixLength(tc.input), tc.valid_prefix)
+          << absl::CHexEscape(tc.input);
+      EXPECT_EQ(absl::IsValidUtf8(tc.input),
+                tc.valid_prefix == tc.input.size());
+    }
+  });
+}
+
+TEST(Utf8Validation, AllTwoByteAndThreeByteLeadsAtEveryOffset) {
+  // Embeds every non-ASCII lead byte followed by every second byte and a few
+  // interesting third bytes at offsets that straddle vector block and chunk
+  // boundaries in a long valid buffer.
+  std::minstd_rand rng(17);
+  const std::string filler = RandomUtf8(rng, 300);
+  ForEachSimdLevel([&] {
+    for (size_t offset : {0, 31, 62, 63, 64, 127}) {
+      std::string prefix = filler.substr(0, offset);
+      prefix = prefix.substr(0, ReferenceValidPrefix(prefix));
+      // Make sure the prefix ends on a code point boundary.
+      while (!prefix.empty() &&
+             ReferenceValidPrefix(prefix) != prefix.size()) {
+        prefix.pop_back();
+      }
+      for (int a = 0; a < 256; ++a) {
+        for (int b = 0; b < 256; b += (a < 0xC0 ? 17 : 1)) {
+          for (int c : {0x41, 0x80, 0xA0, 0xBF, 0xC3}) {
+            std::string s = prefix;
+            s += static_cast<char>(a);
+            s += static_cast<char>(b);
+            s += static_cast<char>(c);
+            s += "\x80\x80";
+            s += std::string(100, 'x');
+            ASSERT_EQ(absl::Utf8ValidPrefixLength(s), ReferenceValidPrefix(s))
+                << offset << " " << a << " " << b << " " << c;
+          }
+        }
+      }
+    }
+  });
+}
+
+TEST(Utf8Validation, RandomCorruption) {
+  std::minstd_rand rng(42);
+  ForEachSimdLevel([&] {
+    for (int iter = 0; iter < 2000; ++iter) {
+      std::string s = RandomUtf8(rng, rng() % 600);
+      ASSERT_TRUE(absl::IsValidUtf8(s));
+      const int corruptions = static_cast<int>(rng() % 3);
+      for (int i = 0; i < corruptions && !s.empty(); ++i) {
+        s[rng() % s.size()] = static_cast<char>(rng());
+      }
+      ASSERT_EQ(absl::Utf8ValidPrefixLength(s), ReferenceValidPrefix(s));
+    }
+  });
+}
+
+TEST(Utf8Validation, TruncatedAtEndOfLongInput) {
+  ForEachSimdLevel([&] {
+    for (size_t size = 60; size < 200; ++size) {
+      for (absl::string_view tail :
+           {"\xc3", "\xe6\x97", "\xf0\x9f\x98", "\xf0\x9f"}) {
+        std::string s(size, 'a');
+        s += tail;
+        EXPECT_EQ(absl::Utf8ValidPrefixLength(s), size);
+        // Followed by ASCII, the sequence is too short.
+        s += std::string(80, 'b');
+        EXPECT_EQ(absl::Utf8ValidPrefixLength(s), size);
+      }
+    }
+  });
+}
+
+TEST(CountUtf8CodePoints, Basic) {
+  std::minstd_rand rng(7);
+  ForEachSimdLevel([&] {
+    EXPECT_EQ(absl::CountUtf8CodePoints(""), 0u);
+    EXPECT_EQ(absl::CountUtf8CodePoints("abc"), 3u);
+    EXPECT_EQ(absl::CountUtf8CodePoints("caf\xc3\xa9"), 4u);
+    EXPECT_EQ(absl::CountUtf8CodePoints("\xf0\x9f\x98\x80!"), 2u);
+    for (int iter = 0; iter < 200; ++iter) {
+      const std::string s = RandomUtf8(rng, rng() % 500);
+      std::u32string utf32;
+      ASSERT_TRUE(absl::Utf8ToUtf32AndAppend(s, &utf32));
+      EXPECT_EQ(absl::CountUtf8CodePoints(s), utf32.size());
+    }
+  });
+}
+
+TEST(TruncateUtf8, Boundaries) {
+  const absl::string_view s = "a\xc3\xa9\xe6\x97\xa5\xf0\x9f\x98\x80";
+  EXPECT_EQ(absl::TruncateUtf8(s, 100), s);
+  EXPECT_EQ(absl::TruncateUtf8(s, s.size()), s);
+  EXPECT_EQ(absl::TruncateUtf8(s, 0), "");
+  EXPECT_EQ(absl::TruncateUtf8(s, 1), "a");
+  EXPECT_EQ(absl::TruncateUtf8(s, 2), "a");
+  EXPECT_EQ(absl::TruncateUtf8(s, 3), "a\xc3\xa9");
+  EXPECT_EQ(absl::TruncateUtf8(s, 4), "a\xc3\xa9");
+  EXPECT_EQ(absl::TruncateUtf8(s, 5), "a\xc3\xa9");
+  EXPECT_EQ(absl::TruncateUtf8(s, 6), "a\xc3\xa9\xe6\x97\xa5");
+  EXPECT_EQ(absl::TruncateUtf8(s, 9), "a\xc3\xa9\xe6\x97\xa5");
+  // Never drops more than three bytes of ill-formed input.
+  EXPECT_EQ(absl::TruncateUtf8("\x80\x80\x80\x80\x80\x80", 5),
+            "\x80\x80\x80\x80\x80");
+
+  std::minstd_rand rng(3);
+  for (int iter = 0; iter < 200; ++iter) {
+    const std::string str = RandomUtf8(rng, 64);
+    const size_t max = rng() % 70;
+    const absl::string_view t = absl::TruncateUtf8(str, max);
+    EXPECT_LE(t.size(), max);
+    EXPECT_GE(t.size() + 3, std::min(max, str.size()));
+    EXPECT_TRUE(absl::IsValidUtf8(t));
+  }
+}
+
+TEST(Transcoding, RoundTrip) {
+  std::minstd_rand rng(11);
+  for (int iter = 0; iter < 200; ++iter) {
+    const std::string s = RandomUtf8(rng, rng() % 300);
+    std::u16string utf16 = u"prefix";
+    ASSERT_TRUE(absl::Utf8ToUtf16AndAppend(s, &utf16));
+    std::u32string utf32 = U"prefix";
+    ASSERT_TRUE(absl::Utf8ToUtf32AndAppend(s, &utf32));
+
+    std::string from16 = "prefix";
+    ASSERT_TRUE(absl::Utf16ToUtf8AndAppend(
+        std::u16string_view(utf16).substr(6), &from16));
+    EXPECT_EQ(from16, "prefix" + s);
+    std::string from32 = "prefix";
+    ASSERT_TRUE(absl::Utf32ToUtf8AndAppend(
+        std::u32string_view(utf32).substr(6), &from32));
+    EXPECT_EQ(from32, "prefix" + s);
+  }
+}
+
+TEST(Transcoding, KnownValues) {
+  std::u16string utf16;
+  EXPECT_TRUE(absl::Utf8ToUtf16AndAppend("a\xc3\xa9\xf0\x9f\x98\x80", &utf16));
+  EXPECT_EQ(utf16, u"aé\U0001F600");
+  std::u32string utf32;
+  EXPECT_TRUE(absl::Utf8ToUtf32AndAppend("a\xc3\xa9\xf0\x9f\x98\x80", &utf32));
+  EXPECT_EQ(utf32, U"aé\U0001F600");
+  std::string utf8;
+  EXPECT_TRUE(absl::Utf16ToUtf8AndAppend(u"日本", &utf8));
+  EXPECT_EQ(utf8, "\xe6\x97\xa5\xe6\x9c\xac");
+}
+
+TEST(Transcoding, Errors) {
+  std::u16string utf16 = u"keep";
+  EXPECT_FALSE(absl::Utf8ToUtf16AndAppend("abc\xc3", &utf16));
+  EXPECT_FALSE(absl::Utf8ToUtf16AndAppend("\xed\xa0\x80", &utf16));
+  EXPECT_EQ(utf16, u"keep");
+
+  std::u32string utf32 = U"keep";
+  EXPECT_FALSE(absl::Utf8ToUtf32AndAppend("\xc0\x80", &utf32));
+  EXPECT_EQ(utf32, U"keep");
+
+  std::string utf8 = "keep";
+  const char16_t lone_high[] = {u'a', 0xD800, u'b'};
+  const char16_t lone_low[] = {0xDC00};
+  const char16_t high_at_end[] = {u'a', 0xD83D};
+  EXPECT_FALSE(absl::Utf16ToUtf8AndAppend(std::u16string_view(lone_high, 3),
+                                          &utf8));
+  EXPECT_FALSE(
+      absl::Utf16ToUtf8AndAppend(std::u16string_view(lone_low, 1), &utf8));
+  EXPECT_FALSE(absl::Utf16ToUtf8AndAppend(std::u16string_view(high_at_end, 2),
+                                          &utf8));
+  const char32_t surrogate[] = {0xD800};
+  const char32_t too_large[] = {0x110000};
+  EXPECT_FALSE(
+      absl::Utf32ToUtf8AndAppend(std::u32string_view(surrogate, 1), &utf8));
+  EXPECT_FALSE(
+      absl::Utf32ToUtf8AndAppend(std::u32string_view(too_large, 1), &utf8));
+  EXPECT_EQ(utf8, "keep");
+}
+
+}  // namespace
@@ -15,13 +15,62 @@
 #include "absl/synchronization/blocking_counter.h"
 
 #include <atomic>
+#include <cerrno>
+#include <cstdint>
 
 #include "absl/base/internal/raw_logging.h"
 #include "absl/base/internal/tracing.h"
+#include "absl/synchronization/internal/futex.h"
 
 namespace absl {
 ABSL_NAMESPACE_BEGIN
 
+#ifdef ABSL_INTERNAL_HAVE_FUTEX
+
+BlockingCounter::BlockingCounter(int initial_count)
+    : count_(initial_count), state_(initial_count == 0 ? kDone : 0) {
+  ABSL_RAW_CHECK(initial_count >= 0, "BlockingCounter initial_count negative");
+}
+
+bool BlockingCounter::DecrementCount() {
+  int count = count_.fetch_sub(1, std::memory_order_acq_rel) - 1;
+  ABSL_RAW_CHECK(count >= 0,
+                 "BlockingCounter::DecrementCount() called too many times");
+  if (count == 0) {
+    base_internal::TraceSignal(this, TraceObjectKind());
+    // The waiter may return, and destroy the counter, as soon as kDone is set.
+    // That leaves the futex wake below to an address that may have been
+    // reused, which only costs a spurious wakeup to any futex now there: a
+    // private FUTEX_WAKE does not access the memory.
+    if (state_.fetch_or(kDone, std::memory_order_release) & kWaiting) {
+      synchronization_internal::Futex::Wake(&state_, 1);
+    }
+    return true;
+  }
+  return false;
+}
+
+void BlockingCounter::Wait() {
+  base_internal::TraceWait(this, TraceObjectKind());
+  int32_t state = state_.fetch_or(kWaiting, std::memory_order_acquire);
+
+  // only one thread may call Wait(). To support more than one thread,
+  // implement a counter num_to_exit, like in the Barrier class.
+  ABSL_RAW_CHECK((state & kWaiting) == 0, "multiple threads called Wait()");
+  state |= kWaiting;
+
+  while ((state & kDone) == 0) {
+    const int err = synchronization_internal::Futex::Wait(&state_, state);
+    if (err != 0 && err != -EINTR && err != -EWOULDBLOCK) {
+      ABSL_RAW_LOG(FATAL, "Futex operation failed with error %d\n", err);
+    }
+    state = state_.load(std::memory_order_acquire);
+  }
+  base_internal::TraceContinue(this, TraceObjectKind());
+}
+
+#else  // ABSL_INTERNAL_HAVE_FUTEX
+
 namespace {
 
 // Return whether int *arg is true.
@@ -69,5 +118,7 @@ void BlockingCounter::Wait() {
   base_internal::TraceContinue(this, TraceObjectKind());
 }
 
+#endif  // ABSL_INTERNAL_HAVE_FUTEX
+
 ABSL_NAMESPACE_END
 }  // namespace absl
@@ -21,9 +21,11 @@
 #define ABSL_SYNCHRONIZATION_BLOCKING_COUNTER_H_
 
 #include <atomic>
+#include <cstdint>
 
 #include "absl/base/internal/tracing.h"
 #include "absl/base/thread_annotations.h"
+#include "absl/synchronization/internal/futex_word.h"
 #include "absl/synchronization/mutex.h"
 
 namespace absl {
@@ -95,10 +97,21 @@ class BlockingCounter {
     return base_internal::ObjectKind::kBlockingCounter;
   }
 
-  Mutex lock_;
   std::atomic<int> count_;
+#ifdef ABSL_INTERNAL_HAVE_FUTEX_WORD
+  // Where futexes are available, the waiter sleeps on a futex word, with the
+  // following bits, rather than on a `Mutex`.
+  static constexpr int32_t kDone = synchronization_internal::kFutexWordDone;
+  // `Wait()` has been called.
+  static constexpr int32_t kWaiting =
+      synchronization_internal::kFutexWordWaiters;
+
+  synchronization_internal::FutexWord state_;
+#else
+  Mutex lock_;
   int num_waiting_ ABSL_GUARDED_BY(lock_);
   bool done_ ABSL_GUARDED_BY(lock_);
+#endif  // ABSL_INTERNAL_HAVE_FUTEX_WORD
 };
 
 ABSL_NAMESPACE_END
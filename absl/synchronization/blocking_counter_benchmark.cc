@@ -18,6 +18,7 @@
 #include "absl/base/no_destructor.h"
 #include "absl/synchronization/blocking_counter.h"
 #include "absl/synchronization/internal/thread_pool.h"
+#include "absl/synchronization/notification.h"
 
 namespace {
 
@@ -79,6 +80,32 @@ BENCHMARK(BM_BlockingCounter_Wait)
     ->Arg(16)
     ->Arg(32)
     ->Arg(64)
-    ->Arg(128);
+    ->Arg(128)
+    ->Arg(256);
+
+// Fan-in: `threads` workers, all released at once, each decrement the counter
+// while the waiter is already asleep in `Wait()`.
+void BM_BlockingCounter_FanIn(benchmark::State& state) {
+  const int num_threads = static_cast<int>(state.range(0));
+  absl::synchronization_internal::ThreadPool pool(num_threads);
+  for (auto _ : state) {
+    absl::Notification start;
+    absl::BlockingCounter counter{num_threads};
+    for (int i = 0; i < num_threads; ++i) {
+      pool.Schedule([&start, &counter]() {
+        start.WaitForNotification();
+        counter.DecrementCount();
+      });
+    }
+    start.Notify();
+    counter.Wait();
+  }
+}
+BENCHMARK(BM_BlockingCounter_FanIn)
+    ->ArgName("threads")
+    ->Arg(64)
+    ->Arg(128)
+    ->Arg(256)
+    ->UseRealTime();
 
 }  // namespace
@@ -0,0 +1,200 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// -----------------------------------------------------------------------------
+// bounded_queue.h
+// -----------------------------------------------------------------------------
+//
+// This header file defines `absl::BoundedQueue<T>`, a fixed-capacity FIFO
+// queue that any number of threads may push to and pop from concurrently
+// without locks, for passing work between the stages of a pipeline.
+//
+// Example:
+//
+//   absl::BoundedQueue<Request> queue(1024);
+//
+//   // Producers:
+//   queue.Push(std::move(request));  // Blocks while the queue is full.
+//
+//   // Consumers:
+//   Request request = queue.Pop();  // Blocks while the queue is empty.
+//
+// For a single producer and a single consumer, `absl::SpscRingBuffer<T>` in
+// spsc_ring_buffer.h is cheaper.
+
+#ifndef ABSL_SYNCHRONIZATION_BOUNDED_QUEUE_H_
+#define ABSL_SYNCHRONIZATION_BOUNDED_QUEUE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+
+#include "absl/base/config.h"
+#include "absl/base/optimization.h"
+#include "absl/numeric/bits.h"
+#include "absl/synchronization/internal/parking_list.h"
+#include "absl/types/optional.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+// BoundedQueue
+//
+// A bounded multi-producer multi-consumer FIFO queue, after Dmitry Vyukov's
+// design: each slot carries a sequence number that tells producers and
+// consumers whether it is free for the current lap around the ring, so that
+// pushing or popping costs a single compare-and-swap on the queue's position
+// and no lock. Each slot occupies its own cache lines, so that threads
+// working on neighboring slots do not contend.
+//
+// `TryPush()` and `TryPop()` never block. `Push()` and `Pop()` park the
+// calling thread on its semaphore while the queue is full or empty, and cost
+// the same as the non-blocking operations otherwise.
+//
+// `T` must be move-constructible, and its move constructor must not throw.
+template <typename T>
+class BoundedQueue {
+ public:
+  // Creates an empty queue that holds up to `capacity` elements, rounded up
+  // to a power of two no less than 2.
+  explicit BoundedQueue(size_t capacity)
+      : mask_(absl::bit_ceil(capacity < 2 ? size_t{2} : capacity) - 1),
+        slots_(new Slot[mask_ + 1]) {
+    for (size_t i = 0; i <= mask_; ++i) {
+      slots_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  BoundedQueue(const BoundedQueue&) = delete;
+  BoundedQueue& operator=(const BoundedQueue&) = delete;
+
+  // Destroys the elements left in the queue. No thread may be using it.
+  ~BoundedQueue() {
+    const size_t end = enqueue_pos_.load(std::memory_order_relaxed);
+    for (size_t pos = dequeue_pos_.load(std::memory_order_relaxed); pos != end;
+         ++pos) {
+      slots_[pos & mask_].value()->~T();
+    }
+  }
+
+  // BoundedQueue::TryPush()
+  // BoundedQueue::TryEmplace()
+  //
+  // Adds an element at the back of the queue and returns true, or returns
+  // false if the queue is full, in which case `value` is left unchanged.
+  bool TryPush(T&& value) { return TryEmplace(std::move(value)); }
+  bool TryPush(const T& value) { return TryEmplace(value); }
+  template <typename... Args>
+  bool TryEmplace(Args&&... args) {
+    size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+    while (true) {
+      Slot& slot = slots_[pos & mask_];
+      const size_t seq = slot.sequence.load(std::memory_order_acquire);
+      const intptr_t diff =
+          static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+      if (diff == 0) {
+        if (enqueue_pos_.compare_exchange_weak(pos, pos + 1,
+                                               std::memory_order_relaxed)) {
+          ::new (static_cast<void*>(slot.storage))
+              T(std::forward<Args>(args)...);
+          slot.sequence.store(pos + 1, std::memory_order_release);
+          not_empty_.WakeOne();
+          return true;
+        }
+      } else if (diff < 0) {
+        return false;  // Full.
+      } else {
+        pos = enqueue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  // BoundedQueue::Push()
+  //
+  // Adds `value` at the back of the queue, waiting while the queue is full.
+  void Push(T value) {
+    not_full_.ParkUntil([&] { return TryPush(std::move(value)); });
+  }
+
+  // BoundedQueue::TryPop()
+  //
+  // Removes and returns the element at the front of the queue, or returns
+  // `absl::nullopt` if the queue is empty.
+  absl::optional<T> TryPop() {
+    absl::optional<T> value;
+    TryPopInto(&value);
+    return value;
+  }
+
+  // BoundedQueue::Pop()
+  //
+  // Removes and returns the element at the front of the queue, waiting while
+  // the queue is empty.
+  T Pop() {
+    absl::optional<T> value;
+    not_empty_.ParkUntil([&] { return TryPopInto(&value); });
+    return *std::move(value);
+  }
+
+  // Returns the maximum number of elements in the queue.
+  size_t capacity() const { return mask_ + 1; }
+
+ private:
+  struct ABSL_CACHELINE_ALIGNED Slot {
+    T* value() { return std::launder(reinterpret_cast<T*>(storage)); }
+
+    std::atomic<size_t> sequence;
+    alignas(T) unsigned char storage[sizeof(T)];
+  };
+
+  bool TryPopInto(absl::optional<T>* value) {
+    size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+    while (true) {
+      Slot& slot = slots_[pos & mask_];
+      const size_t seq = slot.sequence.load(std::memory_order_acquire);
+      const intptr_t diff =
+          static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+      if (diff == 0) {
+        if (dequeue_pos_.compare_exchange_weak(pos, pos + 1,
+                                               std::memory_order_relaxed)) {
+          value->emplace(std::move(*slot.value()));
+          slot.value()->~T();
+          slot.sequence.store(pos + mask_ + 1, std::memory_order_release);
+          not_full_.WakeOne();
+          return true;
+        }
+      } else if (diff < 0) {
+        return false;  // Empty.
+      } else {
+        pos = dequeue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  const size_t mask_;
+  std::unique_ptr<Slot[]> slots_;
+  alignas(ABSL_CACHELINE_SIZE) std::atomic<size_t> enqueue_pos_{0};
+  alignas(ABSL_CACHELINE_SIZE) std::atomic<size_t> dequeue_pos_{0};
+  // Consumers waiting for an element, and producers waiting for room.
+  alignas(ABSL_CACHELINE_SIZE) synchronization_internal::ParkingList not_empty_;
+  alignas(ABSL_CACHELINE_SIZE) synchronization_internal::ParkingList not_full_;
+};
+
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_SYNCHRONIZATION_BOUNDED_QUEUE_H_
@@ -0,0 +1,131 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Compares `absl::BoundedQueue` and `absl::SpscRingBuffer` with the
+// `absl::Mutex` + `std::deque` + `absl::CondVar` queue that they replace.
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <thread>  // NOLINT(build/c++11)
+#include <vector>
+
+#include "absl/profiling/benchmark.h"
+#include "absl/synchronization/bounded_queue.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/synchronization/spsc_ring_buffer.h"
+
+namespace {
+
+constexpr size_t kCapacity = 1024;
+
+// A bounded queue guarded by a `Mutex`, with the interface of the lock-free
+// queues.
+template <typename T>
+class MutexDequeQueue {
+ public:
+  explicit MutexDequeQueue(size_t capacity) : capacity_(capacity) {}
+
+  void Push(T value) {
+    absl::MutexLock lock(&mu_);
+    while (queue_.size() >= capacity_) not_full_.Wait(&mu_);
+    queue_.push_back(std::move(value));
+    not_empty_.Signal();
+  }
+
+  T Pop() {
+    absl::MutexLock lock(&mu_);
+    while (queue_.empty()) not_empty_.Wait(&mu_);
+    T value = std::move(queue_.front());
+    queue_.pop_front();
+    not_full_.Signal();
+    return value;
+  }
+
+ private:
+  const size_t capacity_;
+  absl::Mutex mu_;
+  absl::CondVar not_empty_;
+  absl::CondVar not_full_;
+  std::deque<T> queue_ ABSL_GUARDED_BY(mu_);
+};
+
+// Throughput: each iteration moves `kItems` items from `state.range(0)`
+// producer threads to `state.range(1)` consumer threads.
+template <typename Queue>
+void BM_Throughput(benchmark::State& state) {
+  constexpr int64_t kItems = 1 << 16;
+  const int producers = static_cast<int>(state.range(0));
+  const int consumers = static_cast<int>(state.range(1));
+  for (auto _ : state) {
+    Queue queue(kCapacity);
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+      threads.emplace_back([&queue, producers] {
+        for (int64_t i = 0; i < kItems / producers; ++i) queue.Push(i);
+      });
+    }
+    for (int c = 0; c < consumers; ++c) {
+      threads.emplace_back([&queue, consumers] {
+        int64_t sum = 0;
+        for (int64_t i = 0; i < kItems / consumers; ++i) sum += queue.Pop();
+        benchmark::DoNotOptimize(sum);
+      });
+    }
+    for (std::thread& thread : threads) thread.join();
+  }
+  state.SetItemsProcessed(state.iterations() * kItems);
+}
+
+void ThroughputArgs(benchmark::internal::Benchmark* bm) {
+  bm->ArgNames({"producers", "consumers"})->UseRealTime();
+  for (int producers : {1, 4, 16}) {
+    for (int consumers : {1, 4, 16}) bm->Args({producers, consumers});
+  }
+}
+
+BENCHMARK_TEMPLATE(BM_Throughput, absl::BoundedQueue<int64_t>)
+    ->Apply(ThroughputArgs);
+BENCHMARK_TEMPLATE(BM_Throughput, MutexDequeQueue<int64_t>)
+    ->Apply(ThroughputArgs);
+BENCHMARK_TEMPLATE(BM_Throughput, absl::SpscRingBuffer<int64_t>)
+    ->ArgNames({"producers", "consumers"})
+    ->Args({1, 1})
+    ->UseRealTime();
+
+// Latency: each iteration is a round trip of one item to an echo thread and
+// back.
+template <typename Queue>
+void BM_RoundTrip(benchmark::State& state) {
+  Queue requests(kCapacity);
+  Queue replies(kCapacity);
+  std::thread echo([&] {
+    for (int64_t value; (value = requests.Pop()) >= 0;) replies.Push(value);
+  });
+  int64_t i = 0;
+  for (auto _ : state) {
+    requests.Push(i);
+    benchmark::DoNotOptimize(replies.Pop());
+    ++i;
+  }
+  requests.Push(-1);
+  echo.join();
+}
+
+BENCHMARK_TEMPLATE(BM_RoundTrip, absl::BoundedQueue<int64_t>)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_RoundTrip, MutexDequeQueue<int64_t>)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_RoundTrip, absl::SpscRingBuffer<int64_t>)
+    ->UseRealTime();
+
+}  // namespace
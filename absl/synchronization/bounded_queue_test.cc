@@ -0,0 +1,152 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/synchronization/bounded_queue.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>  // NOLINT(build/c++11)
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "absl/base/config.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+
+namespace {
+
+TEST(BoundedQueueTest, Capacity) {
+  EXPECT_EQ(absl::BoundedQueue<int>(0).capacity(), 2);
+  EXPECT_EQ(absl::BoundedQueue<int>(1).capacity(), 2);
+  EXPECT_EQ(absl::BoundedQueue<int>(5).capacity(), 8);
+  EXPECT_EQ(absl::BoundedQueue<int>(64).capacity(), 64);
+}
+
+TEST(BoundedQueueTest, Fifo) {
+  absl::BoundedQueue<int> queue(4);
+  EXPECT_EQ(queue.TryPop(), absl::nullopt);
+  for (int lap = 0; lap < 3; ++lap) {
+    for (int i = 0; i < 4; ++i) EXPECT_TRUE(queue.TryPush(i));
+    int rejected = 4;
+    EXPECT_FALSE(queue.TryPush(rejected));
+    for (int i = 0; i < 4; ++i) EXPECT_EQ(queue.TryPop(), i);
+    EXPECT_EQ(queue.TryPop(), absl::nullopt);
+  }
+}
+
+TEST(BoundedQueueTest, MoveOnlyAndDestruction) {
+  auto counter = std::make_shared<int>(0);
+  {
+    absl::BoundedQueue<std::unique_ptr<std::shared_ptr<int>>> queue(4);
+    auto value = std::make_unique<std::shared_ptr<int>>(counter);
+    EXPECT_TRUE(queue.TryPush(std::move(value)));
+    EXPECT_EQ(value, nullptr);
+    EXPECT_TRUE(queue.TryEmplace(new std::shared_ptr<int>(counter)));
+    EXPECT_TRUE(queue.TryEmplace(new std::shared_ptr<int>(counter)));
+    EXPECT_TRUE(queue.TryEmplace(new std::shared_ptr<int>(counter)));
+
+    // A failed push leaves the value alone.
+    value = std::make_unique<std::shared_ptr<int>>(counter);
+    EXPECT_FALSE(queue.TryPush(std::move(value)));
+    EXPECT_NE(value, nullptr);
+    value.reset();
+
+    EXPECT_NE(queue.TryPop(), absl::nullopt);
+    EXPECT_EQ(counter.use_count(), 4);
+  }
+  // The queue destroyed the elements left in it.
+  EXPECT_EQ(counter.use_count(), 1);
+}
+
+TEST(BoundedQueueTest, PopBlocksUntilPush) {
+  absl::BoundedQueue<int> queue(2);
+  std::thread producer([&] {
+    absl::SleepFor(absl::Milliseconds(10));
+    queue.Push(42);
+  });
+  EXPECT_EQ(queue.Pop(), 42);
+  producer.join();
+}
+
+TEST(BoundedQueueTest, PushBlocksWhileFull) {
+  absl::BoundedQueue<int> queue(2);
+  queue.Push(1);
+  queue.Push(2);
+  std::atomic<bool> pushed{false};
+  std::thread producer([&] {
+    queue.Push(3);
+    pushed = true;
+  });
+  absl::SleepFor(absl::Milliseconds(10));
+  EXPECT_FALSE(pushed);
+  EXPECT_EQ(queue.Pop(), 1);
+  producer.join();
+  EXPECT_TRUE(pushed);
+  EXPECT_EQ(queue.Pop(), 2);
+  EXPECT_EQ(queue.Pop(), 3);
+}
+
+TEST(BoundedQueueTest, ManyProducersAndConsumers) {
+  constexpr int kProducers = 4;
+  constexpr int kConsumers = 4;
+  constexpr int kItemsPerProducer = 20000;
+  absl::BoundedQueue<int64_t> queue(16);
+  std::atomic<int64_t> sum{0};
+  std::vector<std::thread> threads;
+  for (int p = 0; p < kProducers; ++p) {
+    threads.emplace_back([&queue, p] {
+      for (int i = 0; i < kItemsPerProducer; ++i) {
+        queue.Push(int64_t{p} * kItemsPerProducer + i);
+      }
+    });
+  }
+  for (int c = 0; c < kConsumers; ++c) {
+    threads.emplace_back([&] {
+      int64_t local = 0;
+      for (int i = 0; i < kProducers * kItemsPerProducer / kConsumers; ++i) {
+        local += queue.Pop();
+      }
+      sum += local;
+    });
+  }
+  for (std::thread& thread : threads) thread.join();
+  constexpr int64_t kTotal = int64_t{kProducers} * kItemsPerProducer;
+  EXPECT_EQ(sum, kTotal * (kTotal - 1) / 2);
+  EXPECT_EQ(queue.TryPop(), absl::nullopt);
+}
+
+TEST(BoundedQueueTest, PerProducerOrder) {
+  constexpr int kProducers = 3;
+  constexpr int kItemsPerProducer = 20000;
+  absl::BoundedQueue<int> queue(8);
+  std::vector<std::thread> producers;
+  for (int p = 0; p < kProducers; ++p) {
+    producers.emplace_back([&queue, p] {
+      for (int i = 0; i < kItemsPerProducer; ++i) {
+        queue.Push(p * kItemsPerProducer + i);
+      }
+    });
+  }
+  std::vector<int> last(kProducers, -1);
+  for (int i = 0; i < kProducers * kItemsPerProducer; ++i) {
+    const int value = queue.Pop();
+    const int p = value / kItemsPerProducer;
+    ASSERT_GT(value % kItemsPerProducer, last[p]);
+    last[p] = value % kItemsPerProducer;
+  }
+  for (std::thread& producer : producers) producer.join();
+}
+
+}  // namespace
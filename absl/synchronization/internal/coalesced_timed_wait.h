@@ -0,0 +1,45 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef ABSL_SYNCHRONIZATION_INTERNAL_COALESCED_TIMED_WAIT_H_
+#define ABSL_SYNCHRONIZATION_INTERNAL_COALESCED_TIMED_WAIT_H_
+
+// Timed waits of `PerThreadSem` whose deadlines are kept by the shared timer
+// wheel, rather than by a kernel timeout; see
+// `absl::EnableTimedWaitCoalescing()`.
+
+#include "absl/base/config.h"
+#include "absl/base/internal/thread_identity.h"
+#include "absl/synchronization/internal/kernel_timeout.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+namespace synchronization_internal {
+
+// Returns whether the timed waits of the thread of `identity` go through the
+// shared timer wheel.
+bool ShouldCoalesceTimedWait(base_internal::ThreadIdentity* identity);
+
+// Waits, in the calling thread whose identity is `identity`, for a post or
+// for the deadline of `t`, kept by the shared timer wheel. Returns false on
+// timeout.
+bool CoalescedTimedWait(base_internal::ThreadIdentity* identity,
+                        KernelTimeout t);
+
+}  // namespace synchronization_internal
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_SYNCHRONIZATION_INTERNAL_COALESCED_TIMED_WAIT_H_
@@ -0,0 +1,349 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/synchronization/internal/contention_profiler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "absl/base/attributes.h"
+#include "absl/base/call_once.h"
+#include "absl/base/config.h"
+#include "absl/base/internal/cycleclock.h"
+#include "absl/base/no_destructor.h"
+#include "absl/debugging/stacktrace.h"
+#include "absl/debugging/symbolize.h"
+#include "absl/profiling/internal/periodic_sampler.h"
+#include "absl/profiling/internal/sample_recorder.h"
+#include "absl/strings/str_cat.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/time/time.h"
+#include "absl/types/span.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+namespace synchronization_internal {
+
+namespace {
+
+using Role = MutexContentionInfo::Role;
+using absl::base_internal::CycleClock;
+
+constexpr int32_t kDefaultSampleRate = 100;
+
+ABSL_CONST_INIT std::atomic<bool> g_enabled{false};
+ABSL_CONST_INIT std::atomic<int32_t> g_sample_rate{kDefaultSampleRate};
+ABSL_CONST_INIT absl::once_flag g_register_hooks_once;
+
+struct MutexContentionTag {};
+using ContentionSampler =
+    profiling_internal::PeriodicSampler<MutexContentionTag,
+                                        kDefaultSampleRate>;
+
+// Whether the thread is recording a sample, during which contention on the
+// profiler's own locks is ignored.
+thread_local bool g_in_profiler = false;
+
+// The `Mutex` that this thread last acquired after waiting, and when, so that
+// a contended release of it can report how long it was held.
+thread_local const void* g_timed_mu = nullptr;
+thread_local int64_t g_timed_mu_start_cycles = 0;
+
+// Maps a hash of (`Mutex`, role, stack) to the entries with that hash.
+struct EntryIndex {
+  absl::Mutex mu;
+  std::unordered_multimap<size_t, MutexContentionInfo*> entries
+      ABSL_GUARDED_BY(mu);
+};
+
+EntryIndex& GetEntryIndex() {
+  static absl::NoDestructor<EntryIndex> index;
+  return *index;
+}
+
+size_t HashEntry(const void* mu, Role role, absl::Span<void* const> stack) {
+  size_t hash = reinterpret_cast<uintptr_t>(mu) * 2 + static_cast<size_t>(role);
+  for (void* pc : stack) {
+    hash = hash * 31 + reinterpret_cast<uintptr_t>(pc);
+  }
+  return hash;
+}
+
+// Adds one event to the entry of the calling thread's stack, creating it if
+// needed. `hold_cycles` is negative if the hold was not timed.
+ABSL_ATTRIBUTE_NOINLINE void Record(const void* mu, Role role,
+                                    int64_t wait_cycles, int64_t hold_cycles) {
+  void* stack[MutexContentionInfo::kMaxStackDepth];
+  // Skips this function and the hook that called it.
+  const int depth = absl::GetStackTrace(
+      stack, MutexContentionInfo::kMaxStackDepth, /*skip_count=*/2);
+  const absl::Span<void* const> stack_span(stack, static_cast<size_t>(depth));
+  const size_t hash = HashEntry(mu, role, stack_span);
+
+  EntryIndex& index = GetEntryIndex();
+  absl::MutexLock lock(&index.mu);
+  MutexContentionInfo* info = nullptr;
+  auto range = index.entries.equal_range(hash);
+  for (auto it = range.first; it != range.second; ++it) {
+    MutexContentionInfo* candidate = it->second;
+    if (candidate->mu == mu && candidate->role == role &&
+        absl::Span<void* const>(candidate->stack,
+                                static_cast<size_t>(candidate->depth)) ==
+            stack_span) {
+      info = candidate;
+      break;
+    }
+  }
+  if (info == nullptr) {
+    info = GlobalMutexContentionSampler().Register(
+        int64_t{GetMutexContentionSampleRate()}, mu, role, stack_span);
+    if (info == nullptr) return;  // Too many entries.
+    index.entries.emplace(hash, info);
+  }
+  info->events.fetch_add(1, std::memory_order_relaxed);
+  info->wait_cycles.fetch_add(wait_cycles, std::memory_order_relaxed);
+  if (wait_cycles > info->max_wait_cycles.load(std::memory_order_relaxed)) {
+    info->max_wait_cycles.store(wait_cycles, std::memory_order_relaxed);
+  }
+  if (hold_cycles >= 0) {
+    info->hold_cycles.fetch_add(hold_cycles, std::memory_order_relaxed);
+    info->timed_holds.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+bool ShouldSample() {
+  thread_local ContentionSampler sampler;
+  return sampler.Sample();
+}
+
+void OnContendedLock(const void* mu, int64_t wait_cycles) {
+  if (!g_enabled.load(std::memory_order_relaxed) || g_in_profiler) return;
+  g_timed_mu = mu;
+  g_timed_mu_start_cycles = CycleClock::Now();
+  if (!ShouldSample()) return;
+  g_in_profiler = true;
+  Record(mu, Role::kWaiter, wait_cycles, /*hold_cycles=*/-1);
+  g_in_profiler = false;
+}
+
+void OnContendedUnlock(const void* mu, int64_t wait_cycles) {
+  if (!g_enabled.load(std::memory_order_relaxed) || g_in_profiler) return;
+  int64_t hold_cycles = -1;
+  if (g_timed_mu == mu) {
+    hold_cycles = CycleClock::Now() - g_timed_mu_start_cycles;
+    g_timed_mu = nullptr;
+  }
+  if (!ShouldSample()) return;
+  g_in_profiler = true;
+  Record(mu, Role::kHolder, wait_cycles, hold_cycles);
+  g_in_profiler = false;
+}
+
+// A copy of an entry, taken while iterating.
+struct EntrySnapshot {
+  const void* mu;
+  Role role;
+  int64_t events;
+  int64_t wait_cycles;
+  int64_t max_wait_cycles;
+  int64_t hold_cycles;
+  int64_t timed_holds;
+  std::vector<void*> stack;
+};
+
+std::vector<EntrySnapshot> Snapshot(int64_t* dropped) {
+  std::vector<EntrySnapshot> entries;
+  *dropped = IterateMutexContention([&](const MutexContentionInfo& info) {
+    entries.push_back(
+        {info.mu, info.role, info.events.load(std::memory_order_relaxed),
+         info.wait_cycles.load(std::memory_order_relaxed),
+         info.max_wait_cycles.load(std::memory_order_relaxed),
+         info.hold_cycles.load(std::memory_order_relaxed),
+         info.timed_holds.load(std::memory_order_relaxed),
+         std::vector<void*>(info.stack, info.stack + info.depth)});
+  });
+  return entries;
+}
+
+std::string FormatCycles(int64_t cycles) {
+  return absl::FormatDuration(absl::Nanoseconds(
+      static_cast<double>(cycles) * 1e9 / CycleClock::Frequency()));
+}
+
+void AppendStack(const std::vector<void*>& stack, std::string* out) {
+  for (void* pc : stack) {
+    char symbol[256];
+    absl::StrAppend(out, "    @ 0x",
+                    absl::Hex(reinterpret_cast<uintptr_t>(pc)));
+    // Look up the calling instruction rather than the return address.
+    if (absl::Symbolize(static_cast<char*>(pc) - 1, symbol, sizeof(symbol))) {
+      absl::StrAppend(out, "  ", symbol);
+    }
+    absl::StrAppend(out, "\n");
+  }
+}
+
+}  // namespace
+
+MutexContentionInfo::MutexContentionInfo() = default;
+MutexContentionInfo::~MutexContentionInfo() = default;
+
+void MutexContentionInfo::PrepareForSampling(
+    int64_t stride, const void* mu_value, Role role_value,
+    absl::Span<void* const> stack_value) {
+  events.store(0, std::memory_order_relaxed);
+  wait_cycles.store(0, std::memory_order_relaxed);
+  max_wait_cycles.store(0, std::memory_order_relaxed);
+  hold_cycles.store(0, std::memory_order_relaxed);
+  timed_holds.store(0, std::memory_order_relaxed);
+
+  weight = stride;
+  mu = mu_value;
+  role = role_value;
+  depth = static_cast<int32_t>(stack_value.size());
+  std::copy(stack_value.begin(), stack_value.end(), stack);
+}
+
+profiling_internal::SampleRecorder<MutexContentionInfo>&
+GlobalMutexContentionSampler() {
+  static absl::NoDestructor<
+      profiling_internal::SampleRecorder<MutexContentionInfo>>
+      sampler;
+  return *sampler;
+}
+
+void SetMutexContentionProfilerEnabled(bool enabled) {
+  if (enabled) {
+    absl::call_once(g_register_hooks_once, [] {
+      RegisterMutexContentionHooks(&OnContendedLock, &OnContendedUnlock);
+    });
+  }
+  g_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool IsMutexContentionProfilerEnabled() {
+  return g_enabled.load(std::memory_order_relaxed);
+}
+
+void SetMutexContentionSampleRate(int32_t rate) {
+  if (rate <= 0) rate = 1;
+  g_sample_rate.store(rate, std::memory_order_relaxed);
+  ContentionSampler::SetGlobalPeriod(rate);
+}
+
+int32_t GetMutexContentionSampleRate() {
+  return g_sample_rate.load(std::memory_order_relaxed);
+}
+
+void SetMutexContentionMaxSamples(size_t max) {
+  GlobalMutexContentionSampler().SetMaxSamples(max);
+}
+
+int64_t IterateMutexContention(
+    const std::function<void(const MutexContentionInfo&)>& f) {
+  return GlobalMutexContentionSampler().Iterate(f);
+}
+
+void ResetMutexContentionProfile() {
+  EntryIndex& index = GetEntryIndex();
+  absl::MutexLock lock(&index.mu);
+  for (const auto& entry : index.entries) {
+    GlobalMutexContentionSampler().Unregister(entry.second);
+  }
+  index.entries.clear();
+}
+
+std::string MutexContentionProfileText() {
+  int64_t dropped;
+  std::vector<EntrySnapshot> entries = Snapshot(&dropped);
+
+  // Orders Mutexes by the time their sampled waiters waited, and the entries
+  // of each Mutex by role, then by wait time.
+  std::map<const void*, int64_t> mutex_wait_cycles;
+  for (const EntrySnapshot& entry : entries) {
+    int64_t& total = mutex_wait_cycles[entry.mu];
+    if (entry.role == Role::kWaiter) total += entry.wait_cycles;
+  }
+  std::sort(entries.begin(), entries.end(),
+            [&](const EntrySnapshot& a, const EntrySnapshot& b) {
+              const int64_t a_total = mutex_wait_cycles[a.mu];
+              const int64_t b_total = mutex_wait_cycles[b.mu];
+              if (a_total != b_total) return a_total > b_total;
+              if (a.mu != b.mu) return a.mu < b.mu;
+              if (a.role != b.role) return a.role < b.role;
+              return a.wait_cycles > b.wait_cycles;
+            });
+
+  std::string out = absl::StrCat(
+      "Mutex contention profile: 1 in ", GetMutexContentionSampleRate(),
+      " contention events sampled, ", dropped, " dropped\n");
+  const void* mu = nullptr;
+  for (size_t i = 0; i < entries.size(); ++i) {
+    const EntrySnapshot& entry = entries[i];
+    if (i == 0 || entry.mu != mu) {
+      mu = entry.mu;
+      absl::StrAppend(&out, "\nMutex 0x",
+                      absl::Hex(reinterpret_cast<uintptr_t>(mu)), ": ",
+                      FormatCycles(mutex_wait_cycles[mu]),
+                      " of sampled waiting\n");
+    }
+    if (entry.role == Role::kWaiter) {
+      absl::StrAppend(&out, "  ", entry.events, " waits for ",
+                      FormatCycles(entry.wait_cycles), " (max ",
+                      FormatCycles(entry.max_wait_cycles), ") at:\n");
+    } else {
+      absl::StrAppend(&out, "  ", entry.events, " releases to waiters of ",
+                      FormatCycles(entry.wait_cycles), " (max ",
+                      FormatCycles(entry.max_wait_cycles), ")");
+      if (entry.timed_holds > 0) {
+        absl::StrAppend(&out, ", held ",
+                        FormatCycles(entry.hold_cycles / entry.timed_holds),
+                        " on average");
+      }
+      absl::StrAppend(&out, " at:\n");
+    }
+    AppendStack(entry.stack, &out);
+  }
+  return out;
+}
+
+std::string MutexContentionProfilePprof() {
+  int64_t dropped;
+  const std::vector<EntrySnapshot> entries = Snapshot(&dropped);
+  std::string out = absl::StrCat(
+      "--- contention\ncycles/second = ",
+      static_cast<int64_t>(CycleClock::Frequency()),
+      "\nsampling period = ", GetMutexContentionSampleRate(), "\n");
+  for (const EntrySnapshot& entry : entries) {
+    if (entry.role != Role::kWaiter || entry.stack.empty()) continue;
+    absl::StrAppend(&out, entry.wait_cycles, " ", entry.events, " @");
+    for (void* pc : entry.stack) {
+      absl::StrAppend(&out, " 0x", absl::Hex(reinterpret_cast<uintptr_t>(pc)));
+    }
+    absl::StrAppend(&out, "\n");
+  }
+  return out;
+}
+
+}  // namespace synchronization_internal
+ABSL_NAMESPACE_END
+}  // namespace absl
@@ -0,0 +1,133 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// -----------------------------------------------------------------------------
+// File: contention_profiler.h
+// -----------------------------------------------------------------------------
+//
+// This header file defines a sampled profiler of `absl::Mutex` contention.
+//
+// Once enabled, roughly one in `GetMutexContentionSampleRate()` contended
+// acquisitions and releases of a `Mutex` records the stack of the calling
+// thread. Waiters are threads that blocked before acquiring a `Mutex`, and
+// holders are threads that released a `Mutex` that others were blocked on.
+// Samples are aggregated by `Mutex` address, role and stack in
+// `MutexContentionInfo` objects, which are kept by a `SampleRecorder` like the
+// hashtable samples of hashtablez.
+//
+// The aggregated profile can be read with `IterateMutexContention()`, or dumped
+// as text for humans, or in the legacy contention format understood by pprof.
+//
+// This utility is internal-only. Use at your own risk.
+
+#ifndef ABSL_SYNCHRONIZATION_INTERNAL_CONTENTION_PROFILER_H_
+#define ABSL_SYNCHRONIZATION_INTERNAL_CONTENTION_PROFILER_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+#include "absl/base/config.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/profiling/internal/sample_recorder.h"
+#include "absl/types/span.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+namespace synchronization_internal {
+
+// Stores the sampled contention of one `Mutex` at one stack. All reads of
+// this must occur in the callback of `IterateMutexContention()`.
+struct MutexContentionInfo
+    : public profiling_internal::Sample<MutexContentionInfo> {
+  enum class Role { kWaiter, kHolder };
+
+  // Constructs the object but does not fill in any fields.
+  MutexContentionInfo();
+  ~MutexContentionInfo();
+  MutexContentionInfo(const MutexContentionInfo&) = delete;
+  MutexContentionInfo& operator=(const MutexContentionInfo&) = delete;
+
+  // Puts the object into a clean state and fills in the logically `const`
+  // members.
+  void PrepareForSampling(int64_t stride, const void* mu_value,
+                          Role role_value, absl::Span<void* const> stack_value)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(init_mu);
+
+  // Updated by the profiler as samples are aggregated.
+  //
+  // The number of sampled events.
+  std::atomic<int64_t> events;
+  // For waiters, the cycles they waited. For holders, the cycles that the
+  // waiters they released had waited.
+  std::atomic<int64_t> wait_cycles;
+  std::atomic<int64_t> max_wait_cycles;
+  // Holders only: the cycles they held the `Mutex`, summed over the
+  // `timed_holds` events in which the holder had acquired it after waiting.
+  // Holds of a `Mutex` acquired without contention are not timed.
+  std::atomic<int64_t> hold_cycles;
+  std::atomic<int64_t> timed_holds;
+
+  // Set by `PrepareForSampling()`.
+  static constexpr int kMaxStackDepth = 64;
+  const void* mu;
+  Role role;
+  int32_t depth;
+  void* stack[kMaxStackDepth];
+};
+
+// Returns the recorder holding the profile.
+profiling_internal::SampleRecorder<MutexContentionInfo>&
+GlobalMutexContentionSampler();
+
+// Enables or disables the profiler. The first call to enable it registers the
+// `Mutex` contention hooks, which precludes other users of
+// `RegisterMutexContentionHooks()`. Thread-safe.
+void SetMutexContentionProfilerEnabled(bool enabled);
+bool IsMutexContentionProfilerEnabled();
+
+// Sets the mean number of contention events per sample. A rate of 1 samples
+// every event. Thread-safe.
+void SetMutexContentionSampleRate(int32_t rate);
+int32_t GetMutexContentionSampleRate();
+
+// Sets the maximum number of distinct (`Mutex`, role, stack) entries. Events
+// that would need more are dropped. Thread-safe.
+void SetMutexContentionMaxSamples(size_t max);
+
+// Calls `f` on each entry of the profile, and returns the number of events
+// that were dropped for lack of entries.
+int64_t IterateMutexContention(
+    const std::function<void(const MutexContentionInfo&)>& f);
+
+// Discards all entries of the profile.
+void ResetMutexContentionProfile();
+
+// Returns the profile as text, grouped by `Mutex` with the most waiting first,
+// and within each `Mutex`, its waiter and holder stacks, symbolized where
+// possible.
+std::string MutexContentionProfileText();
+
+// Returns the waiter stacks of the profile in the legacy contention profile
+// format read by pprof: a `--- contention` header, the cycle rate and the
+// sampling period, then one `<wait cycles> <events> @ <pc>...` line per entry.
+std::string MutexContentionProfilePprof();
+
+}  // namespace synchronization_internal
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_SYNCHRONIZATION_INTERNAL_CONTENTION_PROFILER_H_
@@ -0,0 +1,118 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/synchronization/internal/contention_profiler.h"
+
+#include <cstdint>
+#include <string>
+#include <thread>  // NOLINT(build/c++11)
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "absl/strings/str_cat.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/synchronization/notification.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+namespace synchronization_internal {
+namespace {
+
+using ::testing::HasSubstr;
+using ::testing::StartsWith;
+using Role = MutexContentionInfo::Role;
+
+struct Totals {
+  int64_t events = 0;
+  int64_t wait_cycles = 0;
+  int64_t timed_holds = 0;
+};
+
+Totals GetTotals(const absl::Mutex* mu, Role role) {
+  Totals totals;
+  IterateMutexContention([&](const MutexContentionInfo& info) {
+    if (info.mu != mu || info.role != role) return;
+    totals.events += info.events.load();
+    totals.wait_cycles += info.wait_cycles.load();
+    totals.timed_holds += info.timed_holds.load();
+  });
+  return totals;
+}
+
+// Holds `mu` while a thread blocks on it, then lets that thread hold `mu`
+// while another one blocks on it.
+void ContendTwice(absl::Mutex* mu) {
+  mu->Lock();
+  absl::Notification first_locked;
+  std::thread first([&] {
+    mu->Lock();
+    first_locked.Notify();
+    absl::SleepFor(absl::Milliseconds(50));
+    mu->Unlock();
+  });
+  absl::SleepFor(absl::Milliseconds(50));
+  mu->Unlock();
+  first_locked.WaitForNotification();
+  std::thread second([&] {
+    mu->Lock();
+    mu->Unlock();
+  });
+  first.join();
+  second.join();
+}
+
+TEST(ContentionProfiler, RecordsWaitersAndHolders) {
+  SetMutexContentionSampleRate(1);
+  SetMutexContentionProfilerEnabled(true);
+  EXPECT_TRUE(IsMutexContentionProfilerEnabled());
+  absl::Mutex mu;
+  ContendTwice(&mu);
+  SetMutexContentionProfilerEnabled(false);
+
+  const Totals waiters = GetTotals(&mu, Role::kWaiter);
+  EXPECT_EQ(waiters.events, 2);
+  EXPECT_GT(waiters.wait_cycles, 0);
+  const Totals holders = GetTotals(&mu, Role::kHolder);
+  EXPECT_EQ(holders.events, 2);
+  EXPECT_GT(holders.wait_cycles, 0);
+  // Only the first waiter went on to hold `mu` while another thread waited.
+  EXPECT_EQ(holders.timed_holds, 1);
+
+  const std::string mu_address =
+      absl::StrCat("Mutex 0x", absl::Hex(reinterpret_cast<uintptr_t>(&mu)));
+  EXPECT_THAT(MutexContentionProfileText(), HasSubstr(mu_address));
+  const std::string pprof = MutexContentionProfilePprof();
+  EXPECT_THAT(pprof, StartsWith("--- contention\ncycles/second = "));
+  EXPECT_THAT(pprof, HasSubstr("\nsampling period = 1\n"));
+
+  ResetMutexContentionProfile();
+  EXPECT_EQ(GetTotals(&mu, Role::kWaiter).events, 0);
+  EXPECT_EQ(GetTotals(&mu, Role::kHolder).events, 0);
+}
+
+TEST(ContentionProfiler, Disabled) {
+  SetMutexContentionSampleRate(1);
+  SetMutexContentionProfilerEnabled(false);
+  absl::Mutex mu;
+  ContendTwice(&mu);
+  EXPECT_EQ(GetTotals(&mu, Role::kWaiter).events, 0);
+  EXPECT_EQ(GetTotals(&mu, Role::kHolder).events, 0);
+}
+
+}  // namespace
+}  // namespace synchronization_internal
+ABSL_NAMESPACE_END
+}  // namespace absl
@@ -14,6 +14,7 @@
 
 #include <stdint.h>
 
+#include <atomic>
 #include <new>
 
 // This file is a no-op if the required LowLevelAlloc support is missing.
@@ -38,6 +39,11 @@ ABSL_CONST_INIT static base_internal::SpinLock freelist_lock(
     base_internal::SCHEDULE_KERNEL_ONLY);
 ABSL_CONST_INIT static base_internal::ThreadIdentity* thread_identity_freelist;
 
+// The head of the list of all ThreadIdentity objects ever allocated, linked
+// by next_allocated.  Objects are only ever pushed on the front.
+ABSL_CONST_INIT static std::atomic<base_internal::ThreadIdentity*>
+    all_thread_identities{nullptr};
+
 // A per-thread destructor for reclaiming associated ThreadIdentity objects.
 // Since we must preserve their storage, we cache them for re-use instead of
 // truly destructing the object.
@@ -59,6 +65,9 @@ static void ReclaimThreadIdentity(void* v) {
   //     reinitialized before reuse.  We must allow explicit clearing of the
   //     association state in this case.
   base_internal::ClearCurrentThreadIdentity();
+  // A thread exiting within an RCU read-side critical section must not hold
+  // back reclamation forever.
+  identity->rcu_epoch.store(0, std::memory_order_release);
   {
     base_internal::SpinLockHolder l(&freelist_lock);
     identity->next = thread_identity_freelist;
@@ -77,6 +86,8 @@ void OneTimeInitThreadIdentity(base_internal::ThreadIdentity* identity) {
   identity->ticker.store(0, std::memory_order_relaxed);
   identity->wait_start.store(0, std::memory_order_relaxed);
   identity->is_idle.store(false, std::memory_order_relaxed);
+  identity->rcu_epoch.store(0, std::memory_order_relaxed);
+  identity->rcu_nesting = 0;
 }
 
 static void ResetThreadIdentityBetweenReuse(
@@ -100,6 +111,8 @@ static void ResetThreadIdentityBetweenReuse(
   identity->ticker.store(0, std::memory_order_relaxed);
   identity->wait_start.store(0, std::memory_order_relaxed);
   identity->is_idle.store(false, std::memory_order_relaxed);
+  identity->rcu_epoch.store(0, std::memory_order_relaxed);
+  identity->rcu_nesting = 0;
   identity->next = nullptr;
 }
 
@@ -129,6 +142,12 @@ static base_internal::ThreadIdentity* NewThreadIdentity() {
     // TODO(b/357097463): change this "one time init" to be a proper
     // constructor.
     OneTimeInitThreadIdentity(identity);
+    base_internal::ThreadIdentity* head =
+        all_thread_identities.load(std::memory_order_relaxed);
+    do {
+      identity->next_allocated = head;
+    } while (!all_thread_identities.compare_exchange_weak(
+        head, identity, std::memory_order_release, std::memory_order_relaxed));
   }
   ResetThreadIdentityBetweenReuse(identity);
 
@@ -145,6 +164,10 @@ base_internal::ThreadIdentity* CreateThreadIdentity() {
   return identity;
 }
 
+base_internal::ThreadIdentity* AllThreadIdentities() {
+  return all_thread_identities.load(std::memory_order_acquire);
+}
+
 }  // namespace synchronization_internal
 ABSL_NAMESPACE_END
 }  // namespace absl
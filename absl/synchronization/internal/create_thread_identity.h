@@ -49,6 +49,11 @@ inline base_internal::ThreadIdentity* GetOrCreateCurrentThreadIdentity() {
   return identity;
 }
 
+// Returns the most recently allocated ThreadIdentity object, from which all
+// ThreadIdentity objects ever allocated can be visited by following
+// `next_allocated`.  Objects may be in use by a thread or on the free-list.
+base_internal::ThreadIdentity* AllThreadIdentities();
+
 }  // namespace synchronization_internal
 ABSL_NAMESPACE_END
 }  // namespace absl
@@ -35,16 +35,14 @@
 #include <limits>
 
 #include "absl/base/optimization.h"
+#include "absl/synchronization/internal/futex_word.h"
 #include "absl/synchronization/internal/kernel_timeout.h"
 
 #ifdef ABSL_INTERNAL_HAVE_FUTEX
 #error ABSL_INTERNAL_HAVE_FUTEX may not be set on the command line
-#elif defined(__BIONIC__)
-// Bionic supports all the futex operations we need even when some of the futex
-// definitions are missing.
-#define ABSL_INTERNAL_HAVE_FUTEX
-#elif defined(__linux__) && defined(FUTEX_CLOCK_REALTIME)
-// FUTEX_CLOCK_REALTIME requires Linux >= 2.6.28.
+#elif defined(ABSL_INTERNAL_HAVE_FUTEX_WORD)
+// futex_word.h decides, so that the futex word in public headers is used
+// exactly where the futex operations are available.
 #define ABSL_INTERNAL_HAVE_FUTEX
 #endif
 
@@ -0,0 +1,67 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// The state word of the futex-based `Notification` and `BlockingCounter`, and
+// the check for futex support that `futex.h` shares. This header is included
+// from public headers, so unlike `futex.h` it must not pull in any system
+// headers other than the constants of <linux/futex.h>.
+
+#ifndef ABSL_SYNCHRONIZATION_INTERNAL_FUTEX_WORD_H_
+#define ABSL_SYNCHRONIZATION_INTERNAL_FUTEX_WORD_H_
+
+#include <atomic>
+#include <cstdint>
+
+#include "absl/base/config.h"
+
+#ifdef __linux__
+#include <linux/futex.h>
+#endif
+
+#ifdef ABSL_INTERNAL_HAVE_FUTEX_WORD
+#error ABSL_INTERNAL_HAVE_FUTEX_WORD may not be set on the command line
+#elif defined(__BIONIC__)
+// Bionic supports all the futex operations we need even when some of the futex
+// definitions are missing.
+#define ABSL_INTERNAL_HAVE_FUTEX_WORD 1
+#elif defined(__linux__) && defined(FUTEX_CLOCK_REALTIME)
+// FUTEX_CLOCK_REALTIME requires Linux >= 2.6.28.
+#define ABSL_INTERNAL_HAVE_FUTEX_WORD 1
+#endif
+
+#ifdef ABSL_INTERNAL_HAVE_FUTEX_WORD
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+namespace synchronization_internal {
+
+// A word that threads sleep on with `Futex`. Futexes are defined by
+// specification to be 32 bits.
+using FutexWord = std::atomic<int32_t>;
+static_assert(sizeof(FutexWord) == sizeof(int32_t), "Wrong size for futex");
+
+// State bits of a one-shot event kept in a `FutexWord`.
+//
+// The event has happened.
+inline constexpr int32_t kFutexWordDone = 1;
+// Some thread is, or is about to be, asleep on the word.
+inline constexpr int32_t kFutexWordWaiters = 2;
+
+}  // namespace synchronization_internal
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_INTERNAL_HAVE_FUTEX_WORD
+
+#endif  // ABSL_SYNCHRONIZATION_INTERNAL_FUTEX_WORD_H_
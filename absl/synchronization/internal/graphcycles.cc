@@ -449,10 +449,12 @@ GraphId GraphCycles::GetId(void* ptr) {
   }
 }
 
-void GraphCycles::RemoveNode(void* ptr) {
+bool GraphCycles::HasId(void* ptr) { return rep_->ptrmap_.Find(ptr) != -1; }
+
+bool GraphCycles::RemoveNode(void* ptr) {
   int32_t i = rep_->ptrmap_.Remove(ptr);
   if (i == -1) {
-    return;
+    return false;
   }
   Node* x = rep_->nodes_[static_cast<uint32_t>(i)];
   HASH_FOR_EACH(y, x->out) {
@@ -470,6 +472,7 @@ void GraphCycles::RemoveNode(void* ptr) {
     x->version++;  // Invalidates all copies of node.
     rep_->free_nodes_.push_back(i);
   }
+  return true;
 }
 
 void* GraphCycles::Ptr(GraphId id) {
@@ -69,9 +69,12 @@ class GraphCycles {
   // until Remove().
   GraphId GetId(void* ptr);
 
+  // Return whether ptr has an id, assigned by GetId() and not removed since.
+  bool HasId(void* ptr);
+
   // Remove "ptr" from the graph.  Its corresponding node and all
-  // edges to and from it are removed.
-  void RemoveNode(void* ptr);
+  // edges to and from it are removed.  Return whether ptr was in the graph.
+  bool RemoveNode(void* ptr);
 
   // Return the pointer associated with id, or nullptr if id is not
   // currently in the graph.
@@ -40,4 +40,41 @@ void BM_StressTest(benchmark::State& state) {
 }
 BENCHMARK(BM_StressTest)->Range(2048, 1048576);
 
+// Inserts edges that each point against the order in which their nodes were
+// created, so that every insertion reorders the nodes it connects.
+void BM_InsertReorderingEdges(benchmark::State& state) {
+  const int num_nodes = state.range(0);
+  while (state.KeepRunningBatch(num_nodes / 2)) {
+    absl::synchronization_internal::GraphCycles g;
+    std::vector<absl::synchronization_internal::GraphId> nodes(num_nodes);
+    for (int i = 0; i < num_nodes; i++) {
+      nodes[i] = g.GetId(reinterpret_cast<void*>(static_cast<uintptr_t>(i)));
+    }
+    for (int i = 0; i + 1 < num_nodes; i += 2) {
+      ABSL_RAW_CHECK(g.InsertEdge(nodes[i + 1], nodes[i]), "");
+    }
+  }
+}
+BENCHMARK(BM_InsertReorderingEdges)->Range(2048, 1048576);
+
+// Inserts edges that are already in the graph, looking up the ids of their
+// endpoints by pointer, as Mutex deadlock detection does for the lock
+// orderings that a program repeats.
+void BM_InsertExistingEdges(benchmark::State& state) {
+  const int num_nodes = state.range(0);
+  absl::synchronization_internal::GraphCycles g;
+  auto ptr = [](int i) {
+    return reinterpret_cast<void*>(static_cast<uintptr_t>(i + 1));
+  };
+  for (int i = 0; i + 1 < num_nodes; i++) {
+    ABSL_RAW_CHECK(g.InsertEdge(g.GetId(ptr(i)), g.GetId(ptr(i + 1))), "");
+  }
+  int i = 0;
+  for (auto _ : state) {
+    ABSL_RAW_CHECK(g.InsertEdge(g.GetId(ptr(i)), g.GetId(ptr(i + 1))), "");
+    if (++i == num_nodes - 1) i = 0;
+  }
+}
+BENCHMARK(BM_InsertExistingEdges)->Range(2048, 1048576);
+
 }  // namespace
@@ -441,7 +441,11 @@ TEST_F(GraphCyclesTest, RemoveNode) {
   ASSERT_TRUE(AddEdge(2, 3));
   ASSERT_TRUE(AddEdge(3, 4));
   ASSERT_TRUE(AddEdge(4, 5));
-  g_.RemoveNode(g_.Ptr(id_[3]));
+  void* three = g_.Ptr(id_[3]);
+  EXPECT_TRUE(g_.HasId(three));
+  EXPECT_TRUE(g_.RemoveNode(three));
+  EXPECT_FALSE(g_.HasId(three));
+  EXPECT_FALSE(g_.RemoveNode(three));
   id_.erase(3);
   ASSERT_TRUE(AddEdge(5, 1));
 }
@@ -0,0 +1,84 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/synchronization/internal/parking_list.h"
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+#include "absl/base/config.h"
+#include "absl/base/internal/spinlock.h"
+#include "absl/base/internal/thread_identity.h"
+#include "absl/synchronization/internal/create_thread_identity.h"
+#include "absl/synchronization/internal/kernel_timeout.h"
+#include "absl/synchronization/internal/per_thread_sem.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+namespace synchronization_internal {
+
+bool ParkingList::Park(bool (*try_op)(void*), void* arg) {
+  base_internal::ThreadIdentity* self = GetOrCreateCurrentThreadIdentity();
+  {
+    base_internal::SpinLockHolder l(&lock_);
+    parked_.push_back(self);
+    num_parked_.fetch_add(1, std::memory_order_relaxed);
+  }
+  // Pairs with the fence in `WakeOne()`: either the waker
+  // sees this thread parked, or `try_op` sees the waker's change.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  bool succeeded = try_op(arg);
+  if (succeeded) {
+    base_internal::SpinLockHolder l(&lock_);
+    auto it = std::find(parked_.begin(), parked_.end(), self);
+    if (it != parked_.end()) {
+      parked_.erase(it);
+      num_parked_.fetch_sub(1, std::memory_order_relaxed);
+      return true;
+    }
+    // A waker already took this thread off the list, and will post its
+    // semaphore; consume the post below, so that it does not end a later
+    // unrelated wait.
+  }
+  PerThreadSem::Wait(KernelTimeout::Never());
+  num_waking_.fetch_sub(1, std::memory_order_relaxed);
+  // Pairs with the fence in `WakeOne()`: either a waker that saw this thread
+  // still waking wakes no other, and `try_op` sees its change, or the waker
+  // sees no thread waking.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (!succeeded) succeeded = try_op(arg);
+  // Wakeups were withheld while this thread was waking, so pass one on in
+  // case another operation can succeed now too.
+  if (succeeded) WakeOne();
+  return succeeded;
+}
+
+void ParkingList::Wake() {
+  base_internal::ThreadIdentity* identity;
+  {
+    base_internal::SpinLockHolder l(&lock_);
+    if (parked_.empty()) return;
+    // Wake the thread parked first, so that none is passed over.
+    identity = parked_.front();
+    parked_.erase(parked_.begin());
+    num_parked_.fetch_sub(1, std::memory_order_relaxed);
+    num_waking_.fetch_add(1, std::memory_order_relaxed);
+  }
+  PerThreadSem::Post(identity);
+}
+
+}  // namespace synchronization_internal
+ABSL_NAMESPACE_END
+}  // namespace absl
@@ -0,0 +1,94 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef ABSL_SYNCHRONIZATION_INTERNAL_PARKING_LIST_H_
+#define ABSL_SYNCHRONIZATION_INTERNAL_PARKING_LIST_H_
+
+// ParkingList parks threads on their per-thread semaphores until an operation
+// that failed, such as popping from an empty lock-free queue, may succeed.
+//
+// Callers that change the state that such operations depend on call
+// `WakeOne()` afterwards. While no thread is parked, that costs a fence and
+// the load of a counter, so that lock-free structures only pay for blocking
+// when some thread actually blocks.
+//
+// While a woken thread has yet to retry its operation, `WakeOne()` wakes no
+// other, and a woken thread whose operation succeeds wakes the next, so that
+// a burst of changes wakes parked threads one at a time rather than all at
+// once.
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+#include "absl/base/config.h"
+#include "absl/base/internal/spinlock.h"
+#include "absl/base/internal/thread_identity.h"
+#include "absl/base/thread_annotations.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+namespace synchronization_internal {
+
+class ParkingList {
+ public:
+  ParkingList() = default;
+  ParkingList(const ParkingList&) = delete;
+  ParkingList& operator=(const ParkingList&) = delete;
+
+  // Calls `try_op()` until it returns true, parking the calling thread
+  // between failed attempts until woken.
+  template <typename TryOp>
+  void ParkUntil(TryOp try_op) {
+    while (!try_op()) {
+      if (Park(&CallTryOp<TryOp>, &try_op)) return;
+    }
+  }
+
+  // Wakes a parked thread to retry its operation, unless another woken thread
+  // has yet to retry. Must be called after each change that may let a parked
+  // operation succeed.
+  void WakeOne() {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (num_parked_.load(std::memory_order_relaxed) != 0 &&
+        num_waking_.load(std::memory_order_relaxed) == 0) {
+      Wake();
+    }
+  }
+
+ private:
+  template <typename TryOp>
+  static bool CallTryOp(void* try_op) {
+    return (*static_cast<TryOp*>(try_op))();
+  }
+
+  // Parks the calling thread, unless `try_op(arg)` succeeds once it is
+  // registered to be woken, and retries it once woken. Returns whether
+  // `try_op(arg)` succeeded.
+  bool Park(bool (*try_op)(void*), void* arg);
+  void Wake();
+
+  std::atomic<size_t> num_parked_{0};
+  // Woken threads that have yet to retry their operation.
+  std::atomic<size_t> num_waking_{0};
+  base_internal::SpinLock lock_;
+  std::vector<base_internal::ThreadIdentity*> parked_ ABSL_GUARDED_BY(lock_);
+};
+
+}  // namespace synchronization_internal
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_SYNCHRONIZATION_INTERNAL_PARKING_LIST_H_
@@ -22,6 +22,7 @@
 
 #include "absl/base/attributes.h"
 #include "absl/base/internal/thread_identity.h"
+#include "absl/synchronization/internal/coalesced_timed_wait.h"
 #include "absl/synchronization/internal/waiter.h"
 
 namespace absl {
@@ -89,8 +90,13 @@ ABSL_ATTRIBUTE_WEAK bool ABSL_INTERNAL_C_SYMBOL(AbslInternalPerThreadSemWait)(
     identity->blocked_count_ptr->fetch_add(1, std::memory_order_relaxed);
   }
 
-  timeout =
-      !absl::synchronization_internal::Waiter::GetWaiter(identity)->Wait(t);
+  if (t.has_timeout() &&
+      absl::synchronization_internal::ShouldCoalesceTimedWait(identity)) {
+    timeout = !absl::synchronization_internal::CoalescedTimedWait(identity, t);
+  } else {
+    timeout =
+        !absl::synchronization_internal::Waiter::GetWaiter(identity)->Wait(t);
+  }
 
   if (identity->blocked_count_ptr != nullptr) {
     identity->blocked_count_ptr->fetch_sub(1, std::memory_order_relaxed);
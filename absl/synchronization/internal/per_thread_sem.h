@@ -77,6 +77,7 @@ class PerThreadSem {
   // Permitted callers.
   friend class PerThreadSemTest;
   friend class absl::Mutex;
+  friend class ParkingList;
   friend void OneTimeInitThreadIdentity(absl::base_internal::ThreadIdentity*);
 };
 
@@ -0,0 +1,60 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef ABSL_SYNCHRONIZATION_INTERNAL_SHARED_TIMER_H_
+#define ABSL_SYNCHRONIZATION_INTERNAL_SHARED_TIMER_H_
+
+// The timers of a process are kept in one TimerWheel, served by a single
+// background thread. This is the interface to it used by `absl::Timer`; the
+// timed waits of `PerThreadSem` use it through coalesced_timed_wait.h.
+
+#include <cstdint>
+
+#include "absl/base/config.h"
+#include "absl/synchronization/internal/timer_wheel.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+namespace synchronization_internal {
+
+// A timer of the shared timer wheel, which calls `fire(this)` on the timer
+// thread once its deadline has passed.
+struct SharedTimer : TimerWheel::Entry {
+  void (*fire)(SharedTimer*) = nullptr;
+};
+
+// Schedules `timer`, which must not be scheduled, to fire at `deadline`
+// (in nanoseconds of `std::chrono::steady_clock`), rounded up to the slack.
+void ScheduleSharedTimer(SharedTimer* timer, int64_t deadline);
+
+// Unschedules `timer`, and returns whether it had yet to fire. If it is firing
+// on the timer thread, waits for that to finish first, unless called from it.
+bool CancelSharedTimer(SharedTimer* timer);
+
+// Returns whether `timer` is firing, and this is the timer thread, i.e. if
+// this is called from `timer->fire`.
+bool SharedTimerFiringOnThisThread(const SharedTimer* timer);
+
+// Returns the current time in nanoseconds of `std::chrono::steady_clock`.
+int64_t SteadyClockNowNanos();
+
+// Returns the number of times the timer thread woke up to fire timers.
+int64_t SharedTimerWakeups();
+
+}  // namespace synchronization_internal
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_SYNCHRONIZATION_INTERNAL_SHARED_TIMER_H_
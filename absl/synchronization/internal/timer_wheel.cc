@@ -0,0 +1,142 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/synchronization/internal/timer_wheel.h"
+
+#include <algorithm>
+#include <cstdint>
+
+#include "absl/base/config.h"
+#include "absl/base/internal/raw_logging.h"
+#include "absl/numeric/bits.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+namespace synchronization_internal {
+
+TimerWheel::TimerWheel(int64_t now) : now_(now) {
+  for (auto& level : slots_) {
+    for (Entry& head : level) head.prev_ = head.next_ = &head;
+  }
+  expired_.prev_ = expired_.next_ = &expired_;
+}
+
+void TimerWheel::LinkBefore(Entry* e, Entry* head) {
+  e->next_ = head;
+  e->prev_ = head->prev_;
+  head->prev_->next_ = e;
+  head->prev_ = e;
+}
+
+void TimerWheel::Unlink(Entry* e) {
+  e->prev_->next_ = e->next_;
+  e->next_->prev_ = e->prev_;
+  e->prev_ = e->next_ = nullptr;
+}
+
+void TimerWheel::Insert(Entry* e, int64_t deadline) {
+  ABSL_RAW_CHECK(!e->linked(), "TimerWheel::Insert() of a linked timer");
+  e->deadline_ = deadline;
+  ++size_;
+  Place(e);
+}
+
+void TimerWheel::Remove(Entry* e) {
+  ABSL_RAW_CHECK(e->linked(), "TimerWheel::Remove() of an unlinked timer");
+  const int level = e->level_;
+  const int slot = e->slot_;
+  Unlink(e);
+  if (level >= 0 && slots_[level][slot].next_ == &slots_[level][slot]) {
+    occupied_[level] &= ~(uint64_t{1} << slot);
+  }
+  --size_;
+}
+
+void TimerWheel::Place(Entry* e) {
+  const int64_t delta = e->deadline_ - now_;
+  if (delta <= 0) {
+    e->level_ = -1;
+    LinkBefore(e, &expired_);
+    return;
+  }
+  // A timer goes into the lowest level whose slots are narrow enough that its
+  // slot comes due at most one slot width before its deadline. Timers beyond
+  // the range of the top level are placed at its end, and placed again once
+  // their slot comes due.
+  int level = 0;
+  while (level < kLevels - 1 && delta >= SlotWidth(level + 1)) ++level;
+  const int64_t deadline =
+      std::min(e->deadline_, now_ + SlotWidth(kLevels) - 1);
+  const int slot =
+      static_cast<int>((deadline >> (kSlotBits * level)) & (kSlots - 1));
+  e->level_ = level;
+  e->slot_ = slot;
+  LinkBefore(e, &slots_[level][slot]);
+  occupied_[level] |= uint64_t{1} << slot;
+}
+
+void TimerWheel::ProcessTick() {
+  // Move timers down from the top, so that timers moved into a slot that is
+  // also due now are processed in this tick.
+  for (int level = kLevels - 1; level >= 0; --level) {
+    if ((now_ & (SlotWidth(level) - 1)) != 0) continue;
+    const int slot =
+        static_cast<int>((now_ >> (kSlotBits * level)) & (kSlots - 1));
+    if ((occupied_[level] & (uint64_t{1} << slot)) == 0) continue;
+    occupied_[level] &= ~(uint64_t{1} << slot);
+    Entry* head = &slots_[level][slot];
+    Entry* e = head->next_;
+    head->prev_ = head->next_ = head;
+    while (e != head) {
+      Entry* next = e->next_;
+      Place(e);
+      e = next;
+    }
+  }
+}
+
+void TimerWheel::Advance(int64_t now) {
+  for (int64_t tick = NextDueTick(); tick <= now; tick = NextDueTick()) {
+    now_ = tick;
+    ProcessTick();
+  }
+  now_ = std::max(now_, now);
+}
+
+TimerWheel::Entry* TimerWheel::PopExpired() {
+  Entry* e = expired_.next_;
+  if (e == &expired_) return nullptr;
+  Unlink(e);
+  --size_;
+  return e;
+}
+
+int64_t TimerWheel::NextDueTick() const {
+  int64_t next = kNever;
+  for (int level = 0; level < kLevels; ++level) {
+    if (occupied_[level] == 0) continue;
+    // The slots of `level` come due at multiples of its slot width, in order;
+    // find the first nonempty one after `now_`.
+    const int shift = kSlotBits * level;
+    const int64_t first = (now_ >> shift) + 1;
+    const int offset = absl::countr_zero(absl::rotr(
+        occupied_[level], static_cast<int>(first & (kSlots - 1))));
+    next = std::min(next, (first + offset) << shift);
+  }
+  return next;
+}
+
+}  // namespace synchronization_internal
+ABSL_NAMESPACE_END
+}  // namespace absl
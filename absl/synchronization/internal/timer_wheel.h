@@ -0,0 +1,129 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef ABSL_SYNCHRONIZATION_INTERNAL_TIMER_WHEEL_H_
+#define ABSL_SYNCHRONIZATION_INTERNAL_TIMER_WHEEL_H_
+
+// TimerWheel is a hierarchical timing wheel: a set of timers with deadlines
+// in integral ticks, which expires the timers whose deadlines have passed as
+// the wheel advances.
+//
+// Level 0 of the wheel has one slot per tick for the next kSlots ticks, and
+// each further level has slots kSlots times as wide. A timer is inserted into
+// the level whose slot width matches how far away its deadline is, and moves
+// down a level each time its slot comes due, so that inserting, removing and
+// expiring a timer all take constant time. Advancing skips over ticks at
+// which no slot comes due, so ticks may be short.
+//
+// Timers are intrusive, and are owned by the caller. TimerWheel uses no
+// internal locking; calls into it should be serialized externally.
+
+#include <cstdint>
+#include <limits>
+
+#include "absl/base/config.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+namespace synchronization_internal {
+
+class TimerWheel {
+ public:
+  static constexpr int kLevels = 6;
+  static constexpr int kSlotBits = 6;
+  static constexpr int kSlots = 1 << kSlotBits;
+  static constexpr int64_t kNever = (std::numeric_limits<int64_t>::max)();
+
+  // A timer, to be embedded in the caller's objects.
+  class Entry {
+   public:
+    Entry() = default;
+    Entry(const Entry&) = delete;
+    Entry& operator=(const Entry&) = delete;
+
+    // Whether the timer is in a wheel, either pending or expired.
+    bool linked() const { return next_ != nullptr; }
+    int64_t deadline() const { return deadline_; }
+
+   private:
+    friend class TimerWheel;
+
+    int64_t deadline_ = 0;
+    // Circular list of the slot, or of the expired timers.
+    Entry* prev_ = nullptr;
+    Entry* next_ = nullptr;
+    // Position in the wheel, or -1 for expired timers.
+    int level_ = -1;
+    int slot_ = 0;
+  };
+
+  // Creates an empty wheel whose current tick is `now`.
+  explicit TimerWheel(int64_t now);
+
+  TimerWheel(const TimerWheel&) = delete;
+  TimerWheel& operator=(const TimerWheel&) = delete;
+
+  // Returns the current tick.
+  int64_t now() const { return now_; }
+
+  // Inserts `e`, which must not be linked, to expire at tick `deadline`.
+  // Timers whose deadline is not after `now()` expire immediately.
+  void Insert(Entry* e, int64_t deadline);
+
+  // Removes `e`, which must be linked into this wheel, whether it is pending
+  // or expired.
+  void Remove(Entry* e);
+
+  // Advances the current tick to `now`, expiring the timers whose deadlines
+  // are at or before it. Does nothing if `now` is not after `now()`.
+  void Advance(int64_t now);
+
+  // Removes and returns an expired timer, or returns null if there is none.
+  Entry* PopExpired();
+
+  // Returns the first tick after `now()` at which `Advance()` may expire a
+  // timer, or kNever if no timer is pending. The tick may also be earlier
+  // than any deadline, when timers move down a level.
+  int64_t NextDueTick() const;
+
+  // Whether there are no timers, pending or expired.
+  bool empty() const { return size_ == 0; }
+
+ private:
+  static int64_t SlotWidth(int level) {
+    return int64_t{1} << (kSlotBits * level);
+  }
+
+  static void LinkBefore(Entry* e, Entry* head);
+  static void Unlink(Entry* e);
+
+  // Places `e` according to its deadline relative to `now_`.
+  void Place(Entry* e);
+  // Processes tick `now_`, which is a tick at which a slot comes due.
+  void ProcessTick();
+
+  int64_t now_;
+  int64_t size_ = 0;
+  // Bit i of occupied_[level] is set when slot i of the level is nonempty.
+  uint64_t occupied_[kLevels] = {};
+  Entry slots_[kLevels][kSlots];
+  Entry expired_;
+};
+
+}  // namespace synchronization_internal
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_SYNCHRONIZATION_INTERNAL_TIMER_WHEEL_H_
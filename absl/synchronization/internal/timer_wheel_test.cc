@@ -0,0 +1,172 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/synchronization/internal/timer_wheel.h"
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "absl/base/config.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+namespace synchronization_internal {
+namespace {
+
+// Advances `wheel` to `now`, and returns the deadlines of the timers that
+// expired.
+std::vector<int64_t> AdvanceAndPop(TimerWheel& wheel, int64_t now) {
+  wheel.Advance(now);
+  std::vector<int64_t> expired;
+  while (TimerWheel::Entry* e = wheel.PopExpired()) {
+    EXPECT_FALSE(e->linked());
+    expired.push_back(e->deadline());
+  }
+  return expired;
+}
+
+TEST(TimerWheelTest, Empty) {
+  TimerWheel wheel(100);
+  EXPECT_TRUE(wheel.empty());
+  EXPECT_EQ(wheel.now(), 100);
+  EXPECT_EQ(wheel.NextDueTick(), TimerWheel::kNever);
+  EXPECT_EQ(wheel.PopExpired(), nullptr);
+  wheel.Advance(1000);
+  EXPECT_EQ(wheel.now(), 1000);
+  wheel.Advance(500);
+  EXPECT_EQ(wheel.now(), 1000);
+}
+
+TEST(TimerWheelTest, PastDeadlineExpiresImmediately) {
+  TimerWheel wheel(100);
+  TimerWheel::Entry past, now;
+  wheel.Insert(&past, 5);
+  wheel.Insert(&now, 100);
+  EXPECT_FALSE(wheel.empty());
+  EXPECT_EQ(wheel.PopExpired(), &past);
+  EXPECT_EQ(wheel.PopExpired(), &now);
+  EXPECT_EQ(wheel.PopExpired(), nullptr);
+  EXPECT_TRUE(wheel.empty());
+}
+
+TEST(TimerWheelTest, ExpiresAtDeadline) {
+  TimerWheel wheel(0);
+  TimerWheel::Entry e;
+  wheel.Insert(&e, 10);
+  EXPECT_EQ(wheel.NextDueTick(), 10);
+  EXPECT_TRUE(AdvanceAndPop(wheel, 9).empty());
+  EXPECT_EQ(AdvanceAndPop(wheel, 10), std::vector<int64_t>{10});
+  EXPECT_TRUE(wheel.empty());
+}
+
+TEST(TimerWheelTest, Remove) {
+  TimerWheel wheel(0);
+  TimerWheel::Entry a, b, c;
+  wheel.Insert(&a, 10);
+  wheel.Insert(&b, 10);
+  wheel.Insert(&c, 100000);
+  wheel.Remove(&a);
+  EXPECT_FALSE(a.linked());
+  wheel.Remove(&c);
+  EXPECT_EQ(wheel.NextDueTick(), 10);
+  wheel.Remove(&b);
+  EXPECT_TRUE(wheel.empty());
+  EXPECT_EQ(wheel.NextDueTick(), TimerWheel::kNever);
+
+  // Expired timers may be removed too.
+  wheel.Insert(&a, 5);
+  wheel.Advance(5);
+  wheel.Remove(&a);
+  EXPECT_EQ(wheel.PopExpired(), nullptr);
+  EXPECT_TRUE(wheel.empty());
+}
+
+TEST(TimerWheelTest, CascadesThroughLevels) {
+  TimerWheel wheel(0);
+  // Deadlines on every level, including beyond the range of the top level.
+  std::vector<int64_t> deadlines = {1,
+                                   63,
+                                   64,
+                                   65,
+                                   4095,
+                                   4096,
+                                   4097,
+                                   262143,
+                                   262145,
+                                   16777217,
+                                   int64_t{1} << 30,
+                                   int64_t{1} << 36,
+                                   (int64_t{1} << 36) + 3,
+                                   int64_t{1} << 40};
+  std::vector<TimerWheel::Entry> entries(deadlines.size());
+  for (size_t i = 0; i < deadlines.size(); ++i) {
+    wheel.Insert(&entries[i], deadlines[i]);
+  }
+  for (int64_t deadline : deadlines) {
+    EXPECT_TRUE(AdvanceAndPop(wheel, deadline - 1).empty()) << deadline;
+    EXPECT_EQ(AdvanceAndPop(wheel, deadline), std::vector<int64_t>{deadline});
+  }
+  EXPECT_TRUE(wheel.empty());
+}
+
+TEST(TimerWheelTest, NextDueTickIsNotAfterDeadline) {
+  TimerWheel wheel(12345);
+  TimerWheel::Entry e;
+  wheel.Insert(&e, 12345 + 100000);
+  int64_t steps = 0;
+  while (wheel.PopExpired() == nullptr) {
+    const int64_t next = wheel.NextDueTick();
+    ASSERT_GT(next, wheel.now());
+    ASSERT_LE(next, e.deadline());
+    wheel.Advance(next);
+    ++steps;
+  }
+  EXPECT_EQ(wheel.now(), e.deadline());
+  // One step per level at most.
+  EXPECT_LE(steps, TimerWheel::kLevels);
+}
+
+TEST(TimerWheelTest, RandomDeadlines) {
+  std::mt19937_64 rng(42);
+  TimerWheel wheel(1000);
+  std::vector<TimerWheel::Entry> entries(2000);
+  for (auto& e : entries) {
+    wheel.Insert(&e, 1000 + static_cast<int64_t>(rng() % 5000000));
+  }
+  int64_t now = 1000;
+  size_t expired = 0;
+  while (!wheel.empty()) {
+    now += static_cast<int64_t>(rng() % 20000);
+    wheel.Advance(now);
+    while (TimerWheel::Entry* e = wheel.PopExpired()) {
+      // Expiry is exact, since we advance through every due tick.
+      ASSERT_LE(e->deadline(), now);
+      ASSERT_GT(e->deadline(), now - 20000);
+      ++expired;
+    }
+    for (const auto& e : entries) {
+      if (e.linked()) {
+        ASSERT_GT(e.deadline(), now);
+      }
+    }
+  }
+  EXPECT_EQ(expired, entries.size());
+}
+
+}  // namespace
+}  // namespace synchronization_internal
+ABSL_NAMESPACE_END
+}  // namespace absl
@@ -42,6 +42,7 @@
 #include <algorithm>
 #include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <cstring>
 #include <thread>  // NOLINT(build/c++11)
@@ -87,6 +88,12 @@ ABSL_ATTRIBUTE_WEAK void ABSL_INTERNAL_C_SYMBOL(AbslInternalMutexYield)() {
 namespace absl {
 ABSL_NAMESPACE_BEGIN
 
+namespace synchronization_internal {
+
+ABSL_CONST_INIT std::atomic<bool> mutex_deadlock_graph_sampled(false);
+
+}  // namespace synchronization_internal
+
 namespace {
 
 #if defined(ABSL_HAVE_THREAD_SANITIZER)
@@ -97,11 +104,23 @@ constexpr OnDeadlockCycle kDeadlockDetectionDefault = OnDeadlockCycle::kAbort;
 
 ABSL_CONST_INIT std::atomic<OnDeadlockCycle> synch_deadlock_detection(
     kDeadlockDetectionDefault);
+// One in this many critical sections is tracked by sampled deadlock
+// detection, or none if 0; see SetMutexDeadlockDetectionSampleRate().
+ABSL_CONST_INIT std::atomic<int> synch_deadlock_sample_rate(0);
+// Changed along with the sample rate, so that threads discard the state they
+// gathered before.
+ABSL_CONST_INIT std::atomic<uint32_t> synch_deadlock_sample_generation(0);
 ABSL_CONST_INIT std::atomic<bool> synch_check_invariants(false);
 
 ABSL_INTERNAL_ATOMIC_HOOK_ATTRIBUTES
 absl::base_internal::AtomicHook<void (*)(int64_t wait_cycles)>
     submit_profile_data;
+ABSL_INTERNAL_ATOMIC_HOOK_ATTRIBUTES absl::base_internal::AtomicHook<void (*)(
+    const void* mu, int64_t wait_cycles)>
+    contended_lock_hook;
+ABSL_INTERNAL_ATOMIC_HOOK_ATTRIBUTES absl::base_internal::AtomicHook<void (*)(
+    const void* mu, int64_t wait_cycles)>
+    contended_unlock_hook;
 ABSL_INTERNAL_ATOMIC_HOOK_ATTRIBUTES absl::base_internal::AtomicHook<void (*)(
     const char* msg, const void* obj, int64_t wait_cycles)>
     mutex_tracer;
@@ -119,6 +138,13 @@ void RegisterMutexProfiler(void (*fn)(int64_t wait_cycles)) {
   submit_profile_data.Store(fn);
 }
 
+void RegisterMutexContentionHooks(
+    void (*on_contended_lock)(const void* mu, int64_t wait_cycles),
+    void (*on_contended_unlock)(const void* mu, int64_t wait_cycles)) {
+  contended_lock_hook.Store(on_contended_lock);
+  contended_unlock_hook.Store(on_contended_unlock);
+}
+
 void RegisterMutexTracer(void (*fn)(const char* msg, const void* obj,
                                     int64_t wait_cycles)) {
   mutex_tracer.Store(fn);
@@ -140,6 +166,11 @@ struct ABSL_CACHELINE_ALIGNED MutexGlobals {
   std::atomic<int> spinloop_iterations{0};
   int32_t mutex_sleep_spins[2] = {};
   absl::Duration mutex_sleep_time;
+  // Contended Lock() calls that wait less than `short_wait_cycles` after
+  // spinning make their Mutex spin longer, and those that wait more than
+  // `long_wait_cycles` make it spin less. See AdaptSpinLimit().
+  int64_t short_wait_cycles = 0;
+  int64_t long_wait_cycles = 0;
 };
 
 ABSL_CONST_INIT static MutexGlobals globals;
@@ -173,6 +204,11 @@ const MutexGlobals& GetMutexGlobals() {
       globals.mutex_sleep_time =
           std::max(globals.mutex_sleep_time, absl::Microseconds(10));
     }
+    // Blocking and being woken again takes several microseconds, so waits
+    // much shorter than that are better spent spinning.
+    const double cycles_per_us = CycleClock::Frequency() / 1e6;
+    globals.short_wait_cycles = static_cast<int64_t>(10 * cycles_per_us);
+    globals.long_wait_cycles = static_cast<int64_t>(100 * cycles_per_us);
   });
   return globals;
 }
@@ -238,6 +274,50 @@ ABSL_CONST_INIT static absl::base_internal::SpinLock deadlock_graph_mu(
 ABSL_CONST_INIT static GraphCycles* deadlock_graph
     ABSL_GUARDED_BY(deadlock_graph_mu) ABSL_PT_GUARDED_BY(deadlock_graph_mu);
 
+// The number of deadlock_graph nodes whose Mutex hashes to each slot.  They
+// are updated under deadlock_graph_mu and read without it, so that destroying
+// a Mutex takes deadlock_graph_mu only if the Mutex may be in the graph.
+static constexpr int kDeadlockGraphSlots = 1024;
+ABSL_CONST_INIT static std::atomic<uint32_t>
+    deadlock_graph_slot_nodes[kDeadlockGraphSlots] = {};
+
+static std::atomic<uint32_t>& DeadlockGraphSlot(const Mutex* mu) {
+  // Mutexes laid out next to each other fall in different slots.
+  const uintptr_t index = reinterpret_cast<uintptr_t>(mu) / sizeof(Mutex);
+  return deadlock_graph_slot_nodes[index % kDeadlockGraphSlots];
+}
+
+namespace {
+
+// The state of a thread for sampled deadlock detection.  Once one of its
+// acquisitions is sampled, the thread tracks the locks it holds until it has
+// released them all, and buffers the acquired-before edges among them, to be
+// inserted into deadlock_graph in one batch before it releases any of them.
+// Only the thread itself accesses it, so tracking takes no locks.
+struct SampledLockOrder {
+  static constexpr int kMaxHeld = 16;
+  static constexpr int kMaxEdges = 16;
+
+  // The value of synch_deadlock_sample_generation the state was gathered at.
+  uint32_t generation;
+  // State of the random number generator that spaces sampled acquisitions.
+  uint32_t rng;
+  // Acquisitions before the next sampled one, while no lock is tracked.
+  int countdown;
+  // The tracked locks held by the thread, in the order they were acquired.
+  int depth;
+  Mutex* held[kMaxHeld];
+  // Edges yet to be inserted into deadlock_graph.
+  int num_edges;
+  struct Edge {
+    Mutex* from;
+    Mutex* to;
+  } edges[kMaxEdges];
+};
+ABSL_CONST_INIT thread_local SampledLockOrder sampled_lock_order = {};
+
+}  // namespace
+
 //------------------------------------------------------------------
 // An event mechanism for debugging mutex use.
 // It also allows mutexes to be given names for those who can't handle
@@ -753,7 +833,8 @@ Mutex::~Mutex() { Dtor(); }
 
 #if !defined(NDEBUG) || defined(ABSL_HAVE_THREAD_SANITIZER)
 void Mutex::Dtor() {
-  if (kDebugMode) {
+  if (kDebugMode || synchronization_internal::mutex_deadlock_graph_sampled.load(
+                        std::memory_order_relaxed)) {
     this->ForgetDeadlockInfo();
   }
   ABSL_TSAN_MUTEX_DESTROY(this, __tsan_mutex_not_static);
@@ -803,6 +884,12 @@ void SetMutexDeadlockDetectionMode(OnDeadlockCycle mode) {
   synch_deadlock_detection.store(mode, std::memory_order_release);
 }
 
+void SetMutexDeadlockDetectionSampleRate(int rate) {
+  synch_deadlock_sample_generation.fetch_add(1, std::memory_order_release);
+  synch_deadlock_sample_rate.store(rate > 0 ? rate : 0,
+                                   std::memory_order_release);
+}
+
 // Return true iff threads x and y are part of the same equivalence
 // class of waiters. An equivalence class is defined as the set of
 // waiters with the same condition, type of lock, and thread priority.
@@ -1225,6 +1312,11 @@ static GraphId GetGraphIdLocked(Mutex* mu)
         new (base_internal::LowLevelAlloc::Alloc(sizeof(*deadlock_graph)))
             GraphCycles;
   }
+  if (!deadlock_graph->HasId(mu)) {
+    std::atomic<uint32_t>& slot = DeadlockGraphSlot(mu);
+    slot.store(slot.load(std::memory_order_relaxed) + 1,
+               std::memory_order_relaxed);
+  }
   return deadlock_graph->GetId(mu);
 }
 
@@ -1297,33 +1389,69 @@ static void LockLeave(Mutex* mu, GraphId id, SynchLocksHeld* held_locks) {
   }
 }
 
+static void SampledLockEnterSlow(Mutex* mu, bool may_block);
+static void SampledLockLeaveSlow(Mutex* mu);
+
+// Record a lock acquisition for sampled deadlock detection.  `may_block` is
+// whether the acquisition could have blocked, in which case the tracked locks
+// held by the thread are recorded as acquired before mu.  The common case of
+// an acquisition that is not sampled while no lock is tracked is inline.
+static inline void SampledLockEnter(Mutex* mu, bool may_block) {
+  if (ABSL_PREDICT_TRUE(synch_deadlock_sample_rate.load(
+                            std::memory_order_relaxed) == 0)) {
+    return;
+  }
+  SampledLockOrder& s = sampled_lock_order;
+  if (s.depth == 0 && --s.countdown > 0) return;
+  SampledLockEnterSlow(mu, may_block);
+}
+
+// Record a lock release for sampled deadlock detection.
+static inline void SampledLockLeave(Mutex* mu) {
+  if (ABSL_PREDICT_TRUE(synch_deadlock_sample_rate.load(
+                            std::memory_order_relaxed) == 0) ||
+      sampled_lock_order.depth == 0) {
+    return;
+  }
+  SampledLockLeaveSlow(mu);
+}
+
 // Call LockEnter() if in debug mode and deadlock detection is enabled.
+// Otherwise, record the acquisition for sampled deadlock detection.
 static inline void DebugOnlyLockEnter(Mutex* mu) {
   if (kDebugMode) {
     if (synch_deadlock_detection.load(std::memory_order_acquire) !=
         OnDeadlockCycle::kIgnore) {
       LockEnter(mu, GetGraphId(mu), Synch_GetAllLocks());
     }
+  } else {
+    SampledLockEnter(mu, /*may_block=*/false);
   }
 }
 
 // Call LockEnter() if in debug mode and deadlock detection is enabled.
+// Otherwise, record the acquisition for sampled deadlock detection.
 static inline void DebugOnlyLockEnter(Mutex* mu, GraphId id) {
   if (kDebugMode) {
     if (synch_deadlock_detection.load(std::memory_order_acquire) !=
         OnDeadlockCycle::kIgnore) {
       LockEnter(mu, id, Synch_GetAllLocks());
     }
+  } else {
+    SampledLockEnter(mu, /*may_block=*/true);
   }
 }
 
 // Call LockLeave() if in debug mode and deadlock detection is enabled.
+// Otherwise, record the release for sampled deadlock detection.
 static inline void DebugOnlyLockLeave(Mutex* mu) {
   if (kDebugMode) {
     if (synch_deadlock_detection.load(std::memory_order_acquire) !=
         OnDeadlockCycle::kIgnore) {
       LockLeave(mu, GetGraphId(mu), Synch_GetAllLocks());
     }
+  } else {
+    SampledLockLeave(mu);
   }
 }
 
@@ -1382,6 +1510,55 @@ int GetStack(void** stack, int max_depth) {
 }
 }  // anonymous namespace
 
+// Report the cycle in deadlock_graph that the acquired-before edge from
+// other_id to mu_id would close.  The report starts with `title` and the
+// current stack, then says that mu was `acquiring` ("Acquiring" or "Acquired")
+// while holding the num_held locks with ids held_id(0), held_id(1), ...
+template <typename HeldIdFn>
+static void ReportDeadlockCycle(Mutex* mu, GraphId mu_id, GraphId other_id,
+                                int num_held, HeldIdFn held_id,
+                                const char* title, const char* acquiring)
+    ABSL_EXCLUSIVE_LOCKS_REQUIRED(deadlock_graph_mu) {
+  ScopedDeadlockReportBuffers scoped_buffers;
+  DeadlockReportBuffers* b = scoped_buffers.b;
+  static int number_of_reported_deadlocks = 0;
+  number_of_reported_deadlocks++;
+  // Symbolize only 2 first deadlock report to avoid huge slowdowns.
+  bool symbolize = number_of_reported_deadlocks <= 2;
+  ABSL_RAW_LOG(ERROR, "%s: %s", title,
+               CurrentStackString(b->buf, sizeof (b->buf), symbolize));
+  size_t len = 0;
+  for (int j = 0; j != num_held; j++) {
+    void* pr = deadlock_graph->Ptr(held_id(j));
+    if (pr != nullptr) {
+      snprintf(b->buf + len, sizeof(b->buf) - len, " %p", pr);
+      len += strlen(&b->buf[len]);
+    }
+  }
+  ABSL_RAW_LOG(ERROR,
+               "%s absl::Mutex %p while holding %s; a cycle in the "
+               "historical lock ordering graph has been observed",
+               acquiring, static_cast<void*>(mu), b->buf);
+  ABSL_RAW_LOG(ERROR, "Cycle: ");
+  int path_len = deadlock_graph->FindPath(mu_id, other_id,
+                                          ABSL_ARRAYSIZE(b->path), b->path);
+  for (int j = 0; j != path_len && j != ABSL_ARRAYSIZE(b->path); j++) {
+    GraphId id = b->path[j];
+    Mutex* path_mu = static_cast<Mutex*>(deadlock_graph->Ptr(id));
+    if (path_mu == nullptr) continue;
+    void** stack;
+    int depth = deadlock_graph->GetStackTrace(id, &stack);
+    snprintf(b->buf, sizeof(b->buf),
+             "mutex@%p stack: ", static_cast<void*>(path_mu));
+    StackString(stack, depth, b->buf + strlen(b->buf),
+                static_cast<int>(sizeof(b->buf) - strlen(b->buf)), symbolize);
+    ABSL_RAW_LOG(ERROR, "%s", b->buf);
+  }
+  if (path_len > static_cast<int>(ABSL_ARRAYSIZE(b->path))) {
+    ABSL_RAW_LOG(ERROR, "(long cycle; list truncated)");
+  }
+}
+
 // Called in debug mode when a thread is about to acquire a lock in a way that
 // may block.
 static GraphId DeadlockCheck(Mutex* mu) {
@@ -1421,45 +1598,9 @@ static GraphId DeadlockCheck(Mutex* mu) {
 
     // Add the acquired-before edge to the graph.
     if (!deadlock_graph->InsertEdge(other_node_id, mu_id)) {
-      ScopedDeadlockReportBuffers scoped_buffers;
-      DeadlockReportBuffers* b = scoped_buffers.b;
-      static int number_of_reported_deadlocks = 0;
-      number_of_reported_deadlocks++;
-      // Symbolize only 2 first deadlock report to avoid huge slowdowns.
-      bool symbolize = number_of_reported_deadlocks <= 2;
-      ABSL_RAW_LOG(ERROR, "Potential Mutex deadlock: %s",
-                   CurrentStackString(b->buf, sizeof (b->buf), symbolize));
-      size_t len = 0;
-      for (int j = 0; j != all_locks->n; j++) {
-        void* pr = deadlock_graph->Ptr(all_locks->locks[j].id);
-        if (pr != nullptr) {
-          snprintf(b->buf + len, sizeof(b->buf) - len, " %p", pr);
-          len += strlen(&b->buf[len]);
-        }
-      }
-      ABSL_RAW_LOG(ERROR,
-                   "Acquiring absl::Mutex %p while holding %s; a cycle in the "
-                   "historical lock ordering graph has been observed",
-                   static_cast<void*>(mu), b->buf);
-      ABSL_RAW_LOG(ERROR, "Cycle: ");
-      int path_len = deadlock_graph->FindPath(mu_id, other_node_id,
-                                              ABSL_ARRAYSIZE(b->path), b->path);
-      for (int j = 0; j != path_len && j != ABSL_ARRAYSIZE(b->path); j++) {
-        GraphId id = b->path[j];
-        Mutex* path_mu = static_cast<Mutex*>(deadlock_graph->Ptr(id));
-        if (path_mu == nullptr) continue;
-        void** stack;
-        int depth = deadlock_graph->GetStackTrace(id, &stack);
-        snprintf(b->buf, sizeof(b->buf),
-                 "mutex@%p stack: ", static_cast<void*>(path_mu));
-        StackString(stack, depth, b->buf + strlen(b->buf),
-                    static_cast<int>(sizeof(b->buf) - strlen(b->buf)),
-                    symbolize);
-        ABSL_RAW_LOG(ERROR, "%s", b->buf);
-      }
-      if (path_len > static_cast<int>(ABSL_ARRAYSIZE(b->path))) {
-        ABSL_RAW_LOG(ERROR, "(long cycle; list truncated)");
-      }
+      ReportDeadlockCycle(mu, mu_id, other_node_id, all_locks->n,
+                          [all_locks](int j) { return all_locks->locks[j].id; },
+                          "Potential Mutex deadlock", "Acquiring");
       if (synch_deadlock_detection.load(std::memory_order_acquire) ==
           OnDeadlockCycle::kAbort) {
         deadlock_graph_mu.Unlock();  // avoid deadlock in fatal sighandler
@@ -1484,12 +1625,147 @@ static inline GraphId DebugOnlyDeadlockCheck(Mutex* mu) {
   }
 }
 
+// Return a random number of acquisitions to skip before the next sampled one,
+// averaging `rate`.
+static int NextSampleCountdown(SampledLockOrder& s, int rate) {
+  if (rate <= 1) return 1;
+  if (s.rng == 0) {
+    // The address of a thread-local seeds a generator per thread.
+    const uintptr_t seed = reinterpret_cast<uintptr_t>(&s);
+    s.rng = static_cast<uint32_t>(seed ^ (seed >> 32)) | 1;
+  }
+  s.rng ^= s.rng << 13;  // xorshift32
+  s.rng ^= s.rng >> 17;
+  s.rng ^= s.rng << 5;
+  return 1 + static_cast<int>(s.rng % (2 * static_cast<uint32_t>(rate) - 1));
+}
+
+// Insert the buffered edges of s into deadlock_graph, reporting the first
+// one that would close a cycle.
+static void FlushSampledEdges(SampledLockOrder& s) {
+  const int num_edges = s.num_edges;
+  s.num_edges = 0;
+  if (synch_deadlock_detection.load(std::memory_order_acquire) ==
+      OnDeadlockCycle::kIgnore) {
+    return;
+  }
+  absl::base_internal::SpinLockHolder lock(&deadlock_graph_mu);
+  // From now on, destroyed mutexes check whether they are in deadlock_graph.
+  // The edges name only locks that this thread holds, so each is destroyed
+  // after this store.
+  if (!synchronization_internal::mutex_deadlock_graph_sampled.load(
+          std::memory_order_relaxed)) {
+    synchronization_internal::mutex_deadlock_graph_sampled.store(
+        true, std::memory_order_relaxed);
+  }
+  for (int i = 0; i != num_edges; i++) {
+    Mutex* mu = s.edges[i].to;
+    const GraphId other_id = GetGraphIdLocked(s.edges[i].from);
+    const GraphId mu_id = GetGraphIdLocked(mu);
+    if (deadlock_graph->HasEdge(other_id, mu_id)) continue;
+    if (deadlock_graph->InsertEdge(other_id, mu_id)) {
+      // The stack of the acquisition is gone; keep that of the end of the
+      // section, which is usually in the function that began it.
+      deadlock_graph->UpdateStackTrace(mu_id, 1, GetStack);
+    } else {
+      ReportDeadlockCycle(
+          mu, mu_id, other_id, 1, [other_id](int) { return other_id; },
+          "Potential Mutex deadlock in a sampled critical section ending",
+          "Acquired");
+      if (synch_deadlock_detection.load(std::memory_order_acquire) ==
+          OnDeadlockCycle::kAbort) {
+        deadlock_graph_mu.Unlock();  // avoid deadlock in fatal sighandler
+        ABSL_RAW_LOG(FATAL, "dying due to potential deadlock");
+        return;
+      }
+      break;  // report at most one potential deadlock per batch
+    }
+  }
+}
+
+// Discard the state s gathered, if the sample rate changed since.  Return
+// whether it did.
+static bool ResetStaleSampledLockOrder(SampledLockOrder& s) {
+  const uint32_t generation =
+      synch_deadlock_sample_generation.load(std::memory_order_acquire);
+  if (s.generation == generation) return false;
+  s.generation = generation;
+  s.depth = 0;
+  s.num_edges = 0;
+  s.countdown = NextSampleCountdown(
+      s, synch_deadlock_sample_rate.load(std::memory_order_relaxed));
+  return true;
+}
+
+static void SampledLockEnterSlow(Mutex* mu, bool may_block) {
+  SampledLockOrder& s = sampled_lock_order;
+  if (ResetStaleSampledLockOrder(s)) {
+    if (--s.countdown > 0) return;
+  }
+  if (s.depth == 0) {
+    // The acquisition is sampled, and starts a tracked critical section.
+    s.countdown = NextSampleCountdown(
+        s, synch_deadlock_sample_rate.load(std::memory_order_relaxed));
+    if (synch_deadlock_detection.load(std::memory_order_acquire) ==
+        OnDeadlockCycle::kIgnore) {
+      return;
+    }
+  } else if (may_block) {
+    // Buffer an edge to mu from each tracked lock, unless already buffered.
+    for (int i = 0; i != s.depth; i++) {
+      Mutex* held = s.held[i];
+      if (held == mu) continue;
+      int j = 0;
+      while (j != s.num_edges &&
+             (s.edges[j].from != held || s.edges[j].to != mu)) {
+        j++;
+      }
+      if (j != s.num_edges) continue;
+      if (s.num_edges == SampledLockOrder::kMaxEdges) {
+        FlushSampledEdges(s);
+      }
+      s.edges[s.num_edges].from = held;
+      s.edges[s.num_edges].to = mu;
+      s.num_edges++;
+    }
+  }
+  if (s.depth != SampledLockOrder::kMaxHeld) {
+    s.held[s.depth++] = mu;
+  }
+}
+
+static void SampledLockLeaveSlow(Mutex* mu) {
+  SampledLockOrder& s = sampled_lock_order;
+  if (ResetStaleSampledLockOrder(s)) return;
+  // Insert the buffered edges before mu is released.  Destroyed mutexes leave
+  // deadlock_graph, so the edges must be inserted while none of the locks they
+  // name can have been destroyed.  This takes deadlock_graph_mu once per run of
+  // nested acquisitions.
+  if (s.num_edges != 0) {
+    FlushSampledEdges(s);
+  }
+  int i = s.depth;
+  while (i != 0 && s.held[i - 1] != mu) {
+    i--;
+  }
+  if (i == 0) return;  // mu was acquired before the section was sampled
+  for (; i != s.depth; i++) {
+    s.held[i - 1] = s.held[i];
+  }
+  s.depth--;
+}
+
 void Mutex::ForgetDeadlockInfo() {
-  if (kDebugMode && synch_deadlock_detection.load(std::memory_order_acquire) !=
-                        OnDeadlockCycle::kIgnore) {
+  // A Mutex enters deadlock_graph only in a call on it, which happens before
+  // its destruction, so by then the count of its slot includes it.
+  std::atomic<uint32_t>& slot = DeadlockGraphSlot(this);
+  if (slot.load(std::memory_order_relaxed) != 0 &&
+      synch_deadlock_detection.load(std::memory_order_acquire) !=
+          OnDeadlockCycle::kIgnore) {
     deadlock_graph_mu.Lock();
-    if (deadlock_graph != nullptr) {
-      deadlock_graph->RemoveNode(this);
+    if (deadlock_graph != nullptr && deadlock_graph->RemoveNode(this)) {
+      slot.store(slot.load(std::memory_order_relaxed) - 1,
+                 std::memory_order_relaxed);
     }
     deadlock_graph_mu.Unlock();
   }
@@ -1515,10 +1791,53 @@ void Mutex::AssertNotHeld() const {
   }
 }
 
+// How long Lock() should spin before blocking depends on how long the Mutex
+// is usually held: spinning through short critical sections avoids the cost
+// of blocking and being woken, while spinning on a Mutex that is held for
+// long only burns CPU time. A Mutex has no room for statistics of its own, so
+// spin limits are kept in a table indexed by a hash of the Mutex address, and
+// shared by Mutexes that collide. A zero entry means that the default
+// `globals.spinloop_iterations` applies.
+static constexpr int kMinSpinLoopIterations = 16;
+static constexpr int kMaxSpinLoopIterations = 1 << 13;
+static constexpr size_t kNumSpinLimits = 1024;
+ABSL_CONST_INIT static std::atomic<int> spin_limits[kNumSpinLimits] = {};
+
+static std::atomic<int>& SpinLimitFor(const std::atomic<intptr_t>* mu) {
+  const uintptr_t addr = reinterpret_cast<uintptr_t>(mu);
+  return spin_limits[((addr >> 3) ^ (addr >> 13)) % kNumSpinLimits];
+}
+
+// Called when a Lock() of *mu gave up spinning and then waited `wait_cycles`
+// in the slow path. Doubles the spin limit of *mu if the Mutex was released
+// soon after, and halves it if the wait was long enough that spinning could
+// not have helped.
+static void AdaptSpinLimit(const std::atomic<intptr_t>* mu,
+                           int64_t wait_cycles) {
+  const MutexGlobals& g = GetMutexGlobals();
+  std::atomic<int>& slot = SpinLimitFor(mu);
+  int limit = slot.load(std::memory_order_relaxed);
+  if (limit == 0) {
+    limit = globals.spinloop_iterations.load(std::memory_order_relaxed);
+  }
+  int new_limit = limit;
+  if (wait_cycles < g.short_wait_cycles) {
+    new_limit = std::min(limit * 2, kMaxSpinLoopIterations);
+  } else if (wait_cycles > g.long_wait_cycles) {
+    new_limit = std::max(limit / 2, kMinSpinLoopIterations);
+  }
+  // Concurrent updates may be lost, which only delays adaptation.
+  if (new_limit != limit) slot.store(new_limit, std::memory_order_relaxed);
+}
+
 // Attempt to acquire *mu, and return whether successful.  The implementation
 // may spin for a short while if the lock cannot be acquired immediately.
 static bool TryAcquireWithSpinning(std::atomic<intptr_t>* mu) {
   int c = globals.spinloop_iterations.load(std::memory_order_relaxed);
+  if (c > 0) {
+    const int limit = SpinLimitFor(mu).load(std::memory_order_relaxed);
+    if (limit != 0) c = limit;
+  }
   do {  // do/while somewhat faster on AMD
     intptr_t v = mu->load(std::memory_order_relaxed);
     if ((v & (kMuReader | kMuEvent)) != 0) {
@@ -1850,9 +2169,18 @@ ABSL_ATTRIBUTE_NOINLINE void Mutex::LockSlow(MuHow how, const Condition* cond,
       globals.spinloop_iterations.store(-1, std::memory_order_relaxed);
     }
   }
+  // A plain Lock() only gets here after spinning failed. Measure how long it
+  // still waits, to tune how long Lock() spins on this Mutex.
+  const bool adapt_spinning =
+      how == kExclusive && cond == nullptr && flags == 0 &&
+      globals.spinloop_iterations.load(std::memory_order_relaxed) > 0;
+  const int64_t start_cycles = adapt_spinning ? CycleClock::Now() : 0;
   ABSL_RAW_CHECK(
       this->LockSlowWithDeadline(how, cond, KernelTimeout::Never(), flags),
       "condition untrue on return from LockSlow");
+  if (adapt_spinning) {
+    AdaptSpinLimit(&this->mu_, CycleClock::Now() - start_cycles);
+  }
 }
 
 // Compute cond->Eval() and tell race detectors that we do it under mutex mu.
@@ -1959,7 +2287,13 @@ bool Mutex::LockSlowWithDeadline(MuHow how, const Condition* cond,
     this->Block(waitp.thread);
     flags |= kMuHasBlocked;
   }
+  const int64_t contention_start_cycles = waitp.contention_start_cycles;
   this->LockSlowLoop(&waitp, flags);
+  if (waitp.should_submit_contention_data) {
+    ABSL_TSAN_MUTEX_PRE_DIVERT(this, 0);
+    contended_lock_hook(this, CycleClock::Now() - contention_start_cycles);
+    ABSL_TSAN_MUTEX_POST_DIVERT(this, 0);
+  }
   return waitp.cond != nullptr ||  // => cond known true from LockSlowLoop
          cond == nullptr ||
          EvalConditionAnnotated(cond, this, true, false, how == kShared);
@@ -2420,6 +2754,7 @@ ABSL_ATTRIBUTE_NOINLINE void Mutex::UnlockSlow(SynchWaitParams* waitp) {
       mutex_tracer("slow release", this, total_wait_cycles);
       ABSL_TSAN_MUTEX_PRE_DIVERT(this, 0);
       submit_profile_data(total_wait_cycles);
+      contended_unlock_hook(this, total_wait_cycles);
       ABSL_TSAN_MUTEX_POST_DIVERT(this, 0);
     }
   }
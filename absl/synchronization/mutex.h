@@ -71,6 +71,7 @@
 #include "absl/base/internal/thread_identity.h"
 #include "absl/base/internal/tsan_mutex_interface.h"
 #include "absl/base/nullability.h"
+#include "absl/base/optimization.h"
 #include "absl/base/port.h"
 #include "absl/base/thread_annotations.h"
 #include "absl/synchronization/internal/kernel_timeout.h"
@@ -468,8 +469,10 @@ class ABSL_LOCKABLE ABSL_ATTRIBUTE_WARN_UNUSED Mutex {
   // Mutex::ForgetDeadlockInfo()
   //
   // Forget any deadlock-detection information previously gathered
-  // about this `Mutex`. Call this method in debug mode when the lock ordering
-  // of a `Mutex` changes.
+  // about this `Mutex`. Call this method in debug mode, or when sampled
+  // deadlock detection is enabled, when the lock ordering of a `Mutex`
+  // changes. Destroying a `Mutex` forgets it too. See
+  // `SetMutexDeadlockDetectionSampleRate()`.
   void ForgetDeadlockInfo();
 
   // Mutex::AssertNotHeld()
@@ -1103,14 +1106,29 @@ ABSL_ATTRIBUTE_ALWAYS_INLINE
 inline Mutex::~Mutex() { Dtor(); }
 #endif
 
+namespace synchronization_internal {
+
+// Set once sampled deadlock detection has added a `Mutex` to the lock ordering
+// graph, after which a destroyed `Mutex` checks whether it must leave it.
+ABSL_CONST_INIT ABSL_DLL extern std::atomic<bool> mutex_deadlock_graph_sampled;
+
+}  // namespace synchronization_internal
+
 #if defined(NDEBUG) && !defined(ABSL_HAVE_THREAD_SANITIZER)
-// Use default (empty) destructor in release build for performance reasons.
+// Use a trivial destructor in release build for performance reasons: it only
+// looks for the `Mutex` in the lock ordering graph if sampled deadlock
+// detection has used the graph.
 // We need to mark both Dtor and ~Mutex as always inline for inconsistent
 // builds that use both NDEBUG and !NDEBUG with dynamic libraries. In these
-// cases we want the empty functions to dissolve entirely rather than being
-// exported from dynamic libraries and potentially override the non-empty ones.
+// cases we want the release functions to dissolve entirely rather than being
+// exported from dynamic libraries and potentially override the debug ones.
 ABSL_ATTRIBUTE_ALWAYS_INLINE
-inline void Mutex::Dtor() {}
+inline void Mutex::Dtor() {
+  if (ABSL_PREDICT_FALSE(synchronization_internal::mutex_deadlock_graph_sampled
+                             .load(std::memory_order_relaxed))) {
+    ForgetDeadlockInfo();
+  }
+}
 #endif
 
 inline CondVar::CondVar() : cv_(0) {}
@@ -1186,6 +1204,23 @@ inline Condition::Condition(
 // mode.)
 void RegisterMutexProfiler(void (*absl_nonnull fn)(int64_t wait_cycles));
 
+// Register hooks for contention profiling with context.
+//
+// `on_contended_lock` is called by a thread that acquired the mutex `mu` after
+// blocking on it, while holding `mu`, with the cycles it waited in total.
+// `on_contended_unlock` is called by a thread that released `mu` to blocked
+// waiters, after releasing it, with the cycles those waiters have waited. The
+// hooks may capture the calling thread's stack to attribute contention to
+// waiters and holders, but must not acquire `mu`.
+//
+// This has the same ordering and single-use limitations as
+// RegisterMutexProfiler() above.
+void RegisterMutexContentionHooks(
+    void (*absl_nonnull on_contended_lock)(const void* absl_nonnull mu,
+                                           int64_t wait_cycles),
+    void (*absl_nonnull on_contended_unlock)(const void* absl_nonnull mu,
+                                             int64_t wait_cycles));
+
 // Register a hook for Mutex tracing.
 //
 // The function pointer registered here will be called whenever a mutex is
@@ -1244,6 +1279,25 @@ enum class OnDeadlockCycle {
 // the manner chosen here.
 void SetMutexDeadlockDetectionMode(OnDeadlockCycle mode);
 
+// SetMutexDeadlockDetectionSampleRate()
+//
+// Enables sampled detection of lock ordering inversions in builds other than
+// debug builds, which track every acquisition, if `rate` is positive, and
+// disables it otherwise. Disabled by default.
+//
+// A thread samples one in about `rate` of its `Mutex` acquisitions. From a
+// sampled acquisition until it has released the locks it acquired since, the
+// thread records which of them it acquired while holding which others, and
+// adds these orderings to the lock ordering graph as it releases them. Cycles
+// are reported in the manner set by
+// `SetMutexDeadlockDetectionMode()`, and `OnDeadlockCycle::kIgnore` disables
+// sampling. Acquisitions that are not sampled cost a thread-local decrement,
+// so that this mode can stay enabled in production; an ordering that occurs
+// often is recorded soon, at rates up to a few thousand. Destroying a `Mutex`
+// that may be in the graph takes a global lock to remove it, as in debug
+// builds; other `Mutex` destructions check a table of counts without locking.
+void SetMutexDeadlockDetectionSampleRate(int rate);
+
 ABSL_NAMESPACE_END
 }  // namespace absl
 
@@ -21,6 +21,7 @@
 #include "absl/base/internal/cycleclock.h"
 #include "absl/base/internal/spinlock.h"
 #include "absl/base/no_destructor.h"
+#include "absl/base/thread_annotations.h"
 #include "absl/synchronization/blocking_counter.h"
 #include "absl/synchronization/internal/thread_pool.h"
 #include "absl/synchronization/mutex.h"
@@ -63,6 +64,25 @@ void BM_ReaderTryLock(benchmark::State& state) {
 }
 BENCHMARK(BM_ReaderTryLock)->UseRealTime()->Threads(1)->ThreadPerCpu();
 
+// Acquires and releases `depth` nested mutexes, with deadlock detection
+// sampling one in `sample_rate` acquisitions, or none if 0. Debug builds
+// track every acquisition regardless.
+void BM_MutexDeadlockDetection(benchmark::State& state)
+    ABSL_NO_THREAD_SAFETY_ANALYSIS {
+  const int depth = static_cast<int>(state.range(0));
+  absl::SetMutexDeadlockDetectionSampleRate(static_cast<int>(state.range(1)));
+  std::vector<absl::Mutex> mu(static_cast<size_t>(depth));
+  for (auto _ : state) {
+    for (int i = 0; i < depth; i++) mu[i].Lock();
+    for (int i = depth - 1; i >= 0; i--) mu[i].Unlock();
+  }
+  absl::SetMutexDeadlockDetectionSampleRate(0);
+  state.SetItemsProcessed(state.iterations() * depth);
+}
+BENCHMARK(BM_MutexDeadlockDetection)
+    ->ArgNames({"depth", "sample_rate"})
+    ->ArgsProduct({{1, 2, 4}, {0, 1, 100, 1000}});
+
 static void DelayNs(int64_t ns, int* data) {
   int64_t end = absl::base_internal::CycleClock::Now() +
                 ns * absl::base_internal::CycleClock::Frequency() / 1e9;
@@ -276,6 +296,57 @@ BENCHMARK_TEMPLATE(BM_Contended, std::mutex)
       SetupBenchmarkArgs(bm, /*do_test_priorities=*/false);
     });
 
+// Short and long critical sections at 2 to 128 threads. Waiters on a short
+// critical section should spin rather than block, and waiters on a long one
+// should block rather than spin.
+void SetupHoldTimeArgs(benchmark::internal::Benchmark* bm) {
+  bm->UseRealTime()
+      ->ArgNames({"cs_ns", "num_prios"})
+      ->ArgsProduct({{100, 20000}, {1}})
+      ->ThreadRange(2, 128);
+}
+
+BENCHMARK_TEMPLATE(BM_Contended, absl::Mutex)->Apply(SetupHoldTimeArgs);
+BENCHMARK_TEMPLATE(BM_Contended, std::mutex)->Apply(SetupHoldTimeArgs);
+
+// Threads use a Mutex with a short critical section and, every few
+// iterations, a Mutex with a long one. The spinning that suits one of them
+// does not suit the other.
+template <typename MutexType>
+void BM_MixedHoldTimes(benchmark::State& state) {
+  struct Shared {
+    MutexType short_mu;
+    MutexType long_mu;
+    int short_data = 0;
+    int long_data = 0;
+  };
+  static absl::NoDestructor<Shared> shared;
+  int local = 0;
+  int iteration = 0;
+  for (auto _ : state) {
+    DelayNs(100 * state.threads(), &local);
+    {
+      RaiiLocker<MutexType> locker(&shared->short_mu);
+      DelayNs(100, &shared->short_data);
+    }
+    if (++iteration % 8 == 0) {
+      RaiiLocker<MutexType> locker(&shared->long_mu);
+      DelayNs(state.range(0), &shared->long_data);
+    }
+  }
+}
+
+BENCHMARK_TEMPLATE(BM_MixedHoldTimes, absl::Mutex)
+    ->UseRealTime()
+    ->ArgName("long_cs_ns")
+    ->Arg(20000)
+    ->ThreadRange(2, 128);
+BENCHMARK_TEMPLATE(BM_MixedHoldTimes, std::mutex)
+    ->UseRealTime()
+    ->ArgName("long_cs_ns")
+    ->Arg(20000)
+    ->ThreadRange(2, 128);
+
 // Measure the overhead of conditions on mutex release (when they must be
 // evaluated).  Mutex has (some) support for equivalence classes allowing
 // Conditions with the same function/argument to potentially not be multiply
@@ -26,6 +26,7 @@
 #include <cstdlib>
 #include <functional>
 #include <memory>
+#include <new>
 #include <random>
 #include <string>
 #include <thread>  // NOLINT(build/c++11)
@@ -1284,6 +1285,79 @@ TEST(Mutex, DeadlockDetectorLongCycle) {
   absl::SetMutexDeadlockDetectionMode(absl::OnDeadlockCycle::kAbort);
 }
 
+#if GTEST_HAS_DEATH_TEST && !defined(ABSL_HAVE_THREAD_SANITIZER)
+// With a sample rate of 1, every acquisition is tracked, so the inversion is
+// found in all builds.
+TEST(MutexDeathTest, SampledDeadlockDetector) {
+  EXPECT_DEATH(
+      {
+        absl::SetMutexDeadlockDetectionSampleRate(1);
+        absl::SetMutexDeadlockDetectionMode(absl::OnDeadlockCycle::kAbort);
+        absl::Mutex mu0;
+        absl::Mutex mu1;
+        mu0.Lock();
+        mu1.Lock();
+        mu1.Unlock();
+        mu0.Unlock();
+        mu1.Lock();
+        mu0.Lock();
+        mu0.Unlock();
+        mu1.Unlock();
+      },
+      "potential deadlock");
+}
+#endif
+
+// A destroyed Mutex leaves the lock ordering graph, so that mutexes built in
+// its storage may be acquired in another order.
+TEST(Mutex, SampledDeadlockDetectorForgetsDestroyedMutexes) {
+  absl::SetMutexDeadlockDetectionSampleRate(1);
+  alignas(absl::Mutex) unsigned char storage0[sizeof(absl::Mutex)];
+  alignas(absl::Mutex) unsigned char storage1[sizeof(absl::Mutex)];
+  for (int i = 0; i != 2; i++) {
+    // The second pass acquires the mutexes in the opposite order.
+    absl::Mutex* first = new (i == 0 ? storage0 : storage1) absl::Mutex;
+    absl::Mutex* second = new (i == 0 ? storage1 : storage0) absl::Mutex;
+    first->Lock();
+    second->Lock();
+    second->Unlock();
+    first->Unlock();
+    second->~Mutex();
+    first->~Mutex();
+  }
+  absl::SetMutexDeadlockDetectionSampleRate(0);
+}
+
+// Consistently ordered acquisitions, some of them sampled, of all kinds.
+TEST(Mutex, SampledDeadlockDetectorStressTest) ABSL_NO_THREAD_SAFETY_ANALYSIS {
+  absl::SetMutexDeadlockDetectionSampleRate(3);
+  const int n_locks = 1 << 12;
+  auto array_of_locks = absl::make_unique<absl::Mutex[]>(n_locks);
+  for (int i = 0; i < n_locks; i++) {
+    int end = std::min(n_locks, i + 5);
+    for (int j = i; j < end; j++) {
+      switch (j % 3) {
+        case 0:
+          array_of_locks[j].Lock();
+          break;
+        case 1:
+          array_of_locks[j].ReaderLock();
+          break;
+        default:
+          ABSL_CHECK(array_of_locks[j].TryLock());
+      }
+    }
+    for (int j = end - 1; j >= i; j--) {
+      if (j % 3 == 1) {
+        array_of_locks[j].ReaderUnlock();
+      } else {
+        array_of_locks[j].Unlock();
+      }
+    }
+  }
+  absl::SetMutexDeadlockDetectionSampleRate(0);
+}
+
 // This test is tagged with NO_THREAD_SAFETY_ANALYSIS because the
 // annotation-based static thread-safety analysis is not currently
 // predicate-aware and cannot tell if the two for-loops that acquire and
@@ -15,15 +15,120 @@
 #include "absl/synchronization/notification.h"
 
 #include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <limits>
 
 #include "absl/base/internal/raw_logging.h"
 #include "absl/base/internal/tracing.h"
+#include "absl/base/optimization.h"
+#include "absl/synchronization/internal/futex.h"
+#include "absl/synchronization/internal/kernel_timeout.h"
 #include "absl/synchronization/mutex.h"
 #include "absl/time/time.h"
 
 namespace absl {
 ABSL_NAMESPACE_BEGIN
 
+#ifdef ABSL_INTERNAL_HAVE_FUTEX
+
+void Notification::Notify() {
+  base_internal::TraceSignal(this, TraceObjectKind());
+  const int32_t state =
+      notified_yet_.fetch_or(kNotified, std::memory_order_release);
+
+#ifndef NDEBUG
+  if (ABSL_PREDICT_FALSE((state & kNotified) != 0)) {
+    ABSL_RAW_LOG(
+        FATAL,
+        "Notify() method called more than once for Notification object %p",
+        static_cast<void *>(this));
+  }
+#endif
+
+  // Observers may destroy the notification as soon as kNotified is set. That
+  // leaves the futex wake below to an address that may have been reused,
+  // which only costs a spurious wakeup to any futex now there: a private
+  // FUTEX_WAKE does not access the memory.
+  if (state & kWaiters) {
+    synchronization_internal::Futex::Wake(&notified_yet_,
+                                          std::numeric_limits<int32_t>::max());
+  }
+}
+
+Notification::~Notification() = default;
+
+namespace {
+
+// Atomically checks that `*v == val`, and if it is, sleeps until woken or until
+// `t` expires.
+int FutexWaitUntil(synchronization_internal::FutexWord* v, int32_t val,
+                   synchronization_internal::KernelTimeout t) {
+  using synchronization_internal::Futex;
+  using synchronization_internal::KernelTimeout;
+  if (!t.has_timeout()) {
+    return Futex::Wait(v, val);
+  } else if (KernelTimeout::SupportsSteadyClock() && t.is_relative_timeout()) {
+    auto rel_timespec = t.MakeRelativeTimespec();
+    return Futex::WaitRelativeTimeout(v, val, &rel_timespec);
+  } else {
+    auto abs_timespec = t.MakeAbsTimespec();
+    return Futex::WaitAbsoluteTimeout(v, val, &abs_timespec);
+  }
+}
+
+}  // namespace
+
+bool Notification::WaitInternal(
+    synchronization_internal::KernelTimeout t) const {
+  int32_t state = notified_yet_.load(std::memory_order_acquire);
+  while ((state & kNotified) == 0) {
+    if ((state & kWaiters) == 0 &&
+        !notified_yet_.compare_exchange_weak(state, state | kWaiters,
+                                             std::memory_order_acquire)) {
+      continue;
+    }
+    const int err = FutexWaitUntil(&notified_yet_, state | kWaiters, t);
+    if (err == -ETIMEDOUT) return HasBeenNotifiedInternal(&notified_yet_);
+    if (err != 0 && err != -EINTR && err != -EWOULDBLOCK) {
+      ABSL_RAW_LOG(FATAL, "Futex operation failed with error %d\n", err);
+    }
+    state = notified_yet_.load(std::memory_order_acquire);
+  }
+  return true;
+}
+
+void Notification::WaitForNotification() const {
+  base_internal::TraceWait(this, TraceObjectKind());
+  if (!HasBeenNotifiedInternal(&this->notified_yet_)) {
+    WaitInternal(synchronization_internal::KernelTimeout::Never());
+  }
+  base_internal::TraceContinue(this, TraceObjectKind());
+}
+
+bool Notification::WaitForNotificationWithTimeout(
+    absl::Duration timeout) const {
+  base_internal::TraceWait(this, TraceObjectKind());
+  bool notified = HasBeenNotifiedInternal(&this->notified_yet_);
+  if (!notified) {
+    notified = WaitInternal(synchronization_internal::KernelTimeout(timeout));
+  }
+  base_internal::TraceContinue(notified ? this : nullptr, TraceObjectKind());
+  return notified;
+}
+
+bool Notification::WaitForNotificationWithDeadline(absl::Time deadline) const {
+  base_internal::TraceWait(this, TraceObjectKind());
+  bool notified = HasBeenNotifiedInternal(&this->notified_yet_);
+  if (!notified) {
+    notified = WaitInternal(synchronization_internal::KernelTimeout(deadline));
+  }
+  base_internal::TraceContinue(notified ? this : nullptr, TraceObjectKind());
+  return notified;
+}
+
+#else  // ABSL_INTERNAL_HAVE_FUTEX
+
 void Notification::Notify() {
   base_internal::TraceSignal(this, TraceObjectKind());
   MutexLock l(&this->mutex_);
@@ -81,5 +186,7 @@ bool Notification::WaitForNotificationWithDeadline(absl::Time deadline) const {
   return notified;
 }
 
+#endif  // ABSL_INTERNAL_HAVE_FUTEX
+
 ABSL_NAMESPACE_END
 }  // namespace absl
@@ -51,9 +51,12 @@
 #define ABSL_SYNCHRONIZATION_NOTIFICATION_H_
 
 #include <atomic>
+#include <cstdint>
 
 #include "absl/base/attributes.h"
 #include "absl/base/internal/tracing.h"
+#include "absl/synchronization/internal/futex_word.h"
+#include "absl/synchronization/internal/kernel_timeout.h"
 #include "absl/synchronization/mutex.h"
 #include "absl/time/time.h"
 
@@ -66,8 +69,9 @@ ABSL_NAMESPACE_BEGIN
 class Notification {
  public:
   // Initializes the "notified" state to unnotified.
-  Notification() : notified_yet_(false) {}
-  explicit Notification(bool prenotify) : notified_yet_(prenotify) {}
+  Notification() : notified_yet_(InitialState(false)) {}
+  explicit Notification(bool prenotify)
+      : notified_yet_(InitialState(prenotify)) {}
   Notification(const Notification&) = delete;
   Notification& operator=(const Notification&) = delete;
   ~Notification();
@@ -118,6 +122,31 @@ class Notification {
     return base_internal::ObjectKind::kNotification;
   }
 
+#ifdef ABSL_INTERNAL_HAVE_FUTEX_WORD
+  // Where futexes are available, the state is a single futex word, and
+  // waiters sleep on it directly rather than on a `Mutex`.
+  //
+  // Bits of `notified_yet_`.
+  static constexpr int32_t kNotified = synchronization_internal::kFutexWordDone;
+  static constexpr int32_t kWaiters =
+      synchronization_internal::kFutexWordWaiters;
+
+  static constexpr int32_t InitialState(bool prenotify) {
+    return prenotify ? kNotified : 0;
+  }
+
+  static inline bool HasBeenNotifiedInternal(
+      const synchronization_internal::FutexWord* notified_yet) {
+    return (notified_yet->load(std::memory_order_acquire) & kNotified) != 0;
+  }
+
+  // Waits until notified or until `t` expires, and returns whether notified.
+  bool WaitInternal(synchronization_internal::KernelTimeout t) const;
+
+  mutable synchronization_internal::FutexWord notified_yet_;
+#else
+  static constexpr bool InitialState(bool prenotify) { return prenotify; }
+
   static inline bool HasBeenNotifiedInternal(
       const std::atomic<bool>* notified_yet) {
     return notified_yet->load(std::memory_order_acquire);
@@ -125,6 +154,7 @@ class Notification {
 
   mutable Mutex mutex_;
   std::atomic<bool> notified_yet_;  // written under mutex_
+#endif  // ABSL_INTERNAL_HAVE_FUTEX_WORD
 };
 
 ABSL_NAMESPACE_END
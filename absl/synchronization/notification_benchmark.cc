@@ -0,0 +1,80 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <memory>
+#include <vector>
+
+#include "absl/profiling/benchmark.h"
+#include "absl/synchronization/blocking_counter.h"
+#include "absl/synchronization/internal/thread_pool.h"
+#include "absl/synchronization/notification.h"
+
+namespace {
+
+void BM_Notification_NotifyAndWait(benchmark::State& state) {
+  for (auto _ : state) {
+    absl::Notification notification;
+    notification.Notify();
+    notification.WaitForNotification();
+  }
+}
+BENCHMARK(BM_Notification_NotifyAndWait);
+
+// Fan-in: a coordinator waits for each of `threads` workers to notify its own
+// notification.
+void BM_Notification_FanIn(benchmark::State& state) {
+  const int num_threads = static_cast<int>(state.range(0));
+  absl::synchronization_internal::ThreadPool pool(num_threads);
+  for (auto _ : state) {
+    std::vector<std::unique_ptr<absl::Notification>> done(num_threads);
+    for (auto& notification : done) {
+      notification = std::make_unique<absl::Notification>();
+      pool.Schedule([&notification]() { notification->Notify(); });
+    }
+    for (auto& notification : done) notification->WaitForNotification();
+  }
+}
+BENCHMARK(BM_Notification_FanIn)
+    ->ArgName("threads")
+    ->Arg(64)
+    ->Arg(128)
+    ->Arg(256)
+    ->UseRealTime();
+
+// Fan-out: `threads` workers wait on one notification, and the coordinator
+// waits for all of them to wake.
+void BM_Notification_FanOut(benchmark::State& state) {
+  const int num_threads = static_cast<int>(state.range(0));
+  absl::synchronization_internal::ThreadPool pool(num_threads);
+  for (auto _ : state) {
+    absl::Notification start;
+    absl::BlockingCounter woken(num_threads);
+    for (int i = 0; i < num_threads; ++i) {
+      pool.Schedule([&start, &woken]() {
+        start.WaitForNotification();
+        woken.DecrementCount();
+      });
+    }
+    start.Notify();
+    woken.Wait();
+  }
+}
+BENCHMARK(BM_Notification_FanOut)
+    ->ArgName("threads")
+    ->Arg(64)
+    ->Arg(128)
+    ->Arg(256)
+    ->UseRealTime();
+
+}  // namespace
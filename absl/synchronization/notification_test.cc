@@ -138,6 +138,39 @@ TEST(NotificationTest, SanityTest) {
   BasicTests(true, &local_notification2);
 }
 
+// Tests that a waiter may destroy the notification as soon as it has been
+// notified, while `Notify()` may still be waking it.
+TEST(NotificationTest, DestroyAfterNotified) {
+  for (int i = 0; i < 100; ++i) {
+    auto* notification = new Notification;
+    std::thread notifier([notification] { notification->Notify(); });
+    notification->WaitForNotification();
+    delete notification;
+    notifier.join();
+  }
+}
+
+TEST(NotificationTest, TimedWaitersAndWaiters) {
+  Notification notification;
+  ThreadSafeCounter timed_out;
+  ThreadSafeCounter done;
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 8; ++i) {
+    threads.emplace_back([&] {
+      if (!notification.WaitForNotificationWithTimeout(absl::Milliseconds(1))) {
+        timed_out.Increment();
+      }
+      notification.WaitForNotification();
+      done.Increment();
+    });
+  }
+  timed_out.WaitUntilGreaterOrEqual(8);
+  EXPECT_EQ(0, done.Get());
+  notification.Notify();
+  for (std::thread& thread : threads) thread.join();
+  EXPECT_EQ(8, done.Get());
+}
+
 #if ABSL_HAVE_ATTRIBUTE_WEAK
 
 namespace base_internal {
@@ -0,0 +1,125 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/synchronization/numa_mutex.h"
+
+#include <atomic>
+#include <memory>
+
+#include "absl/base/config.h"
+#include "absl/base/internal/raw_logging.h"
+#include "absl/base/internal/sysinfo.h"
+#include "absl/base/optimization.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/synchronization/mutex.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+// The local lock of one node. Kept on its own cache line, so that threads of
+// a node only share lines with each other while the node owns the lock.
+struct ABSL_CACHELINE_ALIGNED NumaMutex::Node {
+  absl::Mutex mu;
+  // Threads of this node blocked in `Lock()`.
+  std::atomic<int> waiters{0};
+  // Whether this node owns the lock, so that acquiring `mu` acquires it.
+  bool owns_lock ABSL_GUARDED_BY(mu) = false;
+  // Consecutive handoffs within this node.
+  int handoffs ABSL_GUARDED_BY(mu) = 0;
+};
+
+NumaMutex::NumaMutex()
+    : NumaMutex(base_internal::NumNumaNodes(),
+                base_internal::CurrentNumaNode) {}
+
+NumaMutex::NumaMutex(int num_nodes, int (*current_node)())
+    : num_nodes_(num_nodes),
+      current_node_(current_node),
+      nodes_(new Node[static_cast<size_t>(num_nodes)]) {
+  ABSL_RAW_CHECK(num_nodes > 0, "NumaMutex needs at least one node");
+}
+
+NumaMutex::~NumaMutex() = default;
+
+NumaMutex::Node& NumaMutex::CurrentNode() {
+  if (num_nodes_ == 1) return nodes_[0];
+  const unsigned node = static_cast<unsigned>(current_node_());
+  return nodes_[node % static_cast<unsigned>(num_nodes_)];
+}
+
+void NumaMutex::AcquireForNode(Node* node) ABSL_NO_THREAD_SAFETY_ANALYSIS {
+  if (!node->owns_lock) {
+    if (num_nodes_ > 1) {
+      absl::MutexLock lock(&global_mu_);
+      global_mu_.Await(absl::Condition(
+          +[](bool* locked) { return !*locked; }, &global_locked_));
+      global_locked_ = true;
+    }
+    node->owns_lock = true;
+    node->handoffs = 0;
+  }
+  owner_ = node;
+}
+
+void NumaMutex::Lock() ABSL_NO_THREAD_SAFETY_ANALYSIS {
+  Node& node = CurrentNode();
+  if (ABSL_PREDICT_FALSE(!node.mu.TryLock())) {
+    node.waiters.fetch_add(1, std::memory_order_relaxed);
+    node.mu.Lock();
+    node.waiters.fetch_sub(1, std::memory_order_relaxed);
+  }
+  AcquireForNode(&node);
+}
+
+bool NumaMutex::TryLock() ABSL_NO_THREAD_SAFETY_ANALYSIS {
+  Node& node = CurrentNode();
+  if (!node.mu.TryLock()) return false;
+  if (!node.owns_lock && num_nodes_ > 1) {
+    bool acquired = false;
+    if (global_mu_.TryLock()) {
+      if (!global_locked_) global_locked_ = acquired = true;
+      global_mu_.Unlock();
+    }
+    if (!acquired) {
+      node.mu.Unlock();
+      return false;
+    }
+    node.owns_lock = true;
+    node.handoffs = 0;
+  }
+  owner_ = &node;
+  return true;
+}
+
+void NumaMutex::Unlock() ABSL_NO_THREAD_SAFETY_ANALYSIS {
+  Node& node = *owner_;
+  owner_ = nullptr;
+  // Keep the lock within the node while it has waiters, unless that would
+  // starve the other nodes. A node that is the only one never gives it up,
+  // and has no handoffs to count.
+  if (num_nodes_ > 1) {
+    if (node.handoffs < kMaxLocalHandoffs &&
+        node.waiters.load(std::memory_order_relaxed) > 0) {
+      ++node.handoffs;
+    } else {
+      node.owns_lock = false;
+      absl::MutexLock lock(&global_mu_);
+      global_locked_ = false;
+    }
+  }
+  node.mu.Unlock();
+}
+
+ABSL_NAMESPACE_END
+}  // namespace absl
@@ -0,0 +1,134 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Compares `absl::NumaMutex` with `absl::Mutex` under contention from threads
+// pinned alternately to each NUMA node.
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "absl/profiling/benchmark.h"
+#include "absl/base/internal/cycleclock.h"
+#include "absl/base/internal/sysinfo.h"
+#include "absl/base/no_destructor.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/synchronization/numa_mutex.h"
+
+namespace {
+
+using absl::base_internal::CycleClock;
+
+// Pins the calling thread to a CPU of node `thread_index % NumNumaNodes()` for
+// its lifetime, so that consecutive threads run on different nodes.
+class ScopedPinToNode {
+ public:
+  explicit ScopedPinToNode(int thread_index) {
+#ifdef __linux__
+    const int num_nodes = absl::base_internal::NumNumaNodes();
+    const int node = thread_index % num_nodes;
+    std::vector<int> cpus;
+    for (int cpu = 0; cpu < absl::base_internal::NumCPUs(); ++cpu) {
+      if (absl::base_internal::NumaNodeOfCpu(cpu) == node) cpus.push_back(cpu);
+    }
+    if (cpus.empty() ||
+        pthread_getaffinity_np(pthread_self(), sizeof(saved_), &saved_) != 0) {
+      return;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpus[static_cast<size_t>(thread_index / num_nodes) % cpus.size()],
+            &set);
+    pinned_ = pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    static_cast<void>(thread_index);
+#endif
+  }
+
+  ScopedPinToNode(const ScopedPinToNode&) = delete;
+  ScopedPinToNode& operator=(const ScopedPinToNode&) = delete;
+
+  ~ScopedPinToNode() {
+#ifdef __linux__
+    if (pinned_) {
+      pthread_setaffinity_np(pthread_self(), sizeof(saved_), &saved_);
+    }
+#endif
+  }
+
+ private:
+#ifdef __linux__
+  cpu_set_t saved_;
+  bool pinned_ = false;
+#endif
+};
+
+// Each iteration does some work outside of the lock, then acquires it and
+// updates `state.range(0)` cache lines of shared data. Reports the throughput,
+// and the longest time a thread waited for the lock, which grows as handing
+// the lock over favors some threads.
+template <typename MutexType>
+void BM_CrossNodeContention(benchmark::State& state) {
+  struct alignas(64) Line {
+    int64_t value = 0;
+  };
+  struct Shared {
+    MutexType mu;
+    std::vector<Line> data = std::vector<Line>(64);
+    std::atomic<int64_t> max_wait_cycles{0};
+    std::atomic<int> finished{0};
+  };
+  static absl::NoDestructor<Shared> shared;
+  const size_t lines = static_cast<size_t>(state.range(0));
+
+  ScopedPinToNode pin(state.thread_index());
+  int64_t max_wait_cycles = 0;
+  int64_t local = 0;
+  for (auto _ : state) {
+    for (int i = 0; i < 100; ++i) benchmark::DoNotOptimize(++local);
+    const int64_t start = CycleClock::Now();
+    shared->mu.Lock();
+    const int64_t wait = CycleClock::Now() - start;
+    if (wait > max_wait_cycles) max_wait_cycles = wait;
+    for (size_t i = 0; i < lines; ++i) ++shared->data[i].value;
+    shared->mu.Unlock();
+  }
+  state.SetItemsProcessed(state.iterations());
+
+  int64_t max = shared->max_wait_cycles.load(std::memory_order_relaxed);
+  while (max < max_wait_cycles &&
+         !shared->max_wait_cycles.compare_exchange_weak(max, max_wait_cycles)) {
+  }
+  // The last thread to finish reports the maximum over all threads.
+  if (shared->finished.fetch_add(1) + 1 == state.threads()) {
+    state.counters["max_wait_us"] =
+        static_cast<double>(shared->max_wait_cycles.exchange(0)) * 1e6 /
+        CycleClock::Frequency();
+    shared->finished.store(0);
+  }
+}
+
+void SetupArgs(benchmark::internal::Benchmark* bm) {
+  bm->UseRealTime()->ArgName("lines")->Arg(1)->Arg(16)->ThreadRange(2, 64);
+}
+
+BENCHMARK_TEMPLATE(BM_CrossNodeContention, absl::Mutex)->Apply(SetupArgs);
+BENCHMARK_TEMPLATE(BM_CrossNodeContention, absl::NumaMutex)->Apply(SetupArgs);
+
+}  // namespace
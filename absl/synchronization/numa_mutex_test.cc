@@ -0,0 +1,129 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/synchronization/numa_mutex.h"
+
+#include <memory>
+#include <thread>  // NOLINT(build/c++11)
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "absl/base/config.h"
+#include "absl/base/internal/sysinfo.h"
+#include "absl/synchronization/notification.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+class NumaMutexTestPeer {
+ public:
+  // Returns a lock with `num_nodes` nodes, which considers threads to run on
+  // the node set by `SetNode()`.
+  static std::unique_ptr<NumaMutex> Create(int num_nodes) {
+    return std::unique_ptr<NumaMutex>(new NumaMutex(num_nodes, &GetNode));
+  }
+
+  static void SetNode(int node) { node_ = node; }
+
+ private:
+  static int GetNode() { return node_; }
+
+  static thread_local int node_;
+};
+
+thread_local int NumaMutexTestPeer::node_ = 0;
+
+namespace {
+
+// Increments a counter from many threads, checking that no two of them are
+// ever inside the critical section.
+void CheckMutualExclusion(NumaMutex* mu, int num_nodes) {
+  constexpr int kThreads = 8;
+  constexpr int kIterations = 20000;
+  int count = 0;
+  bool inside = false;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&, t] {
+      NumaMutexTestPeer::SetNode(t % num_nodes);
+      for (int i = 0; i < kIterations; ++i) {
+        NumaMutexLock lock(mu);
+        EXPECT_FALSE(inside);
+        inside = true;
+        ++count;
+        inside = false;
+      }
+    });
+  }
+  for (std::thread& thread : threads) thread.join();
+  EXPECT_EQ(count, kThreads * kIterations);
+}
+
+TEST(NumaMutex, MutualExclusion) {
+  NumaMutex mu;
+  EXPECT_EQ(mu.num_nodes(), base_internal::NumNumaNodes());
+  CheckMutualExclusion(&mu, 1);
+}
+
+TEST(NumaMutex, MutualExclusionAcrossNodes) {
+  for (int num_nodes : {1, 2, 3}) {
+    std::unique_ptr<NumaMutex> mu = NumaMutexTestPeer::Create(num_nodes);
+    EXPECT_EQ(mu->num_nodes(), num_nodes);
+    CheckMutualExclusion(mu.get(), num_nodes);
+  }
+}
+
+TEST(NumaMutex, TryLock) {
+  std::unique_ptr<NumaMutex> mu = NumaMutexTestPeer::Create(2);
+  ASSERT_TRUE(mu->TryLock());
+  // The lock is held by node 0, so threads of either node fail to take it.
+  for (int node : {0, 1}) {
+    std::thread([&mu, node] {
+      NumaMutexTestPeer::SetNode(node);
+      EXPECT_FALSE(mu->TryLock());
+    }).join();
+  }
+  mu->Unlock();
+  std::thread([&mu] {
+    NumaMutexTestPeer::SetNode(1);
+    ASSERT_TRUE(mu->TryLock());
+    mu->Unlock();
+  }).join();
+}
+
+TEST(NumaMutex, OtherNodesMakeProgress) {
+  // Threads of node 0 keep the lock busy. A thread of node 1 still gets it.
+  std::unique_ptr<NumaMutex> mu = NumaMutexTestPeer::Create(2);
+  absl::Notification done;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&] {
+      while (!done.HasBeenNotified()) {
+        NumaMutexLock lock(mu.get());
+      }
+    });
+  }
+  std::thread([&] {
+    NumaMutexTestPeer::SetNode(1);
+    for (int i = 0; i < 1000; ++i) {
+      NumaMutexLock lock(mu.get());
+    }
+  }).join();
+  done.Notify();
+  for (std::thread& thread : threads) thread.join();
+}
+
+}  // namespace
+ABSL_NAMESPACE_END
+}  // namespace absl
@@ -0,0 +1,147 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/synchronization/rcu.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>  // NOLINT(build/c++11)
+
+#include "absl/base/attributes.h"
+#include "absl/base/config.h"
+#include "absl/base/internal/raw_logging.h"
+#include "absl/base/internal/thread_identity.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/synchronization/internal/create_thread_identity.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+namespace synchronization_internal {
+
+ABSL_CONST_INIT std::atomic<uint64_t> rcu_global_epoch{1};
+
+}  // namespace synchronization_internal
+
+namespace {
+
+using synchronization_internal::rcu_global_epoch;
+
+// An object passed to `RcuRetire()`, which readers that entered their
+// critical sections at or before `epoch` may still be using.
+struct Retired {
+  void* ptr;
+  void (*deleter)(void*);
+  uint64_t epoch;
+  Retired* next;
+};
+
+// Retired objects, newest first, so that epochs decrease along the list.
+ABSL_CONST_INIT absl::Mutex retired_mu(absl::kConstInit);
+ABSL_CONST_INIT Retired* retired_head ABSL_GUARDED_BY(retired_mu) = nullptr;
+ABSL_CONST_INIT size_t num_retired ABSL_GUARDED_BY(retired_mu) = 0;
+
+// `RcuRetire()` tries to reclaim objects whenever the number of pending ones
+// reaches a multiple of this.
+constexpr size_t kReclaimBatch = 64;
+
+// Returns the oldest epoch of a read-side critical section in progress, or the
+// current epoch if there is none. Objects retired at earlier epochs are
+// unreachable for all readers.
+uint64_t OldestActiveEpoch() {
+  uint64_t oldest = rcu_global_epoch.load(std::memory_order_relaxed);
+  // Pairs with the fence in `RcuReadLock()`.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  for (base_internal::ThreadIdentity* identity =
+           synchronization_internal::AllThreadIdentities();
+       identity != nullptr; identity = identity->next_allocated) {
+    const uint64_t epoch = identity->rcu_epoch.load(std::memory_order_acquire);
+    if (epoch != 0) oldest = std::min(oldest, epoch);
+  }
+  return oldest;
+}
+
+// Runs the deleters of the objects retired before epoch `oldest`.
+void Reclaim(uint64_t oldest) {
+  Retired* reclaimable = nullptr;
+  {
+    absl::MutexLock lock(&retired_mu);
+    Retired** link = &retired_head;
+    while (*link != nullptr && (*link)->epoch >= oldest) {
+      link = &(*link)->next;
+    }
+    reclaimable = *link;
+    *link = nullptr;
+    for (Retired* r = reclaimable; r != nullptr; r = r->next) --num_retired;
+  }
+  while (reclaimable != nullptr) {
+    Retired* next = reclaimable->next;
+    reclaimable->deleter(reclaimable->ptr);
+    delete reclaimable;
+    reclaimable = next;
+  }
+}
+
+// Advances the epoch and waits for the critical sections that entered before
+// it, then returns the epoch, after which all objects retired until then are
+// unreachable for all readers.
+uint64_t WaitForReaders(const char* misuse_error) {
+  base_internal::ThreadIdentity* identity =
+      base_internal::CurrentThreadIdentityIfPresent();
+  ABSL_RAW_CHECK(identity == nullptr || identity->rcu_nesting == 0,
+                 misuse_error);
+  const uint64_t epoch =
+      rcu_global_epoch.fetch_add(1, std::memory_order_seq_cst) + 1;
+  for (int c = 0; OldestActiveEpoch() < epoch; ++c) {
+    if (c < 100) {
+      std::this_thread::yield();
+    } else {
+      absl::SleepFor(absl::Microseconds(10));
+    }
+  }
+  return epoch;
+}
+
+}  // namespace
+
+void RcuRetire(void* ptr, void (*deleter)(void*)) {
+  Retired* retired = new Retired{ptr, deleter, 0, nullptr};
+  bool reclaim;
+  {
+    absl::MutexLock lock(&retired_mu);
+    // Readers that enter their critical sections after the epoch advances
+    // cannot reach `ptr`. Advancing it under the lock keeps the list sorted.
+    retired->epoch = rcu_global_epoch.fetch_add(1, std::memory_order_seq_cst);
+    retired->next = retired_head;
+    retired_head = retired;
+    reclaim = ++num_retired % kReclaimBatch == 0;
+  }
+  if (reclaim) Reclaim(OldestActiveEpoch());
+}
+
+void RcuSynchronize() {
+  WaitForReaders("RcuSynchronize() called in a critical section");
+}
+
+void RcuBarrier() {
+  Reclaim(WaitForReaders("RcuBarrier() called in a critical section"));
+}
+
+ABSL_NAMESPACE_END
+}  // namespace absl
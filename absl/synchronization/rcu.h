@@ -0,0 +1,177 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// -----------------------------------------------------------------------------
+// rcu.h
+// -----------------------------------------------------------------------------
+//
+// This header file defines read-copy-update (RCU) primitives based on
+// epoch-based reclamation: `absl::RcuPtr<T>` publishes immutable snapshots of
+// data to readers that access them without writing to any shared memory, and
+// destroys replaced snapshots once no reader can still be using them.
+//
+// Example:
+//
+//   absl::RcuPtr<Config> config(std::make_unique<Config>(...));
+//
+//   // Readers, on any number of threads:
+//   {
+//     absl::RcuReaderLock lock;
+//     const Config* c = config.Read();
+//     ... use *c, which remains valid until `lock` is destroyed ...
+//   }
+//
+//   // Writers:
+//   config.Publish(std::make_unique<Config>(...));
+//
+// Compared to a `std::shared_ptr` copied under a `Mutex`, a read-side critical
+// section only writes to the calling thread's own `ThreadIdentity`, so readers
+// on many CPUs do not contend on a reference count. In exchange, replaced
+// objects are destroyed late and in batches, on whichever thread happens to
+// reclaim them.
+//
+// Read-side critical sections nest, must not block for long, and must not call
+// `RcuSynchronize()` or `RcuBarrier()`.
+
+#ifndef ABSL_SYNCHRONIZATION_RCU_H_
+#define ABSL_SYNCHRONIZATION_RCU_H_
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+#include "absl/base/config.h"
+#include "absl/base/internal/thread_identity.h"
+#include "absl/synchronization/internal/create_thread_identity.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+namespace synchronization_internal {
+
+// The global epoch, advanced by each retirement. Never 0, which marks a thread
+// outside of any read-side critical section.
+ABSL_CONST_INIT ABSL_DLL extern std::atomic<uint64_t> rcu_global_epoch;
+
+}  // namespace synchronization_internal
+
+// RcuReadLock()
+// RcuReadUnlock()
+//
+// Enter and leave a read-side critical section. Objects read from an `RcuPtr`
+// within a critical section are not destroyed before the outermost critical
+// section of the thread ends.
+inline void RcuReadLock() {
+  base_internal::ThreadIdentity* identity =
+      synchronization_internal::GetOrCreateCurrentThreadIdentity();
+  if (identity->rcu_nesting++ == 0) {
+    identity->rcu_epoch.store(
+        synchronization_internal::rcu_global_epoch.load(
+            std::memory_order_acquire),
+        std::memory_order_relaxed);
+    // Pairs with the fence in the reclaimer: either it sees this thread's
+    // epoch, or this thread sees the objects it published.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+  }
+}
+
+inline void RcuReadUnlock() {
+  base_internal::ThreadIdentity* identity =
+      base_internal::CurrentThreadIdentityIfPresent();
+  if (--identity->rcu_nesting == 0) {
+    identity->rcu_epoch.store(0, std::memory_order_release);
+  }
+}
+
+// RcuReaderLock
+//
+// `RcuReaderLock` is a helper class, which enters and leaves a read-side
+// critical section via RAII.
+class RcuReaderLock {
+ public:
+  RcuReaderLock() { RcuReadLock(); }
+
+  RcuReaderLock(const RcuReaderLock&) = delete;
+  RcuReaderLock& operator=(const RcuReaderLock&) = delete;
+
+  ~RcuReaderLock() { RcuReadUnlock(); }
+};
+
+// RcuRetire()
+//
+// Schedules `deleter(ptr)` to run once every read-side critical section that
+// is in progress has ended. `ptr` must already be unreachable for readers
+// that start later. Deleters run on threads that call `RcuRetire()` or
+// `RcuBarrier()`, outside of any lock.
+void RcuRetire(void* ptr, void (*deleter)(void*));
+
+template <typename T>
+void RcuRetire(T* ptr) {
+  RcuRetire(const_cast<void*>(static_cast<const void*>(ptr)), +[](void* p) {
+    delete static_cast<T*>(p);
+  });
+}
+
+// RcuSynchronize()
+//
+// Blocks until every read-side critical section in progress at the time of the
+// call has ended. Must not be called within a read-side critical section.
+void RcuSynchronize();
+
+// RcuBarrier()
+//
+// Blocks until every deleter passed to `RcuRetire()` before the call has run.
+// Must not be called within a read-side critical section.
+void RcuBarrier();
+
+// RcuPtr
+//
+// An `RcuPtr<T>` owns an object of type `T` that readers access within
+// read-side critical sections, and that writers replace as a whole. The
+// replaced object is destroyed once no reader can still use it. An `RcuPtr`
+// may be empty.
+template <typename T>
+class RcuPtr {
+ public:
+  RcuPtr() = default;
+  explicit RcuPtr(std::unique_ptr<T> value) : ptr_(value.release()) {}
+
+  RcuPtr(const RcuPtr&) = delete;
+  RcuPtr& operator=(const RcuPtr&) = delete;
+
+  // Destroys the current object immediately, so there must be no more readers.
+  ~RcuPtr() { delete ptr_.load(std::memory_order_relaxed); }
+
+  // RcuPtr::Read()
+  //
+  // Returns the current object, or null. Must be called within a read-side
+  // critical section, until the end of which the object remains valid.
+  const T* Read() const { return ptr_.load(std::memory_order_acquire); }
+
+  // RcuPtr::Publish()
+  //
+  // Replaces the current object with `value`, and retires the previous one.
+  void Publish(std::unique_ptr<T> value) {
+    T* old = ptr_.exchange(value.release(), std::memory_order_acq_rel);
+    if (old != nullptr) RcuRetire(old);
+  }
+
+ private:
+  std::atomic<T*> ptr_{nullptr};
+};
+
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_SYNCHRONIZATION_RCU_H_
@@ -0,0 +1,85 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Compares reading a published snapshot through `absl::RcuPtr` with copying a
+// `std::shared_ptr` under an `absl::Mutex`.
+
+#include <cstdint>
+#include <memory>
+
+#include "absl/profiling/benchmark.h"
+#include "absl/base/no_destructor.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/synchronization/rcu.h"
+
+namespace {
+
+// A snapshot such as a configuration or routing table.
+struct Snapshot {
+  int64_t entries[8] = {};
+};
+
+// Thread 0 publishes a new snapshot every `state.range(0)` iterations, or
+// never if the range is 0; all threads read the current snapshot.
+
+void BM_RcuRead(benchmark::State& state) {
+  static absl::NoDestructor<absl::RcuPtr<Snapshot>> ptr(
+      std::make_unique<Snapshot>());
+  const int64_t publish_every = state.thread_index() == 0 ? state.range(0) : 0;
+  int64_t ops = 0;
+  int64_t sum = 0;
+  for (auto _ : state) {
+    if (publish_every > 0 && ++ops % publish_every == 0) {
+      ptr->Publish(std::make_unique<Snapshot>());
+    }
+    absl::RcuReaderLock lock;
+    for (int64_t entry : ptr->Read()->entries) sum += entry;
+  }
+  benchmark::DoNotOptimize(sum);
+  state.SetItemsProcessed(state.iterations());
+}
+
+void BM_SharedPtrMutexRead(benchmark::State& state) {
+  static absl::NoDestructor<absl::Mutex> mu;
+  static absl::NoDestructor<std::shared_ptr<const Snapshot>> ptr(
+      std::make_shared<Snapshot>());
+  const int64_t publish_every = state.thread_index() == 0 ? state.range(0) : 0;
+  int64_t ops = 0;
+  int64_t sum = 0;
+  for (auto _ : state) {
+    if (publish_every > 0 && ++ops % publish_every == 0) {
+      std::shared_ptr<const Snapshot> next = std::make_shared<Snapshot>();
+      absl::MutexLock lock(mu.get());
+      ptr->swap(next);
+    }
+    std::shared_ptr<const Snapshot> snapshot;
+    {
+      absl::ReaderMutexLock lock(mu.get());
+      snapshot = *ptr;
+    }
+    for (int64_t entry : snapshot->entries) sum += entry;
+  }
+  benchmark::DoNotOptimize(sum);
+  state.SetItemsProcessed(state.iterations());
+}
+
+void SetupReadArgs(benchmark::internal::Benchmark* bm) {
+  bm->UseRealTime()->ThreadRange(1, 256)->ArgName("publish_every");
+  for (int publish_every : {0, 10000}) bm->Arg(publish_every);
+}
+
+BENCHMARK(BM_RcuRead)->Apply(SetupReadArgs);
+BENCHMARK(BM_SharedPtrMutexRead)->Apply(SetupReadArgs);
+
+}  // namespace
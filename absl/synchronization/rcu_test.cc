@@ -0,0 +1,156 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/synchronization/rcu.h"
+
+#include <atomic>
+#include <memory>
+#include <thread>  // NOLINT(build/c++11)
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "absl/base/config.h"
+#include "absl/synchronization/notification.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+namespace {
+
+// Counts live objects, and marks destroyed ones so that readers using them
+// too late can tell.
+struct Tracked {
+  static constexpr int kAlive = 0x600d;
+  static constexpr int kDead = 0xdead;
+
+  explicit Tracked(int v, std::atomic<int>* live) : value(v), live(live) {
+    live->fetch_add(1);
+  }
+  ~Tracked() {
+    state.store(kDead);
+    live->fetch_sub(1);
+  }
+
+  const int value;
+  std::atomic<int>* const live;
+  std::atomic<int> state{kAlive};
+};
+
+TEST(Rcu, PublishAndRead) {
+  std::atomic<int> live{0};
+  {
+    RcuPtr<Tracked> ptr;
+    {
+      RcuReaderLock lock;
+      EXPECT_EQ(ptr.Read(), nullptr);
+    }
+    ptr.Publish(std::make_unique<Tracked>(1, &live));
+    ptr.Publish(std::make_unique<Tracked>(2, &live));
+    {
+      RcuReaderLock lock;
+      ASSERT_NE(ptr.Read(), nullptr);
+      EXPECT_EQ(ptr.Read()->value, 2);
+    }
+    RcuBarrier();
+    EXPECT_EQ(live.load(), 1);
+  }
+  EXPECT_EQ(live.load(), 0);
+}
+
+TEST(Rcu, RetiredObjectsOutliveReaders) {
+  std::atomic<int> live{0};
+  RcuPtr<Tracked> ptr(std::make_unique<Tracked>(1, &live));
+  absl::Notification reading;
+  absl::Notification release_reader;
+  std::thread reader([&] {
+    RcuReadLock();
+    RcuReadLock();
+    const Tracked* t = ptr.Read();
+    // The outer critical section keeps `t` valid.
+    RcuReadUnlock();
+    reading.Notify();
+    release_reader.WaitForNotification();
+    EXPECT_EQ(t->state.load(), Tracked::kAlive);
+    EXPECT_EQ(t->value, 1);
+    RcuReadUnlock();
+  });
+  reading.WaitForNotification();
+  ptr.Publish(std::make_unique<Tracked>(2, &live));
+
+  std::atomic<bool> barrier_done{false};
+  std::thread barrier([&] {
+    RcuBarrier();
+    barrier_done.store(true);
+  });
+  absl::SleepFor(absl::Milliseconds(50));
+  EXPECT_FALSE(barrier_done.load());
+  EXPECT_EQ(live.load(), 2);
+
+  release_reader.Notify();
+  reader.join();
+  barrier.join();
+  EXPECT_EQ(live.load(), 1);
+}
+
+TEST(Rcu, RetireRawPointers) {
+  static std::atomic<int> deleted{0};
+  int values[3];
+  for (int& v : values) {
+    RcuRetire(&v, +[](void*) { deleted.fetch_add(1); });
+  }
+  RcuSynchronize();
+  RcuBarrier();
+  EXPECT_EQ(deleted.load(), 3);
+}
+
+TEST(Rcu, ConcurrentReadersAndWriters) {
+  constexpr int kReaders = 6;
+  constexpr int kWriters = 2;
+  constexpr int kPublishes = 2000;
+  std::atomic<int> live{0};
+  {
+    RcuPtr<Tracked> ptr(std::make_unique<Tracked>(0, &live));
+    std::atomic<bool> done{false};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kReaders; ++t) {
+      threads.emplace_back([&] {
+        while (!done.load(std::memory_order_relaxed)) {
+          RcuReaderLock lock;
+          const Tracked* tracked = ptr.Read();
+          ASSERT_NE(tracked, nullptr);
+          EXPECT_EQ(tracked->state.load(), Tracked::kAlive);
+        }
+      });
+    }
+    std::vector<std::thread> writers;
+    for (int t = 0; t < kWriters; ++t) {
+      writers.emplace_back([&, t] {
+        for (int i = 0; i < kPublishes; ++i) {
+          ptr.Publish(std::make_unique<Tracked>(t * kPublishes + i, &live));
+        }
+      });
+    }
+    for (std::thread& writer : writers) writer.join();
+    done.store(true);
+    for (std::thread& thread : threads) thread.join();
+    RcuBarrier();
+    EXPECT_EQ(live.load(), 1);
+  }
+  EXPECT_EQ(live.load(), 0);
+}
+
+}  // namespace
+ABSL_NAMESPACE_END
+}  // namespace absl
@@ -0,0 +1,185 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/synchronization/reader_biased_mutex.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>  // NOLINT(build/c++11)
+
+#include "absl/base/attributes.h"
+#include "absl/base/config.h"
+#include "absl/base/internal/cycleclock.h"
+#include "absl/base/optimization.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+namespace {
+
+using base_internal::CycleClock;
+
+// The table of visible readers, shared by all `ReaderBiasedMutex` objects so
+// that each needs no more space than a `Mutex`. A reader holding a lock
+// through the biased path stores the lock's address in its slot.
+constexpr size_t kNumVisibleReaders = 4096;
+ABSL_CONST_INIT std::atomic<const ReaderBiasedMutex*>
+    visible_readers[kNumVisibleReaders] = {};
+
+// After a revocation, the bias stays revoked for this many times the cycles
+// that the revocation took, which bounds the fraction of time that writers
+// spend revoking.
+constexpr int64_t kInhibitMultiplier = 9;
+
+// A writer yields this many times while waiting for a visible reader, then
+// sleeps between checks.
+constexpr int kRevocationYields = 100;
+
+// The slots holding the read locks that this thread acquired through the
+// biased path.
+struct BiasedReadLocks {
+  std::atomic<const ReaderBiasedMutex*>* slots
+      [ReaderBiasedMutex::kMaxBiasedReadLocks];
+  int count;
+};
+ABSL_CONST_INIT thread_local BiasedReadLocks biased_read_locks = {};
+
+size_t VisibleReaderSlot(const ReaderBiasedMutex* mu) {
+  // The address of a thread-local identifies the thread.
+  const uintptr_t thread = reinterpret_cast<uintptr_t>(&biased_read_locks);
+  const uint64_t h =
+      (reinterpret_cast<uintptr_t>(mu) ^ (thread >> 6)) *
+      uint64_t{0x9e3779b97f4a7c15};
+  return static_cast<size_t>(h >> 32) % kNumVisibleReaders;
+}
+
+}  // namespace
+
+bool ReaderBiasedMutex::RevokeBias(bool wait) {
+  if (!read_bias_.load(std::memory_order_relaxed)) return true;
+  // Pairs with the check of the bias in `ReaderLock()`: either the reader
+  // sees the bias revoked, or the scan below sees the reader.
+  read_bias_.store(false, std::memory_order_seq_cst);
+  const int64_t start = CycleClock::Now();
+  for (auto& slot : visible_readers) {
+    int c = 0;
+    while (slot.load(std::memory_order_seq_cst) == this) {
+      if (!wait) {
+        // Holding `mu_` exclusively excludes the readers that saw the bias
+        // revoked, so it may be restored.
+        read_bias_.store(true, std::memory_order_release);
+        return false;
+      }
+      if (++c < kRevocationYields) {
+        std::this_thread::yield();
+      } else {
+        absl::SleepFor(absl::Microseconds(10));
+      }
+    }
+  }
+  const int64_t now = CycleClock::Now();
+  inhibit_until_cycles_.store(now + (now - start) * kInhibitMultiplier,
+                              std::memory_order_relaxed);
+  return true;
+}
+
+void ReaderBiasedMutex::MaybeRestoreBias() {
+  // No writer holds `mu_`, so visible readers may be admitted again.
+  if (!read_bias_.load(std::memory_order_relaxed) &&
+      CycleClock::Now() >=
+          inhibit_until_cycles_.load(std::memory_order_relaxed)) {
+    read_bias_.store(true, std::memory_order_release);
+  }
+}
+
+void ReaderBiasedMutex::Lock() ABSL_NO_THREAD_SAFETY_ANALYSIS {
+  mu_.Lock();
+  RevokeBias(/*wait=*/true);
+}
+
+bool ReaderBiasedMutex::TryLock() ABSL_NO_THREAD_SAFETY_ANALYSIS {
+  if (!mu_.TryLock()) return false;
+  if (!RevokeBias(/*wait=*/false)) {
+    mu_.Unlock();
+    return false;
+  }
+  return true;
+}
+
+void ReaderBiasedMutex::Unlock() ABSL_NO_THREAD_SAFETY_ANALYSIS {
+  mu_.Unlock();
+}
+
+void ReaderBiasedMutex::ReaderLock() ABSL_NO_THREAD_SAFETY_ANALYSIS {
+  BiasedReadLocks& locks = biased_read_locks;
+  if (read_bias_.load(std::memory_order_acquire) &&
+      ABSL_PREDICT_TRUE(locks.count < kMaxBiasedReadLocks)) {
+    std::atomic<const ReaderBiasedMutex*>& slot =
+        visible_readers[VisibleReaderSlot(this)];
+    const ReaderBiasedMutex* expected = nullptr;
+    if (slot.compare_exchange_strong(expected, this,
+                                     std::memory_order_seq_cst,
+                                     std::memory_order_relaxed)) {
+      if (ABSL_PREDICT_TRUE(read_bias_.load(std::memory_order_seq_cst))) {
+        locks.slots[locks.count++] = &slot;
+        return;
+      }
+      // A writer is revoking the bias.
+      slot.store(nullptr, std::memory_order_release);
+    }
+  }
+  mu_.ReaderLock();
+  MaybeRestoreBias();
+}
+
+void ReaderBiasedMutex::ReaderUnlock() ABSL_NO_THREAD_SAFETY_ANALYSIS {
+  BiasedReadLocks& locks = biased_read_locks;
+  // Locks are not reentrant, so a slot of this thread holding `this` must be
+  // the one this read lock was acquired in.
+  for (int i = locks.count - 1; i >= 0; --i) {
+    if (locks.slots[i]->load(std::memory_order_relaxed) == this) {
+      locks.slots[i]->store(nullptr, std::memory_order_release);
+      locks.slots[i] = locks.slots[--locks.count];
+      return;
+    }
+  }
+  mu_.ReaderUnlock();
+}
+
+void ReaderBiasedMutex::LockWhen(const Condition& cond)
+    ABSL_NO_THREAD_SAFETY_ANALYSIS {
+  mu_.LockWhen(cond);
+  RevokeBias(/*wait=*/true);
+}
+
+void ReaderBiasedMutex::ReaderLockWhen(const Condition& cond)
+    ABSL_NO_THREAD_SAFETY_ANALYSIS {
+  mu_.ReaderLockWhen(cond);
+  MaybeRestoreBias();
+}
+
+void ReaderBiasedMutex::Await(const Condition& cond)
+    ABSL_NO_THREAD_SAFETY_ANALYSIS {
+  mu_.Await(cond);
+  // Readers may have restored the bias while `mu_` was released.
+  RevokeBias(/*wait=*/true);
+}
+
+ABSL_NAMESPACE_END
+}  // namespace absl
@@ -0,0 +1,178 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// -----------------------------------------------------------------------------
+// reader_biased_mutex.h
+// -----------------------------------------------------------------------------
+//
+// This header file defines `absl::ReaderBiasedMutex`, a reader-writer lock
+// whose shared acquisitions scale with the number of reader threads.
+
+#ifndef ABSL_SYNCHRONIZATION_READER_BIASED_MUTEX_H_
+#define ABSL_SYNCHRONIZATION_READER_BIASED_MUTEX_H_
+
+#include <atomic>
+#include <cstdint>
+
+#include "absl/base/config.h"
+#include "absl/base/nullability.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/synchronization/mutex.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+// ReaderBiasedMutex
+//
+// A `ReaderBiasedMutex` is a reader-writer lock for read-mostly data. Every
+// `ReaderLock()` of a `Mutex` updates the `Mutex` word, so that concurrent
+// readers on many CPUs contend for its cache line. While a
+// `ReaderBiasedMutex` is read-biased, a reader instead publishes itself in a
+// slot of a global table of visible readers, picked by hashing the lock and
+// the thread, so that readers rarely share cache lines.
+//
+// A writer acquires an underlying `Mutex`, revokes the bias, and waits for the
+// visible readers of the lock to leave. Readers that find the bias revoked, or
+// their slot taken, use the underlying `Mutex` instead. Since revocation is
+// costly, the bias is only restored, by a later reader, once a multiple of
+// the last revocation's duration has passed. Write-heavy phases thus behave
+// like a plain `Mutex`. (This is the BRAVO scheme of Dice and Kogan.)
+//
+// As with `Mutex`, locks are not reentrant. A thread may hold up to
+// `kMaxBiasedReadLocks` `ReaderBiasedMutex` read locks through the biased
+// path at once; further read locks use the underlying `Mutex`.
+//
+// Waiting on an `absl::Condition` is supported by `LockWhen()`,
+// `ReaderLockWhen()` and, for writers, `Await()`.
+class ABSL_LOCKABLE ReaderBiasedMutex {
+ public:
+  // The number of read locks a thread may hold through the biased path.
+  static constexpr int kMaxBiasedReadLocks = 8;
+
+  ReaderBiasedMutex() = default;
+
+  ReaderBiasedMutex(const ReaderBiasedMutex&) = delete;
+  ReaderBiasedMutex& operator=(const ReaderBiasedMutex&) = delete;
+
+  // ReaderBiasedMutex::Lock()
+  //
+  // Blocks until the lock is free, then acquires it exclusively.
+  void Lock() ABSL_EXCLUSIVE_LOCK_FUNCTION();
+
+  // ReaderBiasedMutex::TryLock()
+  //
+  // Acquires the lock exclusively if it can do so without blocking, and
+  // returns whether it did.
+  [[nodiscard]] bool TryLock() ABSL_EXCLUSIVE_TRYLOCK_FUNCTION(true);
+
+  // ReaderBiasedMutex::Unlock()
+  //
+  // Releases a lock acquired exclusively.
+  void Unlock() ABSL_UNLOCK_FUNCTION();
+
+  // ReaderBiasedMutex::ReaderLock()
+  //
+  // Blocks until no writer holds or waits for the lock, then acquires it for
+  // reading.
+  void ReaderLock() ABSL_SHARED_LOCK_FUNCTION();
+
+  // ReaderBiasedMutex::ReaderUnlock()
+  //
+  // Releases a lock acquired for reading.
+  void ReaderUnlock() ABSL_UNLOCK_FUNCTION();
+
+  // ReaderBiasedMutex::LockWhen()
+  // ReaderBiasedMutex::ReaderLockWhen()
+  //
+  // Like `Lock()` and `ReaderLock()`, but also blocks until `cond` is true.
+  // `cond` is evaluated with the underlying `Mutex` held, so it may only
+  // depend on state that is modified under this lock held exclusively.
+  void LockWhen(const Condition& cond) ABSL_EXCLUSIVE_LOCK_FUNCTION();
+  void ReaderLockWhen(const Condition& cond) ABSL_SHARED_LOCK_FUNCTION();
+
+  // ReaderBiasedMutex::Await()
+  //
+  // Releases the lock, which must be held exclusively, until `cond` is true,
+  // then reacquires it exclusively.
+  void Await(const Condition& cond) ABSL_EXCLUSIVE_LOCKS_REQUIRED(this);
+
+  // ReaderBiasedMutex::AssertHeld()
+  //
+  // Requires that the lock be held exclusively by this thread.
+  void AssertHeld() const ABSL_ASSERT_EXCLUSIVE_LOCK() { mu_.AssertHeld(); }
+
+ private:
+  // Called with `mu_` held exclusively, to wait for the visible readers to
+  // leave. Returns false if `wait` is false and there are visible readers.
+  bool RevokeBias(bool wait) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // Called with `mu_` held, to restore the bias if it was revoked long enough
+  // ago.
+  void MaybeRestoreBias() ABSL_SHARED_LOCKS_REQUIRED(mu_);
+
+  absl::Mutex mu_;
+  // Whether readers may use the visible reader table.
+  std::atomic<bool> read_bias_{true};
+  // The cycle count before which the bias must not be restored.
+  std::atomic<int64_t> inhibit_until_cycles_{0};
+};
+
+// ReaderBiasedMutexLock
+//
+// `ReaderBiasedMutexLock` is a helper class, which acquires and releases a
+// `ReaderBiasedMutex` exclusively via RAII.
+class ABSL_SCOPED_LOCKABLE ReaderBiasedMutexLock {
+ public:
+  explicit ReaderBiasedMutexLock(ReaderBiasedMutex* absl_nonnull mu)
+      ABSL_EXCLUSIVE_LOCK_FUNCTION(mu)
+      : mu_(mu) {
+    mu_->Lock();
+  }
+
+  ReaderBiasedMutexLock(const ReaderBiasedMutexLock&) = delete;
+  ReaderBiasedMutexLock& operator=(const ReaderBiasedMutexLock&) = delete;
+
+  ~ReaderBiasedMutexLock() ABSL_UNLOCK_FUNCTION() { mu_->Unlock(); }
+
+ private:
+  ReaderBiasedMutex* absl_nonnull const mu_;
+};
+
+// ReaderBiasedReaderMutexLock
+//
+// `ReaderBiasedReaderMutexLock` is a helper class, which acquires and
+// releases a `ReaderBiasedMutex` for reading via RAII.
+class ABSL_SCOPED_LOCKABLE ReaderBiasedReaderMutexLock {
+ public:
+  explicit ReaderBiasedReaderMutexLock(ReaderBiasedMutex* absl_nonnull mu)
+      ABSL_SHARED_LOCK_FUNCTION(mu)
+      : mu_(mu) {
+    mu_->ReaderLock();
+  }
+
+  ReaderBiasedReaderMutexLock(const ReaderBiasedReaderMutexLock&) = delete;
+  ReaderBiasedReaderMutexLock& operator=(const ReaderBiasedReaderMutexLock&) =
+      delete;
+
+  ~ReaderBiasedReaderMutexLock() ABSL_UNLOCK_FUNCTION() {
+    mu_->ReaderUnlock();
+  }
+
+ private:
+  ReaderBiasedMutex* absl_nonnull const mu_;
+};
+
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_SYNCHRONIZATION_READER_BIASED_MUTEX_H_
@@ -0,0 +1,66 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Compares the read scaling of `absl::ReaderBiasedMutex` with the shared mode
+// of `absl::Mutex`.
+
+#include <cstdint>
+
+#include "absl/profiling/benchmark.h"
+#include "absl/base/no_destructor.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/synchronization/reader_biased_mutex.h"
+
+namespace {
+
+// Data read by every thread, such as a small configuration or routing table.
+struct Table {
+  int64_t entries[8] = {};
+};
+
+// Each thread reads the table under a shared lock, and one in
+// `state.range(0)` of its operations is a write under an exclusive lock; a
+// range of 0 means no writes.
+template <typename MutexType>
+void BM_ReadMostly(benchmark::State& state) {
+  static absl::NoDestructor<MutexType> mu;
+  static absl::NoDestructor<Table> table;
+  const int64_t write_every = state.range(0);
+  int64_t ops = 0;
+  int64_t sum = 0;
+  for (auto _ : state) {
+    if (write_every > 0 && ++ops % write_every == 0) {
+      mu->Lock();
+      for (int64_t& entry : table->entries) ++entry;
+      mu->Unlock();
+    } else {
+      mu->ReaderLock();
+      for (int64_t entry : table->entries) sum += entry;
+      mu->ReaderUnlock();
+    }
+  }
+  benchmark::DoNotOptimize(sum);
+  state.SetItemsProcessed(state.iterations());
+}
+
+void SetupReadMostlyArgs(benchmark::internal::Benchmark* bm) {
+  bm->UseRealTime()->ThreadRange(1, 128)->ArgName("write_every");
+  for (int write_every : {0, 10000, 100}) bm->Arg(write_every);
+}
+
+BENCHMARK_TEMPLATE(BM_ReadMostly, absl::Mutex)->Apply(SetupReadMostlyArgs);
+BENCHMARK_TEMPLATE(BM_ReadMostly, absl::ReaderBiasedMutex)
+    ->Apply(SetupReadMostlyArgs);
+
+}  // namespace
@@ -0,0 +1,156 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/synchronization/reader_biased_mutex.h"
+
+#include <atomic>
+#include <thread>  // NOLINT(build/c++11)
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "absl/base/config.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/synchronization/notification.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+namespace {
+
+// Readers check that two counters updated together by writers are always
+// equal, across many switches between the biased and unbiased paths.
+TEST(ReaderBiasedMutex, ReadersSeeConsistentState) {
+  constexpr int kReaders = 6;
+  constexpr int kWriters = 2;
+  constexpr int kIterations = 20000;
+  ReaderBiasedMutex mu;
+  int a = 0;
+  int b = 0;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kReaders; ++t) {
+    threads.emplace_back([&] {
+      for (int i = 0; i < kIterations; ++i) {
+        ReaderBiasedReaderMutexLock lock(&mu);
+        EXPECT_EQ(a, b);
+      }
+    });
+  }
+  for (int t = 0; t < kWriters; ++t) {
+    threads.emplace_back([&] {
+      for (int i = 0; i < kIterations / 10; ++i) {
+        ReaderBiasedMutexLock lock(&mu);
+        ++a;
+        ++b;
+      }
+    });
+  }
+  for (std::thread& thread : threads) thread.join();
+  EXPECT_EQ(a, kWriters * (kIterations / 10));
+  EXPECT_EQ(b, a);
+}
+
+TEST(ReaderBiasedMutex, ReadersShareTheLock) {
+  constexpr int kReaders = 4;
+  ReaderBiasedMutex mu;
+  std::atomic<int> inside{0};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kReaders; ++t) {
+    threads.emplace_back([&] {
+      ReaderBiasedReaderMutexLock lock(&mu);
+      // Returns only once every reader holds the lock.
+      inside.fetch_add(1);
+      while (inside.load() < kReaders) std::this_thread::yield();
+    });
+  }
+  for (std::thread& thread : threads) thread.join();
+}
+
+TEST(ReaderBiasedMutex, WriterWaitsForReaders) {
+  ReaderBiasedMutex mu;
+  std::atomic<bool> reader_done{false};
+  absl::Notification reader_inside;
+  absl::Notification writer_done;
+  std::thread reader([&] {
+    mu.ReaderLock();
+    reader_inside.Notify();
+    absl::SleepFor(absl::Milliseconds(50));
+    reader_done.store(true);
+    mu.ReaderUnlock();
+  });
+  reader_inside.WaitForNotification();
+  EXPECT_FALSE(mu.TryLock());
+  mu.Lock();
+  EXPECT_TRUE(reader_done.load());
+  mu.Unlock();
+  reader.join();
+
+  // Readers that arrive while the bias is revoked wait for the writer too.
+  mu.Lock();
+  std::thread late_reader([&] {
+    ReaderBiasedReaderMutexLock lock(&mu);
+    EXPECT_TRUE(writer_done.HasBeenNotified());
+  });
+  absl::SleepFor(absl::Milliseconds(50));
+  writer_done.Notify();
+  mu.Unlock();
+  late_reader.join();
+}
+
+TEST(ReaderBiasedMutex, ManyReadLocksPerThread) {
+  constexpr int kLocks = 3 * ReaderBiasedMutex::kMaxBiasedReadLocks;
+  std::vector<ReaderBiasedMutex> mus(kLocks);
+  for (ReaderBiasedMutex& mu : mus) mu.ReaderLock();
+  std::thread writer([&] {
+    for (ReaderBiasedMutex& mu : mus) EXPECT_FALSE(mu.TryLock());
+  });
+  writer.join();
+  // Release out of order, mixing locks held through either path.
+  for (int i = 0; i < kLocks; i += 2) mus[i].ReaderUnlock();
+  for (int i = 1; i < kLocks; i += 2) mus[i].ReaderUnlock();
+  for (ReaderBiasedMutex& mu : mus) {
+    ASSERT_TRUE(mu.TryLock());
+    mu.Unlock();
+  }
+}
+
+bool IsPositive(int* value) { return *value > 0; }
+bool IsTwo(int* value) { return *value == 2; }
+
+TEST(ReaderBiasedMutex, Conditions) {
+  ReaderBiasedMutex mu;
+  int value = 0;
+  std::thread reader([&] {
+    mu.ReaderLockWhen(absl::Condition(IsPositive, &value));
+    EXPECT_GT(value, 0);
+    mu.ReaderUnlock();
+  });
+  std::thread writer([&] {
+    mu.LockWhen(absl::Condition(IsPositive, &value));
+    value = 2;
+    mu.Unlock();
+  });
+  absl::SleepFor(absl::Milliseconds(10));
+  mu.Lock();
+  value = 1;
+  mu.Await(absl::Condition(IsTwo, &value));
+  EXPECT_EQ(value, 2);
+  mu.Unlock();
+  reader.join();
+  writer.join();
+}
+
+}  // namespace
+ABSL_NAMESPACE_END
+}  // namespace absl
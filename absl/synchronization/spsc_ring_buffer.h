@@ -0,0 +1,171 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// -----------------------------------------------------------------------------
+// spsc_ring_buffer.h
+// -----------------------------------------------------------------------------
+//
+// This header file defines `absl::SpscRingBuffer<T>`, a fixed-capacity FIFO
+// queue between one producer thread and one consumer thread.
+//
+// Example:
+//
+//   absl::SpscRingBuffer<Packet> ring(256);
+//
+//   // The producer:
+//   ring.Push(std::move(packet));  // Blocks while the ring is full.
+//
+//   // The consumer:
+//   Packet packet = ring.Pop();  // Blocks while the ring is empty.
+
+#ifndef ABSL_SYNCHRONIZATION_SPSC_RING_BUFFER_H_
+#define ABSL_SYNCHRONIZATION_SPSC_RING_BUFFER_H_
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+#include "absl/base/config.h"
+#include "absl/base/optimization.h"
+#include "absl/numeric/bits.h"
+#include "absl/synchronization/internal/parking_list.h"
+#include "absl/types/optional.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+// SpscRingBuffer
+//
+// A bounded single-producer single-consumer FIFO queue. The producer only
+// writes the tail index and the consumer only writes the head index, each on
+// its own cache line, and each side caches the other's index, so that it only
+// reads the other side's cache line when the ring looks full or empty.
+//
+// At most one thread may push and at most one thread may pop at any time.
+// `TryPush()` and `TryPop()` never block. `Push()` and `Pop()` park the
+// calling thread on its semaphore while the ring is full or empty.
+//
+// `T` must be move-constructible, and its move constructor must not throw.
+template <typename T>
+class SpscRingBuffer {
+ public:
+  // Creates an empty ring that holds up to `capacity` elements, rounded up to
+  // a power of two.
+  explicit SpscRingBuffer(size_t capacity)
+      : mask_(absl::bit_ceil(capacity < 1 ? size_t{1} : capacity) - 1),
+        slots_(new Slot[mask_ + 1]) {}
+
+  SpscRingBuffer(const SpscRingBuffer&) = delete;
+  SpscRingBuffer& operator=(const SpscRingBuffer&) = delete;
+
+  // Destroys the elements left in the ring. No thread may be using it.
+  ~SpscRingBuffer() {
+    const size_t end = tail_.load(std::memory_order_relaxed);
+    for (size_t pos = head_.load(std::memory_order_relaxed); pos != end;
+         ++pos) {
+      slots_[pos & mask_].value()->~T();
+    }
+  }
+
+  // SpscRingBuffer::TryPush()
+  // SpscRingBuffer::TryEmplace()
+  //
+  // Adds an element at the back of the ring and returns true, or returns
+  // false if the ring is full, in which case `value` is left unchanged.
+  bool TryPush(T&& value) { return TryEmplace(std::move(value)); }
+  bool TryPush(const T& value) { return TryEmplace(value); }
+  template <typename... Args>
+  bool TryEmplace(Args&&... args) {
+    const size_t tail = tail_.load(std::memory_order_relaxed);
+    if (tail - cached_head_ > mask_) {
+      cached_head_ = head_.load(std::memory_order_acquire);
+      if (tail - cached_head_ > mask_) return false;  // Full.
+    }
+    ::new (static_cast<void*>(slots_[tail & mask_].storage))
+        T(std::forward<Args>(args)...);
+    tail_.store(tail + 1, std::memory_order_release);
+    not_empty_.WakeOne();
+    return true;
+  }
+
+  // SpscRingBuffer::Push()
+  //
+  // Adds `value` at the back of the ring, waiting while the ring is full.
+  void Push(T value) {
+    not_full_.ParkUntil([&] { return TryPush(std::move(value)); });
+  }
+
+  // SpscRingBuffer::TryPop()
+  //
+  // Removes and returns the element at the front of the ring, or returns
+  // `absl::nullopt` if the ring is empty.
+  absl::optional<T> TryPop() {
+    absl::optional<T> value;
+    TryPopInto(&value);
+    return value;
+  }
+
+  // SpscRingBuffer::Pop()
+  //
+  // Removes and returns the element at the front of the ring, waiting while
+  // the ring is empty.
+  T Pop() {
+    absl::optional<T> value;
+    not_empty_.ParkUntil([&] { return TryPopInto(&value); });
+    return *std::move(value);
+  }
+
+  // Returns the maximum number of elements in the ring.
+  size_t capacity() const { return mask_ + 1; }
+
+ private:
+  struct Slot {
+    T* value() { return std::launder(reinterpret_cast<T*>(storage)); }
+
+    alignas(T) unsigned char storage[sizeof(T)];
+  };
+
+  bool TryPopInto(absl::optional<T>* value) {
+    const size_t head = head_.load(std::memory_order_relaxed);
+    if (head == cached_tail_) {
+      cached_tail_ = tail_.load(std::memory_order_acquire);
+      if (head == cached_tail_) return false;  // Empty.
+    }
+    Slot& slot = slots_[head & mask_];
+    value->emplace(std::move(*slot.value()));
+    slot.value()->~T();
+    head_.store(head + 1, std::memory_order_release);
+    not_full_.WakeOne();
+    return true;
+  }
+
+  const size_t mask_;
+  std::unique_ptr<Slot[]> slots_;
+  // Written by the consumer.
+  alignas(ABSL_CACHELINE_SIZE) std::atomic<size_t> head_{0};
+  size_t cached_tail_ = 0;
+  // Written by the producer.
+  alignas(ABSL_CACHELINE_SIZE) std::atomic<size_t> tail_{0};
+  size_t cached_head_ = 0;
+  // The consumer waiting for an element, and the producer waiting for room.
+  alignas(ABSL_CACHELINE_SIZE) synchronization_internal::ParkingList not_empty_;
+  alignas(ABSL_CACHELINE_SIZE) synchronization_internal::ParkingList not_full_;
+};
+
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_SYNCHRONIZATION_SPSC_RING_BUFFER_H_
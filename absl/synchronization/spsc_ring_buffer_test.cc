@@ -0,0 +1,82 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/synchronization/spsc_ring_buffer.h"
+
+#include <memory>
+#include <string>
+#include <thread>  // NOLINT(build/c++11)
+
+#include "gtest/gtest.h"
+#include "absl/base/config.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+
+namespace {
+
+TEST(SpscRingBufferTest, Capacity) {
+  EXPECT_EQ(absl::SpscRingBuffer<int>(0).capacity(), 1);
+  EXPECT_EQ(absl::SpscRingBuffer<int>(1).capacity(), 1);
+  EXPECT_EQ(absl::SpscRingBuffer<int>(3).capacity(), 4);
+  EXPECT_EQ(absl::SpscRingBuffer<int>(64).capacity(), 64);
+}
+
+TEST(SpscRingBufferTest, Fifo) {
+  absl::SpscRingBuffer<std::string> ring(4);
+  EXPECT_EQ(ring.TryPop(), absl::nullopt);
+  for (int lap = 0; lap < 3; ++lap) {
+    for (int i = 0; i < 4; ++i) EXPECT_TRUE(ring.TryPush(std::to_string(i)));
+    std::string rejected = "rejected";
+    EXPECT_FALSE(ring.TryPush(std::move(rejected)));
+    EXPECT_EQ(rejected, "rejected");
+    for (int i = 0; i < 4; ++i) EXPECT_EQ(ring.TryPop(), std::to_string(i));
+    EXPECT_EQ(ring.TryPop(), absl::nullopt);
+  }
+}
+
+TEST(SpscRingBufferTest, Destruction) {
+  auto counter = std::make_shared<int>(0);
+  {
+    absl::SpscRingBuffer<std::shared_ptr<int>> ring(4);
+    ring.Push(counter);
+    ring.Push(counter);
+    EXPECT_EQ(counter.use_count(), 3);
+  }
+  EXPECT_EQ(counter.use_count(), 1);
+}
+
+TEST(SpscRingBufferTest, BlockingProducerAndConsumer) {
+  constexpr int kItems = 100000;
+  absl::SpscRingBuffer<int> ring(8);
+  std::thread producer([&] {
+    for (int i = 0; i < kItems; ++i) ring.Push(i);
+  });
+  for (int i = 0; i < kItems; ++i) ASSERT_EQ(ring.Pop(), i);
+  producer.join();
+  EXPECT_EQ(ring.TryPop(), absl::nullopt);
+}
+
+TEST(SpscRingBufferTest, PushBlocksWhileFull) {
+  absl::SpscRingBuffer<int> ring(1);
+  ring.Push(1);
+  std::thread consumer([&] {
+    absl::SleepFor(absl::Milliseconds(10));
+    EXPECT_EQ(ring.Pop(), 1);
+    EXPECT_EQ(ring.Pop(), 2);
+  });
+  ring.Push(2);
+  consumer.join();
+}
+
+}  // namespace
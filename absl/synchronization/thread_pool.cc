@@ -0,0 +1,322 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/synchronization/thread_pool.h"
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>  // NOLINT(build/c++11)
+#include <utility>
+#include <vector>
+
+#include "absl/base/config.h"
+#include "absl/base/internal/raw_logging.h"
+#include "absl/functional/any_invocable.h"
+#include "absl/synchronization/bounded_queue.h"
+#include "absl/types/optional.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+namespace {
+
+using Task = absl::AnyInvocable<void()>;
+
+// A Chase-Lev work-stealing deque, with the memory orderings of Lê et al.,
+// "Correct and Efficient Work-Stealing for Weak Memory Models" (PPoPP 2013).
+// The owner pushes and pops tasks at the bottom; other threads steal from the
+// top. The array of tasks grows as needed. Replaced arrays may still be read
+// by thieves, so they are kept until the deque is destroyed.
+class WorkStealingDeque {
+ public:
+  WorkStealingDeque() {
+    array_.store(Grow(nullptr, 0, 0), std::memory_order_relaxed);
+  }
+
+  // Adds `task` at the bottom. May only be called by the owner.
+  void Push(Task* task) {
+    const int64_t b = bottom_.load(std::memory_order_relaxed);
+    const int64_t t = top_.load(std::memory_order_acquire);
+    Array* a = array_.load(std::memory_order_relaxed);
+    if (b - t > a->mask) {
+      a = Grow(a, t, b);
+      array_.store(a, std::memory_order_release);
+    }
+    a->slots[b & a->mask].store(task, std::memory_order_relaxed);
+    // The paper's release fence and relaxed store, as a release store, which
+    // ThreadSanitizer understands.
+    bottom_.store(b + 1, std::memory_order_release);
+  }
+
+  // Removes the newest task, or returns nullptr if there is none. May only be
+  // called by the owner.
+  Task* Pop() {
+    // Only the owner adds tasks, so an empty deque cannot become non-empty
+    // here, and the fence below can be skipped.
+    if (Empty()) return nullptr;
+    const int64_t b = bottom_.load(std::memory_order_relaxed) - 1;
+    Array* a = array_.load(std::memory_order_relaxed);
+    bottom_.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t t = top_.load(std::memory_order_relaxed);
+    if (t > b) {
+      bottom_.store(b + 1, std::memory_order_relaxed);
+      return nullptr;
+    }
+    Task* task = a->slots[b & a->mask].load(std::memory_order_relaxed);
+    if (t == b) {
+      // The last task, which a thief may be stealing.
+      if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                        std::memory_order_relaxed)) {
+        task = nullptr;
+      }
+      bottom_.store(b + 1, std::memory_order_relaxed);
+    }
+    return task;
+  }
+
+  // Removes the oldest task. Returns nullptr if there is none, or if another
+  // thread took it first.
+  Task* Steal() {
+    int64_t t = top_.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const int64_t b = bottom_.load(std::memory_order_acquire);
+    if (t >= b) return nullptr;
+    Array* a = array_.load(std::memory_order_acquire);
+    Task* task = a->slots[t & a->mask].load(std::memory_order_relaxed);
+    if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                      std::memory_order_relaxed)) {
+      return nullptr;
+    }
+    return task;
+  }
+
+  bool Empty() const {
+    return top_.load(std::memory_order_seq_cst) >=
+           bottom_.load(std::memory_order_seq_cst);
+  }
+
+ private:
+  static constexpr int64_t kInitialCapacity = 64;
+
+  struct Array {
+    explicit Array(int64_t capacity)
+        : mask(capacity - 1), slots(new std::atomic<Task*>[capacity]) {}
+
+    int64_t mask;
+    std::unique_ptr<std::atomic<Task*>[]> slots;
+  };
+
+  // Returns a new array twice the size of `a`, holding its tasks in
+  // `[t, b)`, or the initial array if `a` is null.
+  Array* Grow(Array* a, int64_t t, int64_t b) {
+    arrays_.push_back(std::make_unique<Array>(
+        a == nullptr ? kInitialCapacity : 2 * (a->mask + 1)));
+    Array* grown = arrays_.back().get();
+    for (int64_t i = t; i < b; ++i) {
+      grown->slots[i & grown->mask].store(
+          a->slots[i & a->mask].load(std::memory_order_relaxed),
+          std::memory_order_relaxed);
+    }
+    return grown;
+  }
+
+  alignas(ABSL_CACHELINE_SIZE) std::atomic<int64_t> top_{0};
+  alignas(ABSL_CACHELINE_SIZE) std::atomic<int64_t> bottom_{0};
+  std::atomic<Array*> array_{nullptr};
+  // Every array allocated, owned by the owner thread.
+  std::vector<std::unique_ptr<Array>> arrays_;
+};
+
+// The number of times an idle worker looks for tasks before parking.
+constexpr int kSpinRounds = 4;
+
+// The most emptied deque tasks a worker keeps for reuse.
+constexpr size_t kMaxFreeTasks = 256;
+
+}  // namespace
+
+class ABSL_CACHELINE_ALIGNED ThreadPool::Worker {
+ public:
+  Worker(size_t queue_capacity, uint32_t seed)
+      : submitted(queue_capacity), rng(seed) {}
+
+  // Returns a pseudo-random number, to pick steal victims.
+  uint32_t NextRandom() {
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+  }
+
+  // Returns a task to push onto a deque holding `func`, reusing one that this
+  // worker emptied if it can. May only be called by this worker.
+  Task* NewTask(Task&& func) {
+    if (free_tasks.empty()) return new Task(std::move(func));
+    Task* task = free_tasks.back().release();
+    free_tasks.pop_back();
+    *task = std::move(func);
+    return task;
+  }
+
+  // Moves `*from`, a task taken from a deque, to `*task`, and keeps `from` for
+  // reuse. Returns false if `from` is null. May only be called by this worker.
+  bool TakeTask(Task* from, Task* task) {
+    if (from == nullptr) return false;
+    *task = std::move(*from);
+    if (free_tasks.size() < kMaxFreeTasks) {
+      free_tasks.emplace_back(from);
+    } else {
+      delete from;
+    }
+    return true;
+  }
+
+  // Tasks scheduled by this worker's own tasks.
+  WorkStealingDeque deque;
+  // Emptied deque tasks, which workers keep rather than free, so that
+  // scheduling from a worker does not allocate in the steady state. Tasks
+  // move between workers' lists when stolen.
+  std::vector<std::unique_ptr<Task>> free_tasks;
+  // Tasks scheduled by other threads.
+  BoundedQueue<Task> submitted;
+  std::thread thread;
+  uint32_t rng;
+};
+
+namespace {
+
+// The pool and index of the worker running on this thread, if any.
+ABSL_CONST_INIT thread_local const ThreadPool* current_pool = nullptr;
+ABSL_CONST_INIT thread_local size_t current_index = 0;
+
+}  // namespace
+
+ThreadPool::ThreadPool(int num_threads, size_t queue_capacity) {
+  ABSL_RAW_CHECK(num_threads > 0, "ThreadPool requires at least one thread");
+  // `BoundedQueue` rounds the capacity up to a power of two.
+  const size_t per_worker =
+      (queue_capacity + static_cast<size_t>(num_threads) - 1) /
+      static_cast<size_t>(num_threads);
+  workers_.reserve(static_cast<size_t>(num_threads));
+  for (int i = 0; i < num_threads; ++i) {
+    workers_.push_back(std::make_unique<Worker>(
+        per_worker, 0x9e3779b9u * static_cast<uint32_t>(i + 1)));
+  }
+  // Workers steal from each other, so start them only once all exist.
+  for (size_t i = 0; i < workers_.size(); ++i) {
+    workers_[i]->thread = std::thread([this, i] {
+      current_pool = this;
+      current_index = i;
+      WorkLoop(workers_[i].get());
+      current_pool = nullptr;
+    });
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  stopping_.store(true, std::memory_order_release);
+  // Each worker that wakes to find the pool stopping wakes the next.
+  idle_workers_.WakeOne();
+  for (const std::unique_ptr<Worker>& worker : workers_) {
+    worker->thread.join();
+  }
+}
+
+ThreadPool::Worker* ThreadPool::CurrentWorker() const {
+  return current_pool == this ? workers_[current_index].get() : nullptr;
+}
+
+void ThreadPool::Schedule(absl::AnyInvocable<void()> func) {
+  assert(func != nullptr);
+  if (Worker* self = CurrentWorker()) {
+    self->deque.Push(self->NewTask(std::move(func)));
+  } else if (!Submit(func)) {
+    blocked_submitters_.ParkUntil([&] { return Submit(func); });
+  }
+  idle_workers_.WakeOne();
+}
+
+bool ThreadPool::TrySchedule(absl::AnyInvocable<void()>& func) {
+  assert(func != nullptr);
+  if (Worker* self = CurrentWorker()) {
+    self->deque.Push(self->NewTask(std::move(func)));
+  } else if (!Submit(func)) {
+    return false;
+  }
+  idle_workers_.WakeOne();
+  return true;
+}
+
+bool ThreadPool::Submit(Task& task) {
+  const size_t n = workers_.size();
+  // Submitters that race here may pick the same queue, which is harmless.
+  const size_t start = next_queue_.load(std::memory_order_relaxed);
+  next_queue_.store(start + 1, std::memory_order_relaxed);
+  for (size_t i = 0; i < n; ++i) {
+    if (workers_[(start + i) % n]->submitted.TryPush(std::move(task))) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void ThreadPool::WorkLoop(Worker* self) {
+  Task task;
+  while (true) {
+    bool found = false;
+    for (int i = 0; !found && i < kSpinRounds; ++i) {
+      found = FindTask(self, &task);
+    }
+    if (!found) {
+      // No more tasks can be submitted once the pool is stopping, and tasks
+      // scheduled by the other workers' tasks are theirs to run.
+      idle_workers_.ParkUntil([&] {
+        return FindTask(self, &task) ||
+               stopping_.load(std::memory_order_acquire);
+      });
+      if (task == nullptr) break;
+    }
+    task();
+    task = nullptr;
+  }
+}
+
+bool ThreadPool::FindTask(Worker* self, Task* task) {
+  // Takes a task from `queue`, and lets a blocked submitter use its slot.
+  auto take_submitted = [this, task](BoundedQueue<Task>& queue) {
+    absl::optional<Task> submitted = queue.TryPop();
+    if (!submitted.has_value()) return false;
+    *task = *std::move(submitted);
+    blocked_submitters_.WakeOne();
+    return true;
+  };
+  if (self->TakeTask(self->deque.Pop(), task)) return true;
+  if (take_submitted(self->submitted)) return true;
+  const size_t n = workers_.size();
+  const size_t start = self->NextRandom() % n;
+  for (size_t i = 0; i < n; ++i) {
+    Worker* victim = workers_[(start + i) % n].get();
+    if (victim == self) continue;
+    if (self->TakeTask(victim->deque.Steal(), task)) return true;
+    if (take_submitted(victim->submitted)) return true;
+  }
+  return false;
+}
+
+ABSL_NAMESPACE_END
+}  // namespace absl
@@ -0,0 +1,132 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// -----------------------------------------------------------------------------
+// thread_pool.h
+// -----------------------------------------------------------------------------
+//
+// This header file defines `absl::ThreadPool`, a fixed-size pool of threads
+// that run scheduled functions.
+
+#ifndef ABSL_SYNCHRONIZATION_THREAD_POOL_H_
+#define ABSL_SYNCHRONIZATION_THREAD_POOL_H_
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "absl/base/config.h"
+#include "absl/functional/any_invocable.h"
+#include "absl/synchronization/internal/parking_list.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+// ThreadPool
+//
+// A pool of `num_threads` worker threads that run functions passed to
+// `Schedule()`, in no particular order.
+//
+// Each worker owns a double-ended queue of tasks. Functions scheduled by a
+// task running on a worker are pushed onto that worker's queue and popped in
+// LIFO order, which keeps recursively split work in cache. Workers that run
+// out of tasks steal the oldest tasks of other workers, so fork-join
+// computations spread across the pool without a shared queue.
+//
+// Functions scheduled by other threads are added to bounded per-worker
+// submission queues, round-robin. When all submission queues are full,
+// `Schedule()` blocks until a worker makes room, and `TrySchedule()` fails.
+// Idle workers park on their thread's semaphore rather than on a shared
+// condition variable. Adding work wakes a parked worker only if no other is
+// already looking for tasks, and each woken worker that finds one wakes the
+// next, so bursts of small tasks do not wake every worker.
+//
+// Destroying the pool runs all scheduled functions, including those they
+// schedule in turn, and then joins the workers. Functions must not be
+// scheduled by other threads once destruction has started.
+//
+// Example:
+//
+//   absl::ThreadPool pool(4);
+//   absl::BlockingCounter done(items.size());
+//   for (Item& item : items) {
+//     pool.Schedule([&item, &done] {
+//       Process(item);
+//       done.DecrementCount();
+//     });
+//   }
+//   done.Wait();
+class ThreadPool {
+ public:
+  // The default capacity of the submission queues, in tasks, shared between
+  // the workers.
+  static constexpr size_t kDefaultQueueCapacity = 4096;
+
+  // Starts `num_threads` workers, which must be positive. `queue_capacity`
+  // bounds the number of functions scheduled by non-worker threads that may
+  // wait to run; it is rounded up to a power of two for each worker.
+  explicit ThreadPool(int num_threads,
+                      size_t queue_capacity = kDefaultQueueCapacity);
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  ~ThreadPool();
+
+  // ThreadPool::Schedule()
+  //
+  // Schedules `func` to run on a worker. When called from a thread other than
+  // one of this pool's workers, blocks while the submission queues are full.
+  void Schedule(absl::AnyInvocable<void()> func);
+
+  // ThreadPool::TrySchedule()
+  //
+  // Like `Schedule()`, but rather than blocking on full submission queues,
+  // returns false and leaves `func` unchanged. Returns true, having moved from
+  // `func`, if it was scheduled.
+  bool TrySchedule(absl::AnyInvocable<void()>& func);
+
+  // Returns the number of worker threads.
+  int num_threads() const { return static_cast<int>(workers_.size()); }
+
+ private:
+  using Task = absl::AnyInvocable<void()>;
+  class Worker;
+
+  // Returns the worker of this pool running on the current thread, if any.
+  Worker* CurrentWorker() const;
+  // Moves `task` to one of the submission queues, returning false if all are
+  // full.
+  bool Submit(Task& task);
+
+  void WorkLoop(Worker* self);
+  // Moves a task to `*task`, returning false if none was found.
+  bool FindTask(Worker* self, Task* task);
+
+  std::vector<std::unique_ptr<Worker>> workers_;
+  // The submission queue that receives the next submitted function.
+  std::atomic<size_t> next_queue_{0};
+  std::atomic<bool> stopping_{false};
+
+  // Workers waiting for tasks, and submitters waiting for room in the
+  // submission queues.
+  synchronization_internal::ParkingList idle_workers_;
+  synchronization_internal::ParkingList blocked_submitters_;
+};
+
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_SYNCHRONIZATION_THREAD_POOL_H_
@@ -0,0 +1,148 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Compares `absl::ThreadPool` with the mutex-and-queue pool used by tests.
+
+#include <atomic>
+#include <cstdint>
+
+#include "absl/profiling/benchmark.h"
+#include "absl/synchronization/blocking_counter.h"
+#include "absl/synchronization/internal/thread_pool.h"
+#include "absl/synchronization/notification.h"
+#include "absl/synchronization/thread_pool.h"
+
+namespace {
+
+using WorkStealingPool = absl::ThreadPool;
+using SimplePool = absl::synchronization_internal::ThreadPool;
+
+// Schedules `state.range(1)` empty tasks from the benchmark thread and waits
+// for them, measuring the per-task overhead of submission and dispatch.
+template <typename Pool>
+void BM_TinyTasks(benchmark::State& state) {
+  Pool pool(static_cast<int>(state.range(0)));
+  const int tasks = static_cast<int>(state.range(1));
+  for (auto _ : state) {
+    absl::BlockingCounter done(tasks);
+    for (int i = 0; i < tasks; ++i) {
+      pool.Schedule([&done] { done.DecrementCount(); });
+    }
+    done.Wait();
+  }
+  state.SetItemsProcessed(state.iterations() * tasks);
+}
+BENCHMARK_TEMPLATE(BM_TinyTasks, WorkStealingPool)
+    ->ArgNames({"threads", "tasks"})
+    ->ArgsProduct({{1, 2, 4, 8}, {1000}})
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_TinyTasks, SimplePool)
+    ->ArgNames({"threads", "tasks"})
+    ->ArgsProduct({{1, 2, 4, 8}, {1000}})
+    ->UseRealTime();
+
+// Does a little work that the compiler cannot remove.
+void Spin(int iterations) {
+  uint64_t x = 1;
+  for (int i = 0; i < iterations; ++i) {
+    x = x * 6364136223846793005u + 1442695040888963407u;
+  }
+  benchmark::DoNotOptimize(x);
+}
+
+// A single task fans out `state.range(1)` tasks of moderate size, which fan in
+// on a counter: the shape of a parallel loop issued from within the pool.
+template <typename Pool>
+void BM_FanOutFanIn(benchmark::State& state) {
+  Pool pool(static_cast<int>(state.range(0)));
+  const int tasks = static_cast<int>(state.range(1));
+  for (auto _ : state) {
+    absl::BlockingCounter done(tasks);
+    pool.Schedule([&pool, &done, tasks] {
+      for (int i = 0; i < tasks; ++i) {
+        pool.Schedule([&done] {
+          Spin(1000);
+          done.DecrementCount();
+        });
+      }
+    });
+    done.Wait();
+  }
+  state.SetItemsProcessed(state.iterations() * tasks);
+}
+BENCHMARK_TEMPLATE(BM_FanOutFanIn, WorkStealingPool)
+    ->ArgNames({"threads", "tasks"})
+    ->ArgsProduct({{1, 2, 4, 8}, {256}})
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_FanOutFanIn, SimplePool)
+    ->ArgNames({"threads", "tasks"})
+    ->ArgsProduct({{1, 2, 4, 8}, {256}})
+    ->UseRealTime();
+
+// Recursively splits a range in halves until single elements remain, each
+// split scheduling one half and continuing with the other.
+template <typename Pool>
+void ForkJoin(Pool* pool, int size, absl::BlockingCounter* done) {
+  while (size > 1) {
+    const int half = size / 2;
+    pool->Schedule([pool, half, done] { ForkJoin(pool, half, done); });
+    size -= half;
+  }
+  Spin(100);
+  done->DecrementCount();
+}
+
+template <typename Pool>
+void BM_ForkJoin(benchmark::State& state) {
+  Pool pool(static_cast<int>(state.range(0)));
+  const int leaves = static_cast<int>(state.range(1));
+  for (auto _ : state) {
+    absl::BlockingCounter done(leaves);
+    pool.Schedule([&pool, &done, leaves] { ForkJoin(&pool, leaves, &done); });
+    done.Wait();
+  }
+  state.SetItemsProcessed(state.iterations() * leaves);
+}
+BENCHMARK_TEMPLATE(BM_ForkJoin, WorkStealingPool)
+    ->ArgNames({"threads", "leaves"})
+    ->ArgsProduct({{1, 2, 4, 8}, {4096}})
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ForkJoin, SimplePool)
+    ->ArgNames({"threads", "leaves"})
+    ->ArgsProduct({{1, 2, 4, 8}, {4096}})
+    ->UseRealTime();
+
+// Measures the latency of running one task on an idle pool, including waking
+// a parked worker.
+template <typename Pool>
+void BM_WakeLatency(benchmark::State& state) {
+  Pool pool(static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    absl::Notification done;
+    pool.Schedule([&done] { done.Notify(); });
+    done.WaitForNotification();
+  }
+}
+BENCHMARK_TEMPLATE(BM_WakeLatency, WorkStealingPool)
+    ->ArgName("threads")
+    ->Arg(1)
+    ->Arg(4)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_WakeLatency, SimplePool)
+    ->ArgName("threads")
+    ->Arg(1)
+    ->Arg(4)
+    ->UseRealTime();
+
+}  // namespace
@@ -0,0 +1,151 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/synchronization/thread_pool.h"
+
+#include <atomic>
+#include <thread>  // NOLINT(build/c++11)
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "absl/functional/any_invocable.h"
+#include "absl/synchronization/blocking_counter.h"
+#include "absl/synchronization/notification.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+
+namespace {
+
+TEST(ThreadPool, RunsScheduledFunctions) {
+  constexpr int kTasks = 10000;
+  std::atomic<int> sum{0};
+  absl::BlockingCounter done(kTasks);
+  absl::ThreadPool pool(4);
+  EXPECT_EQ(pool.num_threads(), 4);
+  for (int i = 0; i < kTasks; ++i) {
+    pool.Schedule([i, &sum, &done] {
+      sum.fetch_add(i, std::memory_order_relaxed);
+      done.DecrementCount();
+    });
+  }
+  done.Wait();
+  EXPECT_EQ(sum.load(), kTasks * (kTasks - 1) / 2);
+}
+
+// Recursively splits `[begin, end)` into tasks, counting its elements.
+void ForkJoin(absl::ThreadPool* pool, int begin, int end,
+              std::atomic<int>* count, absl::BlockingCounter* done) {
+  if (end - begin == 1) {
+    count->fetch_add(1, std::memory_order_relaxed);
+    done->DecrementCount();
+    return;
+  }
+  const int mid = begin + (end - begin) / 2;
+  pool->Schedule([=] { ForkJoin(pool, begin, mid, count, done); });
+  ForkJoin(pool, mid, end, count, done);
+}
+
+TEST(ThreadPool, TasksScheduleTasks) {
+  constexpr int kLeaves = 1 << 14;
+  std::atomic<int> count{0};
+  absl::BlockingCounter done(kLeaves);
+  absl::ThreadPool pool(3);
+  pool.Schedule([&] { ForkJoin(&pool, 0, kLeaves, &count, &done); });
+  done.Wait();
+  EXPECT_EQ(count.load(), kLeaves);
+}
+
+TEST(ThreadPool, DestructorRunsPendingFunctions) {
+  std::atomic<int> count{0};
+  {
+    absl::ThreadPool pool(2);
+    for (int i = 0; i < 1000; ++i) {
+      pool.Schedule([&count, &pool] {
+        // Functions scheduled while the pool is being destroyed also run.
+        pool.Schedule([&count] { count.fetch_add(1); });
+        count.fetch_add(1);
+      });
+    }
+  }
+  EXPECT_EQ(count.load(), 2000);
+}
+
+TEST(ThreadPool, BoundedQueues) {
+  absl::ThreadPool pool(1, /*queue_capacity=*/2);
+  absl::Notification release;
+  absl::Notification running;
+  pool.Schedule([&] {
+    running.Notify();
+    release.WaitForNotification();
+  });
+  running.WaitForNotification();
+
+  // The worker is blocked, so the queue fills up.
+  std::atomic<int> count{0};
+  int queued = 0;
+  absl::AnyInvocable<void()> task = [&count] { count.fetch_add(1); };
+  while (pool.TrySchedule(task)) {
+    ++queued;
+    task = [&count] { count.fetch_add(1); };
+  }
+  EXPECT_EQ(queued, 2);
+  // A function that could not be scheduled is left unchanged.
+  EXPECT_NE(task, nullptr);
+
+  // `Schedule()` waits for room.
+  absl::Notification scheduled;
+  std::thread submitter([&] {
+    pool.Schedule([&count] { count.fetch_add(1); });
+    scheduled.Notify();
+  });
+  absl::SleepFor(absl::Milliseconds(10));
+  EXPECT_FALSE(scheduled.HasBeenNotified());
+  release.Notify();
+  submitter.join();
+  EXPECT_TRUE(scheduled.HasBeenNotified());
+}
+
+TEST(ThreadPool, ManySubmitters) {
+  constexpr int kThreads = 4;
+  constexpr int kTasksPerThread = 5000;
+  std::atomic<int> count{0};
+  {
+    absl::ThreadPool pool(3, /*queue_capacity=*/64);
+    std::vector<std::thread> submitters;
+    for (int t = 0; t < kThreads; ++t) {
+      submitters.emplace_back([&] {
+        for (int i = 0; i < kTasksPerThread; ++i) {
+          pool.Schedule([&count] { count.fetch_add(1); });
+        }
+      });
+    }
+    for (std::thread& t : submitters) t.join();
+  }
+  EXPECT_EQ(count.load(), kThreads * kTasksPerThread);
+}
+
+TEST(ThreadPool, IdleWorkersWake) {
+  absl::ThreadPool pool(4);
+  for (int round = 0; round < 100; ++round) {
+    // Let the workers park between rounds.
+    if (round % 10 == 0) absl::SleepFor(absl::Milliseconds(1));
+    absl::BlockingCounter done(8);
+    for (int i = 0; i < 8; ++i) {
+      pool.Schedule([&done] { done.DecrementCount(); });
+    }
+    done.Wait();
+  }
+}
+
+}  // namespace
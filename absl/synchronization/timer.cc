@@ -0,0 +1,271 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/synchronization/timer.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>  // NOLINT(build/c++11)
+#include <cstdint>
+#include <limits>
+#include <thread>  // NOLINT(build/c++11)
+#include <utility>
+
+#include "absl/base/attributes.h"
+#include "absl/base/config.h"
+#include "absl/base/internal/raw_logging.h"
+#include "absl/base/internal/spinlock.h"
+#include "absl/base/internal/thread_identity.h"
+#include "absl/base/no_destructor.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/functional/any_invocable.h"
+#include "absl/synchronization/internal/coalesced_timed_wait.h"
+#include "absl/synchronization/internal/create_thread_identity.h"
+#include "absl/synchronization/internal/kernel_timeout.h"
+#include "absl/synchronization/internal/per_thread_sem.h"
+#include "absl/synchronization/internal/shared_timer.h"
+#include "absl/synchronization/internal/timer_wheel.h"
+#include "absl/synchronization/internal/waiter.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+namespace synchronization_internal {
+
+namespace {
+
+// The wheel ticks once per microsecond; the slack is a multiple of that.
+constexpr int64_t kNanosPerTick = 1000;
+ABSL_CONST_INIT std::atomic<int64_t> slack_ticks{1000};
+
+ABSL_CONST_INIT std::atomic<bool> coalesce_timed_waits{false};
+
+// The timer thread's identity, once it has started.
+ABSL_CONST_INIT std::atomic<base_internal::ThreadIdentity*>
+    timer_thread_identity{nullptr};
+
+ABSL_CONST_INIT std::atomic<int64_t> timer_thread_wakeups{0};
+
+// A tick that no timer is due before, for a timer thread that is awake and
+// will look at the wheel before it sleeps again.
+constexpr int64_t kAwake = (std::numeric_limits<int64_t>::min)();
+
+// The timers of the process and the thread that fires them. A `SpinLock`
+// protects them rather than a `Mutex`, since timed waits use the wheel from
+// within `Mutex` and `CondVar` operations.
+class TimerService {
+ public:
+  TimerService() : wheel_(SteadyClockNowNanos() / kNanosPerTick) {
+    std::thread([this] { Run(); }).detach();
+  }
+
+  void Schedule(SharedTimer* timer, int64_t deadline) {
+    const int64_t slack = slack_ticks.load(std::memory_order_relaxed);
+    int64_t tick = deadline / kNanosPerTick + (deadline % kNanosPerTick > 0);
+    tick = (tick / slack + (tick % slack > 0)) * slack;
+    base_internal::ThreadIdentity* to_wake = nullptr;
+    {
+      base_internal::SpinLockHolder l(&lock_);
+      wheel_.Insert(timer, tick);
+      const int64_t due =
+          tick <= wheel_.now() ? wheel_.now() : wheel_.NextDueTick();
+      if (due < sleep_until_) {
+        sleep_until_ = kAwake;
+        to_wake = timer_thread_identity.load(std::memory_order_relaxed);
+      }
+    }
+    if (to_wake != nullptr) {
+      ABSL_INTERNAL_C_SYMBOL(AbslInternalPerThreadSemPost)(to_wake);
+    }
+  }
+
+  bool Cancel(SharedTimer* timer) {
+    const bool on_timer_thread =
+        base_internal::CurrentThreadIdentityIfPresent() ==
+        timer_thread_identity.load(std::memory_order_relaxed);
+    lock_.Lock();
+    if (timer->linked()) {
+      wheel_.Remove(timer);
+      lock_.Unlock();
+      return true;
+    }
+    while (firing_ == timer && !on_timer_thread) {
+      lock_.Unlock();
+      std::this_thread::yield();
+      lock_.Lock();
+    }
+    lock_.Unlock();
+    return false;
+  }
+
+  bool FiringOnThisThread(const SharedTimer* timer) {
+    if (base_internal::CurrentThreadIdentityIfPresent() !=
+        timer_thread_identity.load(std::memory_order_relaxed)) {
+      return false;
+    }
+    base_internal::SpinLockHolder l(&lock_);
+    return firing_ == timer;
+  }
+
+ private:
+  void Run() {
+    base_internal::ThreadIdentity* self = GetOrCreateCurrentThreadIdentity();
+    timer_thread_identity.store(self, std::memory_order_relaxed);
+    lock_.Lock();
+    for (;;) {
+      wheel_.Advance(SteadyClockNowNanos() / kNanosPerTick);
+      if (auto* timer = static_cast<SharedTimer*>(wheel_.PopExpired())) {
+        firing_ = timer;
+        lock_.Unlock();
+        timer->fire(timer);
+        lock_.Lock();
+        firing_ = nullptr;
+        continue;
+      }
+      const int64_t next = wheel_.NextDueTick();
+      sleep_until_ = next;
+      lock_.Unlock();
+      const KernelTimeout timeout =
+          next == TimerWheel::kNever
+              ? KernelTimeout::Never()
+              : KernelTimeout(absl::Nanoseconds(next * kNanosPerTick -
+                                                SteadyClockNowNanos()));
+      // Timed waits of this thread bypass the wheel.
+      ABSL_INTERNAL_C_SYMBOL(AbslInternalPerThreadSemWait)(timeout);
+      timer_thread_wakeups.fetch_add(1, std::memory_order_relaxed);
+      lock_.Lock();
+      sleep_until_ = kAwake;
+    }
+  }
+
+  base_internal::SpinLock lock_{base_internal::SCHEDULE_KERNEL_ONLY};
+  TimerWheel wheel_ ABSL_GUARDED_BY(lock_);
+  // The tick until which the timer thread sleeps, or kAwake.
+  int64_t sleep_until_ ABSL_GUARDED_BY(lock_) = kAwake;
+  // The timer whose `fire` is running, if any.
+  SharedTimer* firing_ ABSL_GUARDED_BY(lock_) = nullptr;
+};
+
+TimerService& Service() {
+  static absl::NoDestructor<TimerService> service;
+  return *service;
+}
+
+}  // namespace
+
+void ScheduleSharedTimer(SharedTimer* timer, int64_t deadline) {
+  Service().Schedule(timer, deadline);
+}
+
+bool CancelSharedTimer(SharedTimer* timer) {
+  return Service().Cancel(timer);
+}
+
+bool SharedTimerFiringOnThisThread(const SharedTimer* timer) {
+  return Service().FiringOnThisThread(timer);
+}
+
+int64_t SteadyClockNowNanos() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+int64_t SharedTimerWakeups() {
+  return timer_thread_wakeups.load(std::memory_order_relaxed);
+}
+
+bool ShouldCoalesceTimedWait(base_internal::ThreadIdentity* identity) {
+  return coalesce_timed_waits.load(std::memory_order_relaxed) &&
+         identity != timer_thread_identity.load(std::memory_order_relaxed);
+}
+
+bool CoalescedTimedWait(base_internal::ThreadIdentity* identity,
+                        KernelTimeout t) {
+  Waiter* waiter = Waiter::GetWaiter(identity);
+  const int64_t remaining = t.ToChronoDuration().count();
+  if (remaining <= 0) return waiter->Wait(t);
+
+  struct WaitTimer : SharedTimer {
+    base_internal::ThreadIdentity* identity;
+  } timer;
+  timer.identity = identity;
+  timer.fire = [](SharedTimer* fired) {
+    ABSL_INTERNAL_C_SYMBOL(AbslInternalPerThreadSemPost)(
+        static_cast<WaitTimer*>(fired)->identity);
+  };
+  ScheduleSharedTimer(&timer, SteadyClockNowNanos() + remaining);
+  waiter->Wait(KernelTimeout::Never());
+  if (CancelSharedTimer(&timer)) return true;
+  // The timer has posted, so the post consumed above may have been its own.
+  // Consume another if there is one, so that each post wakes one wait.
+  return waiter->Wait(KernelTimeout(absl::UnixEpoch()));
+}
+
+}  // namespace synchronization_internal
+
+Timer::Timer(absl::AnyInvocable<void()> callback)
+    : callback_(std::move(callback)) {
+  fire = &Timer::Fire;
+}
+
+Timer::~Timer() {
+  // Destroying the timer from its callback would destroy the running callback.
+  ABSL_RAW_CHECK(!synchronization_internal::SharedTimerFiringOnThisThread(this),
+                 "absl::Timer destroyed by its own callback");
+  Cancel();
+}
+
+void Timer::Fire(synchronization_internal::SharedTimer* timer) {
+  static_cast<Timer*>(timer)->callback_();
+}
+
+void Timer::ScheduleAt(absl::Time deadline) {
+  ScheduleAfter(deadline - absl::Now());
+}
+
+void Timer::ScheduleAfter(absl::Duration delay) {
+  Cancel();
+  const int64_t now = synchronization_internal::SteadyClockNowNanos();
+  const int64_t max_delay = (std::numeric_limits<int64_t>::max)() / 2 - now;
+  const int64_t nanos = absl::ToInt64Nanoseconds(delay);
+  synchronization_internal::ScheduleSharedTimer(
+      this, now + std::min(std::max<int64_t>(nanos, 0), max_delay));
+}
+
+bool Timer::Cancel() {
+  return synchronization_internal::CancelSharedTimer(this);
+}
+
+void SetTimerSlack(absl::Duration slack) {
+  synchronization_internal::slack_ticks.store(
+      std::max<int64_t>(absl::ToInt64Microseconds(slack), 1),
+      std::memory_order_relaxed);
+}
+
+absl::Duration GetTimerSlack() {
+  return absl::Microseconds(
+      synchronization_internal::slack_ticks.load(std::memory_order_relaxed));
+}
+
+void EnableTimedWaitCoalescing(bool enabled) {
+  // Start the timer thread before any wait needs it.
+  synchronization_internal::Service();
+  synchronization_internal::coalesce_timed_waits.store(
+      enabled, std::memory_order_relaxed);
+}
+
+ABSL_NAMESPACE_END
+}  // namespace absl
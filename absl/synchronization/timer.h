@@ -0,0 +1,110 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// -----------------------------------------------------------------------------
+// timer.h
+// -----------------------------------------------------------------------------
+//
+// This header file defines `absl::Timer`, which runs a callback at a deadline,
+// and controls the coalescing of deadlines into shared wakeups.
+//
+// All timers of a process are kept in one hierarchical timer wheel, served by
+// a single background thread. Deadlines are rounded up to a multiple of the
+// timer slack, so that timers due within the same slack interval fire together
+// in one wakeup of that thread, instead of each arming a kernel timer.
+//
+// The same wheel can serve the timed waits of `absl::Mutex` and
+// `absl::CondVar`, such as `CondVar::WaitWithTimeout()` and
+// `Mutex::AwaitWithDeadline()`: see `EnableTimedWaitCoalescing()`.
+
+#ifndef ABSL_SYNCHRONIZATION_TIMER_H_
+#define ABSL_SYNCHRONIZATION_TIMER_H_
+
+#include "absl/base/config.h"
+#include "absl/functional/any_invocable.h"
+#include "absl/synchronization/internal/shared_timer.h"
+#include "absl/time/time.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+// Timer
+//
+// A `Timer` runs a callback once, on a shared background thread, at or after
+// the deadline it is scheduled for, and at most one timer slack later (subject
+// to scheduling delays). Callbacks of all timers run one at a time, so they
+// should be short and must not block. A callback may reschedule or cancel its
+// own timer, but must not destroy it.
+//
+// Example:
+//
+//   absl::Timer timer([&] { request.Abort(); });
+//   timer.ScheduleAfter(absl::Seconds(5));
+//   ...
+//   timer.Cancel();
+class Timer : private synchronization_internal::SharedTimer {
+ public:
+  explicit Timer(absl::AnyInvocable<void()> callback);
+
+  Timer(const Timer&) = delete;
+  Timer& operator=(const Timer&) = delete;
+
+  // Cancels the timer, waiting for the callback to finish if it is running.
+  // Must not be called from the callback of this timer.
+  ~Timer();
+
+  // Timer::ScheduleAt()
+  // Timer::ScheduleAfter()
+  //
+  // Schedules the callback to run at `deadline`, or after `delay`. A timer
+  // that is already scheduled is rescheduled. May be called from the
+  // callback, to run it again.
+  void ScheduleAt(absl::Time deadline);
+  void ScheduleAfter(absl::Duration delay);
+
+  // Timer::Cancel()
+  //
+  // Unschedules the timer, and returns whether the callback had yet to run.
+  // If the callback is running on another thread, waits for it to finish.
+  bool Cancel();
+
+ private:
+  static void Fire(synchronization_internal::SharedTimer* timer);
+
+  absl::AnyInvocable<void()> callback_;
+};
+
+// SetTimerSlack()
+//
+// Sets the interval to a multiple of which deadlines are rounded up, for
+// timers scheduled and timed waits started from now on. Larger values
+// coalesce more wakeups, at the cost of firing later. A slack of zero keeps
+// deadlines exact, to the microsecond. Defaults to one millisecond.
+void SetTimerSlack(absl::Duration slack);
+absl::Duration GetTimerSlack();
+
+// EnableTimedWaitCoalescing()
+//
+// Enables or disables waiting for the deadlines of timed waits of `Mutex` and
+// `CondVar` through the shared timer wheel, which rounds them up to the timer
+// slack. Blocked threads then wait without a kernel timeout, and the timer
+// thread wakes those whose deadlines have passed, so that waiters whose
+// deadlines fall within the same slack interval cost a single timer
+// expiration. Disabled by default.
+void EnableTimedWaitCoalescing(bool enabled);
+
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_SYNCHRONIZATION_TIMER_H_
@@ -0,0 +1,130 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Measures the cost of many concurrent deadlines, with and without coalescing
+// them through the shared timer wheel. Besides time, each benchmark reports
+// per operation the process CPU time, the context switches of the process
+// (each a trip through the kernel) and the wakeups of the timer thread (each
+// a single kernel timer expiration).
+
+#include <sys/resource.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "absl/profiling/benchmark.h"
+#include "absl/base/no_destructor.h"
+#include "absl/synchronization/internal/shared_timer.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/synchronization/timer.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+
+namespace {
+
+// Process-wide resource usage, sampled around a benchmark.
+struct Usage {
+  Usage() {
+    struct rusage ru;
+    getrusage(RUSAGE_SELF, &ru);
+    cpu_seconds = ru.ru_utime.tv_sec + ru.ru_stime.tv_sec +
+                  (ru.ru_utime.tv_usec + ru.ru_stime.tv_usec) * 1e-6;
+    context_switches = static_cast<double>(ru.ru_nvcsw + ru.ru_nivcsw);
+    timer_wakeups = static_cast<double>(
+        absl::synchronization_internal::SharedTimerWakeups());
+  }
+
+  double cpu_seconds;
+  double context_switches;
+  double timer_wakeups;
+};
+
+void ReportUsage(benchmark::State& state, const Usage& before, double ops) {
+  const Usage after;
+  state.counters["cpu_us_per_op"] =
+      (after.cpu_seconds - before.cpu_seconds) * 1e6 / ops;
+  state.counters["ctx_switches_per_op"] =
+      (after.context_switches - before.context_switches) / ops;
+  state.counters["timer_wakeups_per_op"] =
+      (after.timer_wakeups - before.timer_wakeups) / ops;
+}
+
+// Schedules `state.range(0)` timers with deadlines spread over 10ms, and waits
+// for all of them to fire, with a timer slack of `state.range(1)`
+// microseconds.
+void BM_ScheduleTimers(benchmark::State& state) {
+  const int timers = static_cast<int>(state.range(0));
+  const absl::Duration saved_slack = absl::GetTimerSlack();
+  absl::SetTimerSlack(absl::Microseconds(state.range(1)));
+  std::atomic<int> fired{0};
+  std::vector<std::unique_ptr<absl::Timer>> pending;
+  pending.reserve(timers);
+  for (int i = 0; i < timers; ++i) {
+    pending.push_back(std::make_unique<absl::Timer>(
+        [&fired] { fired.fetch_add(1, std::memory_order_relaxed); }));
+  }
+  const Usage before;
+  for (auto _ : state) {
+    fired.store(0, std::memory_order_relaxed);
+    for (int i = 0; i < timers; ++i) {
+      pending[i]->ScheduleAfter(absl::Nanoseconds(i * 10000000LL / timers));
+    }
+    while (fired.load(std::memory_order_relaxed) < timers) {
+      absl::SleepFor(absl::Milliseconds(1));
+    }
+  }
+  ReportUsage(state, before, static_cast<double>(state.iterations()) * timers);
+  state.SetItemsProcessed(state.iterations() * timers);
+  absl::SetTimerSlack(saved_slack);
+}
+
+BENCHMARK(BM_ScheduleTimers)
+    ->ArgNames({"timers", "slack_us"})
+    ->ArgsProduct({{10000, 100000}, {1, 1000}})
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+// Each thread repeatedly waits on a `CondVar` that is never signaled, for a
+// 1ms timeout, with the timed waits coalesced if `state.range(0)` is nonzero.
+void BM_TimedWaiters(benchmark::State& state) {
+  static absl::NoDestructor<absl::Mutex> mu;
+  static absl::NoDestructor<absl::CondVar> cv;
+  static Usage* before = nullptr;
+  if (state.thread_index() == 0) {
+    absl::EnableTimedWaitCoalescing(state.range(0) != 0);
+    before = new Usage;
+  }
+  for (auto _ : state) {
+    absl::MutexLock lock(mu.get());
+    cv->WaitWithTimeout(mu.get(), absl::Milliseconds(1));
+  }
+  if (state.thread_index() == 0) {
+    ReportUsage(state, *before,
+                static_cast<double>(state.iterations()) * state.threads());
+    delete before;
+    absl::EnableTimedWaitCoalescing(false);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_TimedWaiters)
+    ->ArgName("coalesce")
+    ->Arg(0)
+    ->Arg(1)
+    ->UseRealTime()
+    ->ThreadRange(1, 1024);
+
+}  // namespace
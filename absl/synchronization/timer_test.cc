@@ -0,0 +1,176 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/synchronization/timer.h"
+
+#include <atomic>
+#include <memory>
+#include <thread>  // NOLINT(build/c++11)
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "absl/base/config.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/synchronization/notification.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+
+namespace {
+
+TEST(TimerTest, FiresAfterDeadline) {
+  absl::Notification fired;
+  absl::Time fired_at;
+  absl::Timer timer([&] {
+    fired_at = absl::Now();
+    fired.Notify();
+  });
+  const absl::Time deadline = absl::Now() + absl::Milliseconds(20);
+  timer.ScheduleAt(deadline);
+  EXPECT_TRUE(fired.WaitForNotificationWithTimeout(absl::Seconds(30)));
+  EXPECT_GE(fired_at, deadline - absl::Milliseconds(1));
+  EXPECT_FALSE(timer.Cancel());
+}
+
+TEST(TimerTest, PastDeadlineFires) {
+  absl::Notification fired;
+  absl::Timer timer([&] { fired.Notify(); });
+  timer.ScheduleAfter(-absl::Seconds(1));
+  EXPECT_TRUE(fired.WaitForNotificationWithTimeout(absl::Seconds(30)));
+}
+
+TEST(TimerTest, CancelPreventsFiring) {
+  std::atomic<bool> fired{false};
+  absl::Timer timer([&] { fired = true; });
+  timer.ScheduleAfter(absl::Milliseconds(20));
+  EXPECT_TRUE(timer.Cancel());
+  EXPECT_FALSE(timer.Cancel());
+  absl::SleepFor(absl::Milliseconds(50));
+  EXPECT_FALSE(fired);
+}
+
+TEST(TimerTest, Reschedule) {
+  std::atomic<int> fired{0};
+  absl::Timer timer([&] { ++fired; });
+  timer.ScheduleAfter(absl::Hours(1));
+  timer.ScheduleAfter(absl::Milliseconds(1));
+  while (fired == 0) absl::SleepFor(absl::Milliseconds(1));
+  absl::SleepFor(absl::Milliseconds(20));
+  EXPECT_EQ(fired, 1);
+}
+
+TEST(TimerTest, RescheduleFromCallback) {
+  absl::Mutex mu;
+  int fired = 0;
+  std::unique_ptr<absl::Timer> timer;
+  timer = std::make_unique<absl::Timer>([&] {
+    absl::MutexLock lock(&mu);
+    if (++fired < 3) timer->ScheduleAfter(absl::Milliseconds(1));
+  });
+  timer->ScheduleAfter(absl::Milliseconds(1));
+  mu.LockWhen(absl::Condition(
+      +[](int* fired) { return *fired == 3; }, &fired));
+  mu.Unlock();
+  timer.reset();
+  EXPECT_EQ(fired, 3);
+}
+
+TEST(TimerTest, ManyTimers) {
+  constexpr int kTimers = 1000;
+  std::atomic<int> fired{0};
+  std::vector<std::unique_ptr<absl::Timer>> timers;
+  for (int i = 0; i < kTimers; ++i) {
+    timers.push_back(std::make_unique<absl::Timer>([&] { ++fired; }));
+    timers.back()->ScheduleAfter(absl::Microseconds(i * 37 % 5000));
+  }
+  while (fired < kTimers) absl::SleepFor(absl::Milliseconds(1));
+  EXPECT_EQ(fired, kTimers);
+}
+
+TEST(TimerTest, TimerSlack) {
+  const absl::Duration saved = absl::GetTimerSlack();
+  absl::SetTimerSlack(absl::Milliseconds(5));
+  EXPECT_EQ(absl::GetTimerSlack(), absl::Milliseconds(5));
+  absl::SetTimerSlack(absl::ZeroDuration());
+  EXPECT_EQ(absl::GetTimerSlack(), absl::Microseconds(1));
+  absl::SetTimerSlack(saved);
+}
+
+class CoalescedTimedWaitTest : public testing::Test {
+ protected:
+  CoalescedTimedWaitTest() { absl::EnableTimedWaitCoalescing(true); }
+  ~CoalescedTimedWaitTest() override { absl::EnableTimedWaitCoalescing(false); }
+};
+
+TEST_F(CoalescedTimedWaitTest, CondVarTimesOut) {
+  absl::Mutex mu;
+  absl::CondVar cv;
+  absl::MutexLock lock(&mu);
+  const absl::Time start = absl::Now();
+  EXPECT_TRUE(cv.WaitWithTimeout(&mu, absl::Milliseconds(20)));
+  EXPECT_GE(absl::Now() - start, absl::Milliseconds(19));
+}
+
+TEST_F(CoalescedTimedWaitTest, CondVarSignaled) {
+  absl::Mutex mu;
+  absl::CondVar cv;
+  bool ready = false;
+  std::thread signaler([&] {
+    absl::SleepFor(absl::Milliseconds(10));
+    absl::MutexLock lock(&mu);
+    ready = true;
+    cv.Signal();
+  });
+  {
+    absl::MutexLock lock(&mu);
+    const absl::Time deadline = absl::Now() + absl::Seconds(60);
+    while (!ready) {
+      ASSERT_FALSE(cv.WaitWithDeadline(&mu, deadline));
+    }
+  }
+  signaler.join();
+}
+
+TEST_F(CoalescedTimedWaitTest, MutexAwait) {
+  absl::Mutex mu;
+  bool ready = false;
+  absl::MutexLock lock(&mu);
+  EXPECT_FALSE(mu.AwaitWithTimeout(absl::Condition(&ready),
+                                   absl::Milliseconds(10)));
+  std::thread setter([&] {
+    absl::MutexLock lock(&mu);
+    ready = true;
+  });
+  EXPECT_TRUE(mu.AwaitWithTimeout(absl::Condition(&ready), absl::Seconds(60)));
+  mu.Unlock();
+  setter.join();
+  mu.Lock();
+}
+
+TEST_F(CoalescedTimedWaitTest, ManyWaiters) {
+  constexpr int kThreads = 32;
+  absl::Mutex mu;
+  absl::CondVar cv;
+  std::atomic<int> timed_out{0};
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kThreads; ++i) {
+    threads.emplace_back([&] {
+      absl::MutexLock lock(&mu);
+      if (cv.WaitWithTimeout(&mu, absl::Milliseconds(5))) ++timed_out;
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  EXPECT_EQ(timed_out, kThreads);
+}
+
+}  // namespace